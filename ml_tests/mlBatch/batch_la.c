@@ -0,0 +1 @@
+../ml_shared/batch_la.c
\ No newline at end of file
@@ -0,0 +1 @@
+../ml_shared/batch_la.h
\ No newline at end of file
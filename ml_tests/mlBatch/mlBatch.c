@@ -0,0 +1,566 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/////////////////////////////////////////////////////////
+// includes
+/////////////////////////////////////////////////////////
+#include "mlBatch.h"
+#include "math_fns.h"
+#ifndef LINUX
+#include "pulp.h"
+#endif
+
+/////////////////////////////////////////////////////////
+// batched mlChol, mlSchur, mlSvd and mlGivens (batch_la): batches of
+// the 4 reference matrices of each test, interleaved, every matrix
+// checked against the golden intervals of the reference test.
+// reports factorizations per kcycle against batch size and cores.
+/////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////
+// shared globals
+/////////////////////////////////////////////////////////
+
+  // mlChol inputs and golden intervals (sum, variance)
+  RT_LOCAL_DATA static const float cholA[400] = {
+    303.470856F, 232.923172F, 230.768829F, 268.232452F, 290.827576F,
+    266.681854F, 260.26178F, 243.220169F, 204.95726F, 254.371506F,
+    232.923172F, 306.786957F, 150.072327F, 240.676498F, 240.213257F,
+    262.100861F, 198.56073F, 208.65712F, 176.16304F, 251.689056F,
+    230.768829F, 150.072327F, 240.404602F, 197.724838F, 236.858963F,
+    234.790741F, 234.871063F, 204.457382F, 159.889771F, 215.81102F,
+    268.232452F, 240.676498F, 197.724838F, 282.804321F, 268.153351F,
+    254.361664F, 255.589432F, 211.94133F, 202.797195F, 234.541214F,
+    290.827576F, 240.213257F, 236.858963F, 268.153351F, 333.248505F,
+    288.502899F, 287.612122F, 204.519318F, 186.860687F, 282.243958F,
+    266.681854F, 262.100861F, 234.790741F, 254.361664F, 288.502899F,
+    342.523132F, 250.400269F, 221.994583F, 190.439819F, 260.307373F,
+    260.26178F, 198.56073F, 234.871063F, 255.589432F, 287.612122F,
+    250.400269F, 316.82254F, 215.144745F, 220.304245F, 274.951F,
+    243.220169F, 208.65712F, 204.457382F, 211.94133F, 204.519318F,
+    221.994583F, 215.144745F, 285.421875F, 201.810257F, 218.668243F,
+    204.95726F, 176.16304F, 159.889786F, 202.797195F, 186.860687F,
+    190.439819F, 220.304245F, 201.810242F, 196.810059F, 191.85791F,
+    254.371506F, 251.689056F, 215.81102F, 234.541214F, 282.243958F,
+    260.307373F, 274.951F, 218.668243F, 191.85791F, 304.568939F,
+    192.720413F, 187.857651F, 191.182724F, 192.309235F, 181.072556F,
+    192.601608F, 229.261627F, 169.053772F, 97.7473145F, 67.866188F,
+    187.857651F, 359.280731F, 314.138794F, 235.301544F, 355.080902F,
+    245.752823F, 273.9534F, 210.029968F, 195.828949F, 160.757233F,
+    191.182724F, 314.138794F, 389.621216F, 241.086227F, 334.472F,
+    257.45929F, 236.9832F, 284.335236F, 231.341217F, 130.113632F,
+    192.309235F, 235.301544F, 241.086227F, 257.856354F, 257.257111F,
+    231.584412F, 252.30957F, 212.795822F, 143.377777F, 79.846344F,
+    181.072556F, 355.080902F, 334.472F, 257.257111F, 481.132324F,
+    260.147339F, 254.54541F, 284.495697F, 238.155823F, 201.209244F,
+    192.601608F, 245.752823F, 257.45929F, 231.584412F, 260.147339F,
+    280.765289F, 217.672562F, 212.882431F, 146.165878F, 91.8943F,
+    229.261627F, 273.9534F, 236.9832F, 252.30957F, 254.54541F,
+    217.672562F, 342.737F, 216.477936F, 157.514282F, 124.563507F,
+    169.053772F, 210.029968F, 284.335236F, 212.795822F, 284.495697F,
+    212.882431F, 216.477936F, 354.106323F, 182.385559F, 152.80928F,
+    97.7473145F, 195.828949F, 231.341217F, 143.377777F, 238.155853F,
+    146.165894F, 157.514267F, 182.385559F, 191.854477F, 122.254814F,
+    67.866188F, 160.757233F, 130.113632F, 79.8463364F, 201.209229F,
+    91.8942947F, 124.563515F, 152.809265F, 122.254814F, 148.702759F,
+    282.681671F, 267.321167F, 210.169724F, 219.442596F, 116.133614F,
+    313.660217F, 184.807587F, 112.703224F, 231.434204F, 244.006027F,
+    267.321167F, 366.616791F, 274.316376F, 327.876343F, 152.137451F,
+    410.695F, 239.623642F, 167.794693F, 271.897644F, 317.203888F,
+    210.169724F, 274.316376F, 336.857F, 349.288116F, 142.974274F,
+    358.299835F, 232.703049F, 133.79097F, 244.086029F, 334.48761F,
+    219.442596F, 327.876343F, 349.288116F, 458.382599F, 196.235962F,
+    453.637787F, 326.323883F, 215.591354F, 322.43457F, 418.805298F,
+    116.133614F, 152.137451F, 142.974274F, 196.235962F, 152.269592F,
+    235.53476F, 156.949585F, 119.845047F, 184.52887F, 163.539902F,
+    313.660217F, 410.695F, 358.299835F, 453.637787F, 235.53476F,
+    549.058594F, 350.008484F, 226.395782F, 391.164307F, 422.684418F,
+    184.807587F, 239.623642F, 232.703049F, 326.323883F, 156.949585F,
+    350.008484F, 266.563416F, 156.543137F, 245.178375F, 293.531891F,
+    112.703224F, 167.794693F, 133.79097F, 215.591354F, 119.845047F,
+    226.395782F, 156.543137F, 153.599716F, 170.179779F, 211.887787F,
+    231.434204F, 271.897644F, 244.086014F, 322.43457F, 184.52887F,
+    391.164307F, 245.178375F, 170.179764F, 322.315247F, 297.762512F,
+    244.006027F, 317.203888F, 334.487579F, 418.805298F, 163.539902F,
+    422.684418F, 293.53186F, 211.887802F, 297.762512F, 426.426392F,
+    385.477142F, 290.105377F, 208.15271F, 276.383484F, 327.724884F,
+    274.768799F, 195.594528F, 231.961853F, 236.81543F, 125.517914F,
+    290.105377F, 365.236481F, 130.390488F, 239.91008F, 282.727325F,
+    275.931366F, 207.462677F, 274.413208F, 207.663055F, 98.3234406F,
+    208.15271F, 130.390488F, 163.724518F, 149.080597F, 142.606567F,
+    104.238785F, 86.092247F, 140.764938F, 158.837662F, 96.3741531F,
+    276.383484F, 239.91008F, 149.080597F, 271.327423F, 249.644424F,
+    267.503815F, 208.790161F, 160.691986F, 187.503815F, 91.5999756F,
+    327.724884F, 282.727325F, 142.606567F, 249.644424F, 335.381866F,
+    310.307129F, 241.36937F, 198.531876F, 191.958038F, 77.014F,
+    274.768799F, 275.931366F, 104.238785F, 267.503815F, 310.307129F,
+    343.373901F, 265.854248F, 152.787384F, 182.657257F, 58.0079269F,
+    195.594528F, 207.462677F, 86.092247F, 208.790161F, 241.36937F,
+    265.854248F, 272.105896F, 164.66478F, 125.637184F, 44.6241798F,
+    231.961853F, 274.413208F, 140.764938F, 160.691986F, 198.531876F,
+    152.787384F, 164.66478F, 313.961304F, 168.816238F, 102.921577F,
+    236.81543F, 207.663055F, 158.837662F, 187.50383F, 191.958038F,
+    182.657257F, 125.637184F, 168.816238F, 220.208511F, 113.273285F,
+    125.517906F, 98.3234406F, 96.3741608F, 91.5999832F, 77.0139923F,
+    58.0079269F, 44.6241798F, 102.921577F, 113.273285F, 82.2213669F };
+
+  // hi, lo per check, 4 matrices
+  RT_LOCAL_DATA static const float cholGold[16] = {
+    249.197952F, 249.192978F, 23.1504765F, 23.1500149F, 297.39035F,
+    297.38443F, 21.3576164F, 21.3571892F, 315.765961F, 315.759674F,
+    23.4114571F, 23.4109879F, 238.491898F, 238.487137F, 22.0633163F,
+    22.0628738F };
+
+  // mlSchur inputs (symmetric) and golden intervals
+  RT_LOCAL_DATA static const float schurA[100] = {
+    431.424896F, -332.915924F, -246.548111F, -332.485474F, -437.717865F,
+    -332.915924F, 1423.53333F, -314.047241F, -230.521576F, 78.6693726F,
+    -246.548111F, -314.047241F, 847.96228F, 250.109161F, 320.915405F,
+    -332.485474F, -230.521576F, 250.109161F, 1819.52905F, 1293.37927F,
+    -437.717865F, 78.6693726F, 320.915405F, 1293.37927F, 1052.97021F,
+    394.013092F, 23.0439568F, -240.092178F, 149.108078F, -583.700378F,
+    23.0439568F, 203.53624F, 57.9439774F, 133.19754F, 227.439407F,
+    -240.092178F, 57.9439774F, 230.038666F, 52.7716904F, 509.824768F,
+    149.108078F, 133.19754F, 52.7716904F, 391.247711F, 74.889122F,
+    -583.700378F, 227.439407F, 509.824768F, 74.889122F, 1419.64172F,
+    466.726288F, -187.057327F, 107.069092F, -122.094795F, 70.9483261F,
+    -187.057327F, 338.389038F, 60.1494713F, 237.151215F, -488.833F,
+    107.069092F, 60.1494713F, 250.532532F, 249.328888F, -32.1080475F,
+    -122.094795F, 237.151215F, 249.328888F, 441.869965F, -171.971146F,
+    70.9483261F, -488.833F, -32.1080475F, -171.971146F, 974.27655F,
+    581.897339F, 285.430023F, -176.483063F, -39.7847519F, -124.96624F,
+    285.430023F, 282.335144F, -60.5030556F, 120.271088F, -85.1179352F,
+    -176.483063F, -60.5030556F, 459.508789F, 289.082184F, 301.67804F,
+    -39.7847519F, 120.271088F, 289.082184F, 947.621948F, -243.034912F,
+    -124.96624F, -85.1179352F, 301.67804F, -243.034912F, 571.041F };
+
+  // sum |U|, sum and variance of the diagonal, variance of |U|
+  RT_LOCAL_DATA static const float schurGold[32] = {
+    8.79604149F, 8.79586601F, 5575.47559F, 5575.36426F, 0.0793861672F,
+    0.0793845728F, 1.51855562E+6F, 1.51852538E+6F, 9.29323387F, 9.29304886F,
+    2638.50391F, 2638.45117F, 0.0643965602F, 0.0643952787F, 637568.688F,
+    637555.938F, 9.07298374F, 9.07280254F, 2471.81909F, 2471.76978F,
+    0.0711383894F, 0.0711369738F, 308398.094F, 308391.906F, 9.28204441F,
+    9.2818594F, 2842.43262F, 2842.37598F, 0.0647429377F, 0.0647416413F,
+    253840.219F, 253835.156F };
+
+  // mlSvd inputs and golden intervals
+  RT_LOCAL_DATA static const float svdA[100] = {
+    11.6551533F, 3.06224823F, 2.69974494F, 3.07209659F, 5.8402195F,
+    5.38518524F, 17.9067078F, 3.7271893F, 7.52009249F, 6.52579117F,
+    5.51939058F, 8.50919819F, 14.2524872F, 5.74400616F, 7.68253946F,
+    5.39514446F, 9.84270287F, 1.0558517F, 13.0100479F, 3.79853821F,
+    4.7271595F, 2.22568727F, 3.20742488F, 2.26850915F, 10.2175779F,
+    10.1547337F, 7.83849859F, 0.186470896F, 9.02727127F, 1.96604741F,
+    6.09034729F, 15.2287111F, 7.06730318F, 3.53196239F, 7.58894396F,
+    5.05575705F, 7.65774393F, 13.6253195F, 9.25017548F, 9.01099205F,
+    5.51714897F, 5.21025038F, 1.79024613F, 16.0892334F, 7.27960157F,
+    8.75941467F, 4.73321819F, 7.52213764F, 1.81048298F, 10.2133579F,
+    11.2927141F, 8.60052204F, 7.96709299F, 1.8759222F, 1.7121501F,
+    6.7556839F, 13.9989452F, 9.35526848F, 4.76235104F, 4.02235794F,
+    1.90023458F, 3.37065792F, 14.4098072F, 1.37983751F, 9.80338764F,
+    4.39650059F, 8.03841877F, 8.17665F, 12.315279F, 6.41258383F,
+    2.5780983F, 1.24106932F, 4.07057762F, 0.676924825F, 11.0976028F,
+    15.2955627F, 2.1150198F, 0.259674221F, 9.9411993F, 7.44640827F,
+    9.82235146F, 19.5138206F, 4.7160778F, 9.87535572F, 8.52921104F,
+    3.09076977F, 9.51736069F, 11.136487F, 1.17273784F, 0.00695414608F,
+    3.03156424F, 3.69181323F, 1.20341122F, 17.1191216F, 9.57513714F,
+    3.22288203F, 7.88983774F, 6.71485901F, 1.09614336F, 17.2396259F };
+
+  // sum |U|, sum s, sum |V|
+  RT_LOCAL_DATA static const float svdGold[24] = {
+    10.298893F, 10.298687F, 68.5329056F, 68.5315323F, 10.1729374F,
+    10.1727333F, 10.0122976F, 10.0120974F, 71.1426544F, 71.1412354F,
+    10.4046917F, 10.4044838F, 9.66996193F, 9.66976929F, 66.3763275F,
+    66.375F, 9.65051651F, 9.65032387F, 9.39816856F, 9.39798F,
+    85.7524719F, 85.7507629F, 9.71934605F, 9.7191515F };
+
+  // mlGivens axis-angles (4 per instance), vectors and golden intervals
+  RT_LOCAL_DATA static const float rotAxang[64] = {
+    0.537315905F, 0.431067526F, 0.307068586F, 0.577941477F, 0.779238641F,
+    0.300232F, 0.700225055F, 0.816065788F, 0.322612315F, 0.850906253F,
+    0.644510448F, 0.00450440077F, 6.2314992F, 4.25306034F, 4.24440336F,
+    0.146671772F, 0.368041366F, 0.688357472F, 0.344911F, 0.908061445F,
+    0.350111187F, 0.611794889F, 0.730155945F, 0.405566961F, 0.861375451F,
+    0.389706433F, 0.589837909F, 0.104593463F, 6.02135134F, 2.99249506F,
+    1.41425216F, 3.12729502F, 0.614258766F, 0.992975712F, 0.670909524F,
+    0.643571794F, 0.260873258F, 0.010383904F, 0.220724255F, 0.718503892F,
+    0.744735777F, 0.117861405F, 0.707927406F, 0.263756514F, 2.95552F,
+    0.340473592F, 4.00773859F, 1.50181603F, 0.510631204F, 0.0867552F,
+    0.212690905F, 0.559378684F, 0.212716162F, 0.893914163F, 0.114992231F,
+    0.0939357653F, 0.833071291F, 0.439762354F, 0.970329463F, 0.823572397F,
+    2.52266741F, 6.05263662F, 0.702538788F, 2.01244F };
+
+  // 4 x 10 vectors per instance
+  RT_LOCAL_DATA static const float rotVects[480] = {
+    8.20709801F, 3.02407312F, 1.50127769F, 2.79844761F, 3.33178949F,
+    3.02734303F, 5.18113756F, 7.8872385F, 3.37505174F, 5.91507578F,
+    5.65312529F, 2.22433448F, 7.77719F, 4.0488286F, 1.7474581F,
+    3.05511379F, 8.0394392F, 9.14125729F, 8.61291599F, 9.26366F,
+    8.03486156F, 4.14793158F, 3.0969739F, 3.43148518F, 4.90532875F,
+    8.44855881F, 1.0281508F, 5.63255644F, 2.53277707F, 1.21741128F,
+    1.05693984F, 6.95392704F, 8.78373F, 9.82075882F, 9.38618279F,
+    4.99967241F, 5.75658369F, 5.06690693F, 9.4879446F, 0.382877976F,
+    1.78643084F, 6.53727865F, 1.89578497F, 0.883758605F, 4.46264267F,
+    3.04548621F, 4.76434135F, 3.49337268F, 3.72048521F, 8.86352348F,
+    3.89939475F, 1.91730702F, 1.34753656F, 4.59390497F, 3.82865834F,
+    8.31306458F, 3.01796842F, 8.43613052F, 9.45133305F, 0.039696265F,
+    6.34411335F, 9.14812279F, 0.066677548F, 1.27316916F, 7.22506857F,
+    8.04787064F, 8.25588512F, 3.28248596F, 3.24879885F, 1.5374943F,
+    2.85503387F, 4.09558058F, 9.43167877F, 5.36820889F, 3.28547049F,
+    9.5588F, 8.23273945F, 9.54018F, 4.14648867F, 1.32827473F,
+    4.93782902F, 3.49414444F, 0.523151577F, 7.62357807F, 4.91168737F,
+    1.68068874F, 3.31227016F, 8.0303278F, 1.6711359F, 5.83909F,
+    0.380131721F, 3.95978522F, 3.51828289F, 0.861707091F, 0.947937787F,
+    5.15024757F, 3.09565115F, 6.33430147F, 1.75665975F, 3.77142692F,
+    8.25271511F, 5.23232508F, 2.52003884F, 2.19551754F, 8.73391724F,
+    1.36563957F, 0.169684783F, 6.96312761F, 5.37912369F, 2.03573227F,
+    0.264329731F, 9.02626419F, 9.40302944F, 9.86110783F, 1.0381397F,
+    5.63536215F, 4.39330959F, 5.37825632F, 7.5681076F, 4.01272345F,
+    4.03354692F, 7.5716114F, 5.86179733F, 4.26034784F, 9.5824995F,
+    0.413599104F, 2.1226337F, 4.44535303F, 7.01538F, 4.41929913F,
+    5.41101933F, 4.72716379F, 8.28936F, 8.84621334F, 0.294031918F,
+    2.87087607F, 0.777669132F, 9.88338661F, 3.41601515F, 1.53503454F,
+    7.08709049F, 2.80067229F, 5.9424448F, 2.40147376F, 9.37041855F,
+    1.49122274F, 4.9654026F, 7.6089735F, 9.51031399F, 2.41250229F,
+    6.87390614F, 0.163374871F, 9.14500904F, 9.04266548F, 3.27141404F,
+    8.72399F, 5.85819721F, 6.65125799F, 6.84458828F, 6.87675571F,
+    4.86693048F, 2.62822604F, 2.01746058F, 4.84519434F, 9.91757107F,
+    4.53040314F, 9.25431538F, 4.59128284F, 3.22037649F, 8.29015064F,
+    5.93330908F, 1.14753735F, 0.827328503F, 4.07442904F, 2.54796171F,
+    7.50853586F, 9.85083F, 2.69285226F, 4.09143829F, 2.19888902F,
+    7.89499331F, 5.32233667F, 3.10038233F, 6.61463499F, 1.07632F,
+    1.96314347F, 1.48682976F, 2.61578822F, 8.30747128F, 1.17934096F,
+    2.5473485F, 7.47282791F, 9.97582626F, 1.46297204F, 6.62485027F,
+    1.26666677F, 2.42822862F, 9.3967F, 1.39271617F, 0.910787106F,
+    0.960472941F, 7.96906376F, 1.38939917F, 1.02642858F, 4.77299166F,
+    0.817298949F, 5.92588234F, 1.47532535F, 9.06655598F, 3.49296761F,
+    2.98003674F, 4.53965664F, 6.85939217F, 0.357620239F, 6.72102213F,
+    7.32325602F, 1.13945448F, 4.18524408F, 6.80920506F, 4.49476814F,
+    3.55275726F, 5.88608837F, 4.50249338F, 7.02758026F, 0.0175025985F,
+    5.32256031F, 5.40509F, 7.4266758F, 8.89381695F, 2.51460266F,
+    7.674366F, 1.27640343F, 0.380866885F, 4.04717493F, 1.73506844F,
+    8.14107704F, 4.90895748F, 4.03942966F, 9.2514286F, 7.81108475F,
+    2.12849832F, 5.31142282F, 0.564157963F, 4.67429686F, 0.403787613F,
+    8.79362583F, 9.49152374F, 0.393784583F, 8.66974163F, 6.28717613F,
+    7.7719121F, 4.68866587F, 9.70418F, 7.40790844F, 6.45530748F,
+    9.66320896F, 5.55354643F, 6.83777618F, 9.58723927F, 3.18907928F,
+    7.67413235F, 6.36833858F, 0.217414841F, 0.914758623F, 7.78968048F,
+    0.287673324F, 1.15659988F, 0.686613619F, 3.7256577F, 1.21957421F,
+    0.419630647F, 5.9050436F, 9.81042194F, 9.27789783F, 2.60025406F,
+    2.3050189F, 9.34217548F, 9.13449F, 9.97974396F, 6.65504217F,
+    5.56229305F, 8.50378799F, 7.28109741F, 2.42090511F, 7.24933386F,
+    2.39760494F, 1.99788594F, 4.64037085F, 4.60016346F, 4.62511158F,
+    4.61290312F, 6.71062899F, 2.30266833F, 4.94463968F, 8.70731068F,
+    4.41016674F, 5.58459282F, 0.238928407F, 5.65070581F, 3.20371342F,
+    4.79903507F, 9.58180332F, 0.857239127F, 9.37517166F, 7.82762623F,
+    4.01178455F, 0.478271723F, 1.74734485F, 9.16735744F, 6.32047606F,
+    3.74530625F, 3.18651223F, 0.0889649913F, 8.13436127F, 5.09428787F,
+    6.62707281F, 9.83903313F, 9.21471691F, 2.04534507F, 3.36005449F,
+    3.28576088F, 7.53800631F, 1.96714318F, 3.09656429F, 1.47602177F,
+    6.50467873F, 2.18507195F, 2.39791751F, 1.61376143F, 9.78721905F,
+    7.12581444F, 3.89430141F, 0.795006335F, 1.36170912F, 7.25324535F,
+    0.58452636F, 5.9708147F, 9.66888142F, 8.56147575F, 4.99752235F,
+    1.8358779F, 4.57879782F, 0.446885884F, 5.52806425F, 9.21557903F,
+    5.60301781F, 5.00203419F, 7.0849F, 9.37811756F, 1.26066363F,
+    9.68251896F, 4.92361784F, 1.92236328F, 5.9497776F, 7.72660971F,
+    5.51092625F, 1.7036705F, 7.97889F, 0.766120136F, 8.71109104F,
+    9.97035503F, 6.61960077F, 4.09730577F, 2.11268497F, 9.53395176F,
+    5.2329793F, 9.37831783F, 4.43394F, 0.845396F, 2.3449204F,
+    7.58110762F, 4.30752707F, 6.00314F, 5.42020226F, 7.1904273F,
+    5.38764715F, 7.60280704F, 9.60760307F, 5.6806941F, 3.93818569F,
+    1.02203095F, 7.17990303F, 1.50534034F, 2.60241771F, 6.99815F,
+    5.82418537F, 8.67020226F, 3.46231771F, 7.79304314F, 1.78012109F,
+    5.28568935F, 3.56872129F, 2.57358F, 7.06295872F, 7.65657663F,
+    5.95450783F, 4.53842926F, 9.70217133F, 8.26372F, 1.99999869F,
+    3.76238179F, 4.31649065F, 9.11447334F, 9.64202F, 5.48593855F,
+    3.39946103F, 8.84787846F, 7.01154661F, 9.83458138F, 9.49603558F,
+    8.16304779F, 4.7874341F, 5.88162947F, 2.27089143F, 4.48054552F,
+    5.49189615F, 6.29200268F, 5.31940699F, 5.44917F, 5.34588814F,
+    2.59939241F, 1.67693293F, 7.31658649F, 6.49584103F, 7.85765409F,
+    1.95463455F, 3.93091035F, 2.29409122F, 9.7345295F, 9.80299377F,
+    9.94399166F, 6.41161203F, 7.85508585F, 0.351920515F, 3.1825943F,
+    0.886088669F, 6.02045727F, 4.12320423F, 6.7860508F, 3.50090218F,
+    0.0235017203F, 9.97747898F, 9.41783905F, 5.82644844F, 3.74936819F,
+    3.91587806F, 5.6202507F, 9.79101753F, 6.3290081F, 7.84300184F,
+    9.38974762F, 1.36141026F, 6.5494442F, 7.49320889F, 7.75620461F,
+    0.85692817F, 3.29178119F, 5.40436363F, 5.71602631F, 8.77971F,
+    0.356722832F, 0.118639968F, 1.96023798F, 3.62909222F, 1.47588122F,
+    1.63191724F, 0.618664443F, 3.58514881F, 9.86168575F, 7.33287764F,
+    7.32143974F, 7.98681974F, 8.16723F, 6.47003222F, 1.03040195F,
+    5.26225519F, 2.77394533F, 7.1463685F, 2.28481388F, 1.36453819F };
+
+  // sum, variance
+  RT_LOCAL_DATA static const float rotGold[16] = {
+    515.134338F, 515.124084F, 12.5581408F, 12.557889F, 459.256348F,
+    459.247192F, 16.6814709F, 16.681139F, 500.901917F, 500.891907F,
+    18.0123291F, 18.0119705F, 498.683319F, 498.67337F, 20.0220661F,
+    20.0216656F };
+
+  // work matrices, interleaved with ld = batch size
+  RT_LOCAL_DATA static float pool[100 * BATCH_MAX];
+  RT_LOCAL_DATA static int info[BATCH_MAX];
+
+  static const int sizes[N_SIZES] = { 4, 16, BATCH_MAX };
+  static const char *kernNames[N_KERNELS] = { "chol 10x10", "schur 5x5", "svd 5x5", "rotate 10 vectors" };
+
+/////////////////////////////////////////////////////////
+// subfunctions
+/////////////////////////////////////////////////////////
+
+// matrix b of the batch is reference matrix b % 4, for the rotations
+// rotation b % 4 of instance (b / 4) % 4
+void fillBatch(int kern, int nb)
+{
+  int b, e, i, k, s, l;
+
+  for (b = 0; b < nb; b++)
+  {
+    s = b & 3;
+    switch (kern)
+    {
+      case K_CHOL:
+        for (e = 0; e < 100; e++)
+          pool[e*nb + b] = cholA[e + 100*s];
+        break;
+      case K_SCHUR:
+        for (e = 0; e < 25; e++)
+          pool[e*nb + b] = schurA[e + 25*s];
+        break;
+      case K_SVD:
+        for (e = 0; e < 25; e++)
+          pool[e*nb + b] = svdA[e + 25*s];
+        break;
+      default:
+        l = b & 3;
+        s = (b >> 2) & 3;
+        for (k = 0; k < 3; k++)
+          pool[k*nb + b] = rotAxang[16*s + l + 4*k];
+        pool[3*nb + b] = rotAxang[16*s + 12 + l];
+        for (k = 0; k < 3; k++)
+          for (i = 0; i < 10; i++)
+            pool[(4 + i + 10*k)*nb + b] = rotVects[120*s + (i + 10*l) + 40*k];
+        break;
+    }
+  }
+}
+
+// kernel on cores 0..nc-1, cycles on core 0
+int runBatch(int kern, int nb, int nc)
+{
+  int cycles = 0;
+
+  synch_barrier();
+
+  if (get_core_id() == 0)
+  {
+    reset_timer();
+    start_timer();
+  }
+
+  if (get_core_id() < nc)
+  {
+    switch (kern)
+    {
+      case K_CHOL:
+        batchChol(pool, info, 10, nb, nb, nc);
+        break;
+      case K_SCHUR:
+        batchSchurSym(pool, pool + 25*nb, 5, BATCH_SWEEPS, nb, nb, nc);
+        break;
+      case K_SVD:
+        batchSvd(pool, pool + 25*nb, pool + 30*nb, 5, 5, BATCH_SWEEPS, nb, nb, nc);
+        break;
+      default:
+        batchRotate(pool, pool + 4*nb, pool + 34*nb, 10, nb, nb, nc);
+        break;
+    }
+  }
+
+  synch_barrier();
+
+  if (get_core_id() == 0)
+  {
+    stop_timer();
+    cycles = get_time();
+  }
+
+  return cycles;
+}
+
+// sum and unbiased variance of n elements x[i*stride], absolute values
+// if ab is set
+static void stats(const float *x, int n, int stride, int ab, float *sum, float *var)
+{
+  float s = 0.0F;
+  float v = 0.0F;
+  float r;
+  int i;
+
+  for (i = 0; i < n; i++)
+    s += ab ? fAbs(x[i*stride]) : x[i*stride];
+
+  for (i = 0; i < n; i++)
+  {
+    r = (ab ? fAbs(x[i*stride]) : x[i*stride]) - fDiv(s, (float) n);
+    v += r * r;
+  }
+
+  *sum = s;
+  *var = fDiv(v, (float) (n - 1));
+}
+
+static int inRange(float x, const float *gold)
+{
+  return (x <= gold[0]) && (x >= gold[1]);
+}
+
+// every matrix of the batch against the golden intervals of its reference
+// matrix, returns the number of failing matrices
+int checkBatch(int kern, int nb)
+{
+  float chk[4], y[120], tmp;
+  const float *gold;
+  int errors = 0;
+  int b, i, s, l, ok;
+
+  for (b = 0; b < nb; b++)
+  {
+    s = b & 3;
+    ok = 1;
+    switch (kern)
+    {
+      case K_CHOL:
+        gold = cholGold + 4*s;
+        ok = info[b] == 0;
+        stats(pool + b, 100, nb, 0, &chk[0], &chk[1]);
+        ok = ok && inRange(chk[0], gold) && inRange(chk[1], gold + 2);
+        break;
+      case K_SCHUR:
+        gold = schurGold + 8*s;
+        stats(pool + 25*nb + b, 25, nb, 1, &chk[0], &chk[2]);
+        stats(pool + b, 5, 6*nb, 0, &chk[1], &chk[3]);
+        // the reference scales the variance of the diagonal by 1/4
+        for (i = 0; i < 4; i++)
+          ok = ok && inRange(chk[i], gold + 2*i);
+        break;
+      case K_SVD:
+        gold = svdGold + 6*s;
+        stats(pool + b, 25, nb, 1, &chk[0], &tmp);
+        stats(pool + 25*nb + b, 5, nb, 0, &chk[1], &tmp);
+        stats(pool + 30*nb + b, 25, nb, 1, &chk[2], &tmp);
+        for (i = 0; i < 3; i++)
+          ok = ok && inRange(chk[i], gold + 2*i);
+        break;
+      default:
+        // one instance every 4 rotations, back to the mlGivens layout
+        if (b & 3)
+          continue;
+        s = (b >> 2) & 3;
+        gold = rotGold + 4*s;
+        for (l = 0; l < 4; l++)
+          for (i = 0; i < 30; i++)
+            y[(i % 10) + 10*l + 40*(i / 10)] = pool[(34 + i)*nb + b + l];
+        stats(y, 120, 1, 0, &chk[0], &chk[1]);
+        ok = inRange(chk[0], gold) && inRange(chk[1], gold + 2);
+        break;
+    }
+
+    if (!ok)
+    {
+      errors++;
+      printf("%s: matrix %d of %d out of the golden interval\n", kernNames[kern], b, nb);
+    }
+  }
+
+  return errors;
+}
+
+/////////////////////////////////////////////////////////
+// main testing function 
+/////////////////////////////////////////////////////////
+int main(int argc, const char * const argv[])
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  (void)argc;
+  (void)argv;
+
+  int coreid = get_core_id();
+  int ncores = get_core_num();
+  int errors = 0;
+  int cycles1 = 0;
+  int kern, sz, nb, nc, cycles;
+  boolean_T pass;
+
+  init_fp_regs();
+
+  /////////////////////////////////////////////////////////
+  // main test loop 
+  // the cores share each batch
+  /////////////////////////////////////////////////////////
+
+  perf_begin();
+
+  for (kern = 0; kern < N_KERNELS; kern++)
+  {
+    for (sz = 0; sz < N_SIZES; sz++)
+    {
+      nb = sizes[sz];
+
+      for (nc = 1; nc <= ncores; nc <<= 1)
+      {
+        if (coreid == 0)
+          fillBatch(kern, nb);
+
+        cycles = runBatch(kern, nb, nc);
+
+        if (coreid == 0)
+        {
+          if (nc == 1)
+            cycles1 = cycles;
+          errors += checkBatch(kern, nb);
+          printf("%s, batch %d, cores=%d: time=%d, per kcycle x100 %d, speedup x100 %d\n",
+                 kernNames[kern], nb, nc, cycles, (nb * 100000) / cycles, (cycles1 * 100) / cycles);
+        }
+      }
+    }
+  }
+
+  synch_barrier();
+
+  perf_end();
+
+  /////////////////////////////////////////////////////////
+  // check results
+  /////////////////////////////////////////////////////////
+
+  pass = (errors == 0);
+
+  if (coreid == 0)
+    flagPassFail(pass, coreid);
+
+  synch_barrier();
+/////////////////////////////////////////////////////////
+// synchronize and exit
+/////////////////////////////////////////////////////////
+
+  return !pass;
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+#ifndef __ML_BATCH_H__
+#define __ML_BATCH_H__
+
+/////////////////////////////////////////////////////////
+// defines
+/////////////////////////////////////////////////////////
+
+// include the shared header for ml kernels
+#include "mlShared.h"
+#include "batch_la.h"
+
+// largest batch, the matrices are filled from the 4 reference ones
+#define BATCH_MAX 64
+
+// batch sizes of the benchmark, multiples of 4 (one mlGivens instance)
+#define N_SIZES 3
+
+// jacobi sweeps of the schur and svd kernels
+#define BATCH_SWEEPS 6
+
+// kernels
+#define K_CHOL   0
+#define K_SCHUR  1
+#define K_SVD    2
+#define K_ROTATE 3
+#define N_KERNELS 4
+
+/////////////////////////////////////////////////////////
+// subfunctions
+/////////////////////////////////////////////////////////
+void fillBatch(int kern, int nb);
+int runBatch(int kern, int nb, int nc);
+int checkBatch(int kern, int nb);
+
+/////////////////////////////////////////////////////////
+// main testing function 
+/////////////////////////////////////////////////////////
+int main(int argc, const char * const argv[]);
+
+#endif
@@ -0,0 +1 @@
+../ml_shared/mlShared.h
\ No newline at end of file
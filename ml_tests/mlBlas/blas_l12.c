@@ -0,0 +1 @@
+../ml_shared/blas_l12.c
\ No newline at end of file
@@ -0,0 +1 @@
+../ml_shared/blas_l12.h
\ No newline at end of file
@@ -0,0 +1,357 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/////////////////////////////////////////////////////////
+// includes
+/////////////////////////////////////////////////////////
+#include "mlBlas.h"
+#include "math_fns.h"
+#ifndef LINUX
+#include "pulp.h"
+#endif
+
+/////////////////////////////////////////////////////////
+// blas_l12 (saxpy, sdot, weighted dot, row and column major sgemv,
+// distances, and the L2 streaming variants) against size and cores.
+// every result is checked against plain serial loops, reports flops
+// per cycle and the speedup over one core.
+/////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////
+// shared globals
+/////////////////////////////////////////////////////////
+
+  // L1 operands: vectors (also the points of the distances) and a matrix
+  // (also the distances)
+  RT_LOCAL_DATA static float vx[VEC_MAX];
+  RT_LOCAL_DATA static float vy[VEC_MAX];
+  RT_LOCAL_DATA static float vw[VEC_MAX];
+  RT_LOCAL_DATA static float mat[MAT_MAX * MAT_MAX];
+
+  // L2 operands
+  static float l2x[L2_VEC_MAX];
+  static float l2y[L2_VEC_MAX];
+  static float l2A[MAT_MAX * L2_COLS];
+
+  // result of the dot products
+  static float dotRes;
+
+  static const float alpha = 0.75F;
+  static const float beta = -0.5F;
+
+  // vector lengths, matrix sides (gemv), points (distances), rows of L2_COLS
+  // (gemv in L2)
+  static const int sizes[N_KERNELS][N_SIZES] = {
+    { 128, 512, VEC_MAX }, { 128, 512, VEC_MAX }, { 128, 512, VEC_MAX },
+    { 16, 32, MAT_MAX }, { 16, 32, MAT_MAX }, { 16, 32, MAT_MAX },
+    { 2048, 4096, L2_VEC_MAX }, { 2048, 4096, L2_VEC_MAX }, { 16, 32, MAT_MAX } };
+
+  static const char *kernNames[N_KERNELS] = {
+    "saxpy", "sdot", "weighted dot", "sgemv row major", "sgemv col major",
+    "distances 3D", "saxpy L2", "sdot L2", "sgemv L2" };
+
+/////////////////////////////////////////////////////////
+// subfunctions
+/////////////////////////////////////////////////////////
+
+// element i of stimulus s, in [0, 1): the checks regenerate the inputs
+static float stim(int i, int s)
+{
+  unsigned int h = (unsigned int) (i + 7919 * s) * 2654435761U;
+  h ^= h >> 15;
+  return (float) (h >> 8) * 5.96046448e-8F;
+}
+
+static void fill(float *x, int n, int s)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    x[i] = stim(i, s);
+}
+
+void fillInputs(int kern, int sz)
+{
+  int n = sizes[kern][sz];
+
+  switch (kern)
+  {
+    case K_AXPY:
+    case K_DOT:
+    case K_WDOT:
+      fill(vx, n, 0);
+      fill(vy, n, 1);
+      fill(vw, n, 2);
+      break;
+    case K_GEMV_ROW:
+    case K_GEMV_COL:
+      fill(mat, n * n, 3);
+      fill(vx, n, 0);
+      fill(vy, n, 1);
+      break;
+    case K_DIST:
+      fill(vx, n * DIST_DIM, 0);
+      fill(vy, n * DIST_DIM, 1);
+      break;
+    case K_AXPY_L2:
+    case K_DOT_L2:
+      fill(l2x, n, 0);
+      fill(l2y, n, 1);
+      break;
+    default:
+      fill(l2A, n * L2_COLS, 3);
+      fill(vx, L2_COLS, 0);
+      fill(vy, n, 1);
+      break;
+  }
+}
+
+// kernel on cores 0..nc-1 (the L2 ones on every core), cycles on core 0
+int runBlas(int kern, int sz, int nc)
+{
+  int n = sizes[kern][sz];
+  int coreid = get_core_id();
+  int cycles = 0;
+  float s = 0.0F;
+
+  synch_barrier();
+
+  if (coreid == 0)
+  {
+    reset_timer();
+    start_timer();
+  }
+
+  if (coreid < nc)
+  {
+    switch (kern)
+    {
+      case K_AXPY:
+        blasSaxpy(n, alpha, vx, vy, nc);
+        break;
+      case K_DOT:
+        s = blasSdot(n, vx, vy, nc);
+        break;
+      case K_WDOT:
+        s = blasSwdot(n, vx, vw, vy, nc);
+        break;
+      case K_GEMV_ROW:
+        blasSgemv(BLAS_ROW_MAJOR, n, n, alpha, mat, n, vx, beta, vy, nc);
+        break;
+      case K_GEMV_COL:
+        blasSgemv(BLAS_COL_MAJOR, n, n, alpha, mat, n, vx, beta, vy, nc);
+        break;
+      case K_DIST:
+        blasSdist(n, n, DIST_DIM, vx, vy, mat, 0, nc);
+        break;
+    }
+  }
+
+  switch (kern)
+  {
+    case K_AXPY_L2:
+      blasSaxpyL2(n, alpha, l2x, l2y, nc);
+      break;
+    case K_DOT_L2:
+      s = blasSdotL2(n, l2x, l2y, nc);
+      break;
+    case K_GEMV_L2:
+      blasSgemvL2(n, L2_COLS, alpha, l2A, L2_COLS, vx, beta, vy, nc);
+      break;
+  }
+
+  synch_barrier();
+
+  if (coreid == 0)
+  {
+    stop_timer();
+    cycles = get_time();
+    dotRes = s;
+  }
+
+  return cycles;
+}
+
+static int near(float x, float ref)
+{
+  return fAbs(x - ref) <= 1.0e-4F * (fAbs(ref) + 1.0F);
+}
+
+// y = alpha*A*x + beta*y against the inputs, A(i, j) = a[i*rs + j*cs]
+static int checkGemv(const float *y, int m, int n, int rs, int cs)
+{
+  int errors = 0;
+  int i, j;
+  float s;
+
+  for (i = 0; i < m; i++)
+  {
+    s = 0.0F;
+    for (j = 0; j < n; j++)
+      s += stim(i * rs + j * cs, 3) * stim(j, 0);
+    errors += !near(y[i], alpha * s + beta * stim(i, 1));
+  }
+
+  return errors;
+}
+
+// results against serial loops on the regenerated inputs, returns the
+// number of wrong elements
+int checkBlas(int kern, int sz)
+{
+  int n = sizes[kern][sz];
+  int errors = 0;
+  float s, e;
+  int i, j, k;
+
+  switch (kern)
+  {
+    case K_AXPY:
+    case K_AXPY_L2:
+      for (i = 0; i < n; i++)
+        errors += !near(kern == K_AXPY ? vy[i] : l2y[i], alpha * stim(i, 0) + stim(i, 1));
+      break;
+    case K_DOT:
+    case K_DOT_L2:
+    case K_WDOT:
+      s = 0.0F;
+      for (i = 0; i < n; i++)
+        s += stim(i, 0) * stim(i, 1) * (kern == K_WDOT ? stim(i, 2) : 1.0F);
+      errors += !near(dotRes, s);
+      break;
+    case K_GEMV_ROW:
+      errors += checkGemv(vy, n, n, n, 1);
+      break;
+    case K_GEMV_COL:
+      errors += checkGemv(vy, n, n, 1, n);
+      break;
+    case K_DIST:
+      for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+        {
+          s = 0.0F;
+          for (k = 0; k < DIST_DIM; k++)
+          {
+            e = stim(i * DIST_DIM + k, 0) - stim(j * DIST_DIM + k, 1);
+            s += e * e;
+          }
+          errors += !near(mat[i * n + j], fSqrt(s));
+        }
+      break;
+    default:
+      errors += checkGemv(vy, n, L2_COLS, L2_COLS, 1);
+      break;
+  }
+
+  return errors;
+}
+
+// floating point operations of a run
+static int flops(int kern, int n)
+{
+  switch (kern)
+  {
+    case K_WDOT:
+      return 3 * n;
+    case K_GEMV_ROW:
+    case K_GEMV_COL:
+      return 2 * n * n;
+    case K_DIST:
+      return 3 * DIST_DIM * n * n;
+    case K_GEMV_L2:
+      return 2 * n * L2_COLS;
+    default:
+      return 2 * n;
+  }
+}
+
+/////////////////////////////////////////////////////////
+// main testing function 
+/////////////////////////////////////////////////////////
+int main(int argc, const char * const argv[])
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  (void)argc;
+  (void)argv;
+
+  int coreid = get_core_id();
+  int ncores = get_core_num();
+  int errors = 0;
+  int cycles1 = 0;
+  int kern, sz, n, nc, cycles, err;
+  boolean_T pass;
+
+  init_fp_regs();
+
+  /////////////////////////////////////////////////////////
+  // main test loop 
+  // the cores share each operation
+  /////////////////////////////////////////////////////////
+
+  perf_begin();
+
+  for (kern = 0; kern < N_KERNELS; kern++)
+  {
+    for (sz = 0; sz < N_SIZES; sz++)
+    {
+      n = sizes[kern][sz];
+
+      for (nc = 1; nc <= ncores && nc <= BLAS_MAX_CORES; nc <<= 1)
+      {
+        if (coreid == 0)
+          fillInputs(kern, sz);
+
+        cycles = runBlas(kern, sz, nc);
+
+        if (coreid == 0)
+        {
+          if (nc == 1)
+            cycles1 = cycles;
+          err = checkBlas(kern, sz);
+          errors += err;
+          printf("%s, n %d, cores=%d: time=%d, errors=%d, flop per cycle x100 %d, speedup x100 %d\n",
+                 kernNames[kern], n, nc, cycles, err, (flops(kern, n) * 100) / cycles,
+                 (cycles1 * 100) / cycles);
+        }
+      }
+    }
+  }
+
+  synch_barrier();
+
+  perf_end();
+
+  /////////////////////////////////////////////////////////
+  // check results
+  /////////////////////////////////////////////////////////
+
+  pass = (errors == 0);
+
+  if (coreid == 0)
+    flagPassFail(pass, coreid);
+
+  synch_barrier();
+/////////////////////////////////////////////////////////
+// synchronize and exit
+/////////////////////////////////////////////////////////
+
+  return !pass;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+#ifndef __ML_BLAS_H__
+#define __ML_BLAS_H__
+
+/////////////////////////////////////////////////////////
+// defines
+/////////////////////////////////////////////////////////
+
+// include the shared header for ml kernels
+#include "mlShared.h"
+#include "blas_l12.h"
+
+// largest vector in L1, largest matrix (square, gemv and distances)
+#define VEC_MAX 2048
+#define MAT_MAX 64
+
+// largest vector and gemv matrix (MAT_MAX rows of L2_COLS) in L2
+#define L2_VEC_MAX 8192
+#define L2_COLS    256
+
+// sizes of the benchmark per kernel
+#define N_SIZES 3
+
+// dimension of the points of the distances, as mlDist
+#define DIST_DIM 3
+
+// kernels
+#define K_AXPY     0
+#define K_DOT      1
+#define K_WDOT     2
+#define K_GEMV_ROW 3
+#define K_GEMV_COL 4
+#define K_DIST     5
+#define K_AXPY_L2  6
+#define K_DOT_L2   7
+#define K_GEMV_L2  8
+#define N_KERNELS  9
+
+/////////////////////////////////////////////////////////
+// subfunctions
+/////////////////////////////////////////////////////////
+void fillInputs(int kern, int sz);
+int runBlas(int kern, int sz, int nc);
+int checkBlas(int kern, int sz);
+
+/////////////////////////////////////////////////////////
+// main testing function 
+/////////////////////////////////////////////////////////
+int main(int argc, const char * const argv[]);
+
+#endif
@@ -0,0 +1 @@
+../ml_shared/math_fns.h
\ No newline at end of file
@@ -0,0 +1,1465 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/////////////////////////////////////////////////////////
+// includes
+/////////////////////////////////////////////////////////
+#include "mlHalf.h"
+#include "math_fns.h"
+#ifndef LINUX
+#include "pulp.h"
+#endif
+
+/////////////////////////////////////////////////////////
+// mlGemm, mlGemv, mlDotp, mlAxpy, mlDist and mlRbf in fp16 and bfloat16
+// on the stimuli of the fp32 tests (their 4 per-core instances), against
+// the loops of the fp32 tests: cycles, speedup and footprint against fp32
+// and the error relative to the fp32 results. Runs on core 0.
+/////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////
+// shared globals
+/////////////////////////////////////////////////////////
+
+  // the stimuli stay in L2, each kernel is staged in L1 before its runs
+
+  // mlGemm: A, B, C (initial), alpha, beta
+  static const float gemmA[400] = {
+    0.543887079F, 1.89803934F, 2.68289351F, 4.33679628F, 7.44293499F,
+    9.24406338F, 6.38374949F, 6.97672272F, 0.838285327F, 7.43567562F,
+    0.832797945F, 6.28573084F, 0.97634095F, 6.75229788F, 8.19195366F,
+    4.95482111F, 8.09114552F, 5.07997131F, 4.79978228F, 3.54787016F,
+    4.2390151F, 9.328022F, 6.41616535F, 2.70698714F, 8.27036476F, 3.36048746F,
+    2.10052299F, 9.6549921F, 3.34692478F, 7.42154884F, 4.02015543F,
+    0.248764381F, 6.58188486F, 4.29376125F, 9.24551F, 7.5380888F, 3.26799178F,
+    0.94165194F, 7.65116501F, 3.71465158F, 3.43063855F, 5.60120153F,
+    1.95120931F, 0.52251637F, 2.86325121F, 9.46129131F, 2.08317137F,
+    3.42654324F, 9.1433754F, 9.43257618F, 7.09749508F, 0.223759875F,
+    5.96763372F, 6.96859646F, 3.75961256F, 7.81624889F, 0.590517759F,
+    9.3464241F, 0.808470249F, 1.8762356F, 8.64141083F, 7.37611532F,
+    1.67391193F, 7.53778028F, 9.18426228F, 2.08319616F, 0.872735322F,
+    6.46524191F, 4.3587265F, 2.80345035F, 8.50572586F, 6.59392F, 5.66245079F,
+    6.86786652F, 6.8201251F, 4.25314188F, 2.52018905F, 2.13344574F,
+    8.99513054F, 9.2378149F, 6.42488766F, 1.25547338F, 8.55917072F,
+    5.2403183F, 5.12796F, 8.75299454F, 7.88222075F, 4.25045824F, 9.47952175F,
+    0.202449F, 9.63506413F, 4.74444914F, 1.05871379F, 0.289964408F,
+    7.50818062F, 0.906715572F, 9.58357716F, 8.54980755F, 6.65302372F,
+    0.826881886F, 9.68164062F, 1.24939227F, 3.72311592F, 9.12567F,
+    4.35686731F, 1.88090146F, 1.75810897F, 3.20797706F, 0.37806344F,
+    1.27223063F, 8.38660908F, 9.48735714F, 2.76313496F, 8.20837F, 4.13702202F,
+    4.21630526F, 6.63038349F, 2.35632682F, 6.35065031F, 6.03752279F, 5.42989F,
+    4.38498259F, 7.50484848F, 6.25872755F, 2.97290421F, 4.74229765F,
+    6.56156111F, 5.90471792F, 2.42553353F, 0.485026717F, 8.69426823F,
+    9.41099453F, 8.32077122F, 1.05186236F, 3.3615303F, 4.02813864F,
+    0.474626511F, 9.64948368F, 5.38815784F, 6.30443621F, 6.79869795F,
+    3.78140473F, 0.150069416F, 3.47381473F, 6.12839937F, 6.11960363F,
+    1.44597793F, 5.51101542F, 7.73565245F, 3.85853553F, 7.34164715F,
+    3.60595226F, 1.7226063F, 6.75896788F, 8.29788F, 1.70684123F, 3.60642314F,
+    2.74480367F, 1.85946155F, 7.69014F, 5.83523369F, 2.24432969F, 9.89836693F,
+    1.97124493F, 9.81659222F, 0.438525528F, 3.4861064F, 7.42375183F,
+    0.854936659F, 6.05880308F, 9.82998848F, 0.132165521F, 0.95845288F,
+    1.40170574F, 3.17045522F, 9.50203419F, 0.213262454F, 4.96370554F,
+    3.5972538F, 8.19282246F, 8.91787815F, 2.29390717F, 2.59138417F,
+    7.9652648F, 1.37497842F, 5.16678572F, 7.30208921F, 1.81416345F,
+    3.71726775F, 2.00164557F, 1.15452266F, 7.51593065F, 6.39483881F,
+    2.26172733F, 3.56706786F, 3.69667745F, 2.51887321F, 7.05654573F,
+    4.73986626F, 2.07946181F, 9.68796062F, 9.88062382F, 3.14007711F,
+    7.20534229F, 5.10924721F, 4.46989393F, 6.31389666F, 7.33976126F,
+    6.64667845F, 7.56558275F, 0.803492785F, 7.83248F, 5.18120098F,
+    6.78968811F, 1.39165652F, 9.57566357F, 2.8699708F, 0.438332677F,
+    6.87703228F, 7.49757242F, 2.9915874F, 1.44451702F, 9.64792442F,
+    3.42268729F, 7.80340433F, 1.38340378F, 0.621799052F, 9.21242809F,
+    7.16965342F, 7.45643711F, 7.85329199F, 4.20017433F, 3.04526806F,
+    1.42347741F, 8.76340389F, 2.23749542F, 8.66349506F, 5.20063162F,
+    7.29993868F, 1.16912127F, 7.90724134F, 3.58763456F, 1.45461118F,
+    2.97763801F, 0.917574704F, 8.09514713F, 3.54601097F, 0.938116074F,
+    6.48690844F, 8.79942417F, 3.58287644F, 1.74150443F, 9.46735096F,
+    8.5376873F, 3.46724892F, 0.710612476F, 3.82391334F, 2.93271399F,
+    1.00414073F, 5.10699129F, 1.60107565F, 1.66614F, 5.61240482F, 3.37189F,
+    0.060964413F, 2.42278886F, 9.5837F, 0.202598989F, 6.07660532F,
+    8.02635479F, 0.971176445F, 7.68988132F, 9.091712F, 0.648213744F,
+    6.75407028F, 8.86517048F, 6.03224564F, 2.71539259F, 3.36665893F,
+    8.4593153F, 0.0401496328F, 2.49076962F, 8.62354F, 5.31026506F,
+    4.99823856F, 8.28908253F, 9.1875124F, 1.14616656F, 7.16178179F,
+    3.82164979F, 0.266677111F, 9.68988323F, 4.50749254F, 5.72248507F,
+    9.10776615F, 8.90694F, 9.60933304F, 2.73412609F, 7.525033F, 2.04345846F,
+    7.28859329F, 9.71088791F, 3.18025827F, 6.34713459F, 0.439795554F,
+    2.14580846F, 2.8827374F, 9.67525578F, 7.89472389F, 8.72498F, 8.05918312F,
+    3.51637197F, 6.81154156F, 2.65036845F, 3.96087837F, 1.77753448F,
+    3.95693183F, 9.52182674F, 1.30800378F, 4.52864313F, 3.9115119F,
+    1.34222305F, 7.14406729F, 1.63172603F, 4.77991915F, 0.462709874F,
+    5.84669352F, 3.07146406F, 4.53165817F, 3.53319621F, 2.52254581F,
+    5.97019529F, 5.96446228F, 8.80330658F, 9.64445877F, 2.21521473F,
+    1.15680933F, 9.29584789F, 1.58416677F, 0.992061079F, 3.72038388F,
+    1.27277446F, 7.21075487F, 9.92817211F, 5.83595324F, 9.86308765F,
+    1.38254905F, 6.85252F, 4.76568842F, 3.06240058F, 7.90088224F, 6.23122835F,
+    4.76891613F, 0.229175583F, 5.93440437F, 6.95574808F, 1.33512378F,
+    6.73799133F, 1.58010697F, 5.46453428F, 4.97258186F, 4.28685665F,
+    5.66627836F, 8.88441F, 2.43622947F, 6.12593365F, 8.23528767F, 5.99672031F,
+    2.00458264F, 5.37972546F, 9.80748272F, 7.94556904F, 6.91117F, 8.70908546F,
+    2.239079F, 0.341001362F, 1.35397148F, 3.85830617F, 1.00463223F,
+    6.42483854F, 6.62763834F, 9.91563702F, 5.98087F, 6.44588423F,
+    0.542683482F, 5.54141712F, 7.04306889F, 4.14420605F, 4.1296649F,
+    2.33448434F, 1.12682593F, 9.93906116F, 1.98285627F, 4.52836561F,
+    0.336863935F, 7.30129671F, 6.38712215F, 0.142991185F, 7.22341919F,
+    5.26229811F };
+
+  static const float gemmB[400] = {
+    7.46655798F, 7.54029322F, 6.42056465F, 4.91659355F, 9.17552757F,
+    8.87407303F, 8.38288403F, 1.84421432F, 8.51307774F, 8.57509136F,
+    4.36606836F, 5.67591F, 8.11050606F, 2.34224486F, 7.44277143F, 2.58355427F,
+    2.26851153F, 6.94811487F, 7.91252851F, 2.29028606F, 6.73151302F,
+    6.61724901F, 6.03945541F, 0.767894328F, 8.7483139F, 0.751861334F,
+    5.07736158F, 3.36002469F, 4.75796556F, 2.20790744F, 1.89020419F,
+    6.90010595F, 8.61678219F, 0.118761554F, 8.96011448F, 6.78437185F,
+    1.74516642F, 2.03159237F, 7.68141794F, 6.16588593F, 6.47240686F,
+    0.404817343F, 2.82369876F, 7.35927343F, 9.11157799F, 0.119515009F,
+    1.04178131F, 8.67414665F, 0.837310731F, 7.04847479F, 1.87100923F,
+    7.65668583F, 6.60406637F, 5.19821405F, 4.08716965F, 3.75792527F,
+    8.84190178F, 5.93670702F, 1.58022583F, 1.41980565F, 4.91031647F,
+    6.11690426F, 6.91649914F, 7.85144854F, 9.17375946F, 5.90989733F,
+    3.71297479F, 9.97649193F, 3.84501219F, 2.58092594F, 1.63777769F,
+    0.728175104F, 9.55624866F, 3.36686F, 5.27028513F, 4.95324945F,
+    8.17165089F, 8.60668945F, 9.33169746F, 7.12361097F, 2.65319014F,
+    8.5295639F, 5.84075165F, 8.5062542F, 6.17448139F, 1.33791411F,
+    6.88236761F, 5.07264185F, 6.7683F, 5.97437525F, 4.74926949F, 3.8966918F,
+    3.12030888F, 0.700063229F, 5.00304413F, 5.50200558F, 4.97437716F,
+    9.34476471F, 9.63752174F, 7.78977203F, 6.28709364F, 3.04526281F,
+    1.83392036F, 6.60168457F, 1.04157615F, 2.93878627F, 6.16273F, 1.16349447F,
+    0.682756186F, 7.13966322F, 0.652945697F, 7.86851788F, 0.0818286836F,
+    8.78741455F, 1.12580609F, 1.23864448F, 8.23606682F, 4.40773F, 3.62137341F,
+    4.97621775F, 0.864230275F, 1.39210606F, 4.20411873F, 2.27375221F,
+    7.56706F, 8.84816F, 3.23490477F, 4.16971827F, 5.41642475F, 6.1193285F,
+    3.73695517F, 0.10439378F, 0.743514121F, 1.29522359F, 0.667237103F,
+    9.2381258F, 2.63767052F, 1.25973284F, 5.31209707F, 5.93633318F,
+    9.60157204F, 3.56537127F, 7.43403816F, 1.03439891F, 4.16563892F,
+    8.04623604F, 3.90049148F, 5.37786579F, 9.31440639F, 8.33466339F,
+    2.44761205F, 8.2813673F, 1.25614953F, 4.48191738F, 4.13200378F,
+    6.31609058F, 2.79034901F, 8.26050854F, 9.43479633F, 6.56235456F,
+    5.16433096F, 4.62270069F, 7.94929F, 0.307452619F, 4.58806896F,
+    4.28010511F, 7.70467091F, 9.91278F, 7.77514076F, 2.2149806F, 5.43735838F,
+    6.1807723F, 0.349162072F, 0.343755454F, 7.08067703F, 2.45081043F,
+    1.91629767F, 2.57589412F, 2.00575256F, 7.06953621F, 3.27864838F,
+    7.86704779F, 2.29533935F, 8.7439537F, 7.28020287F, 5.26380634F,
+    4.25987577F, 5.54904604F, 0.203660473F, 4.20468187F, 4.17251682F,
+    1.30198622F, 1.39889181F, 7.95604897F, 4.95865917F, 7.03606796F,
+    3.32772136F, 3.26472354F, 4.50922155F, 4.51347685F, 3.29541922F,
+    0.212209523F, 8.6378F, 1.72444856F, 2.76866722F, 5.7819643F, 0.747831583F,
+    5.56638813F, 3.19383907F, 0.888248205F, 8.7928F, 9.46177864F, 4.90451908F,
+    8.86649895F, 1.65227413F, 3.17865586F, 6.01074505F, 9.98709774F,
+    4.85967731F, 7.86674643F, 1.78286052F, 0.331869513F, 6.59173775F,
+    7.02037716F, 8.58051205F, 7.87553358F, 3.84209681F, 4.65951633F,
+    1.65579319F, 1.71565747F, 7.72324896F, 9.72772503F, 9.21702766F,
+    4.40281773F, 1.07385361F, 4.18804121F, 7.84448624F, 5.48594379F,
+    8.23597622F, 1.76664221F, 7.50468397F, 8.0774622F, 8.81805706F,
+    0.176118061F, 0.81416136F, 0.128951862F, 7.94881678F, 5.0731492F,
+    4.17415667F, 9.7268734F, 3.88904643F, 9.89224148F, 3.13775659F,
+    0.0544690974F, 5.56784868F, 9.95917797F, 0.637209117F, 6.00591516F,
+    4.00651646F, 9.5052433F, 9.21265125F, 5.64886761F, 0.650485337F,
+    1.54847777F, 1.39189351F, 0.688605189F, 5.99875355F, 4.51519251F,
+    7.58335829F, 5.05304718F, 8.77908897F, 4.8985734F, 8.91293907F,
+    9.06748581F, 9.80922413F, 8.91360474F, 9.47343349F, 4.66856241F,
+    4.60830641F, 4.14254808F, 0.942791164F, 3.125247F, 4.44592953F,
+    8.48484421F, 4.68686056F, 9.13215446F, 1.89046657F, 7.90284634F,
+    9.12099934F, 7.78241348F, 1.42888832F, 4.62440348F, 6.87530613F,
+    4.29564428F, 2.83499026F, 7.26769066F, 5.03827715F, 0.925459802F,
+    3.4103179F, 6.24984455F, 6.4264245F, 7.51688385F, 9.20316219F,
+    1.50000107F, 8.15825558F, 5.9519887F, 8.87026787F, 3.983845F, 5.59603596F,
+    4.24901581F, 7.22717094F, 9.61218548F, 1.85726082F, 0.467430264F,
+    5.40663385F, 0.8397578F, 3.94372249F, 8.8322525F, 8.69791317F,
+    7.67877531F, 4.1318078F, 7.42457438F, 8.72418499F, 1.25492561F,
+    9.74496555F, 5.04154539F, 7.57671F, 6.13961935F, 9.45952606F, 1.95237732F,
+    6.12945318F, 5.86295271F, 9.58944416F, 5.44467258F, 5.40922546F,
+    2.12209916F, 8.84950352F, 5.68828F, 7.99835253F, 0.116607852F,
+    8.40283108F, 5.78013706F, 4.03064537F, 5.32506371F, 9.30730057F,
+    3.66161227F, 9.65868282F, 8.78759766F, 3.73091769F, 0.644002914F,
+    4.15237808F, 1.84492874F, 0.398032069F, 1.69039822F, 2.8304646F,
+    8.75616741F, 0.549449861F, 9.30727482F, 0.622784257F, 5.32492F,
+    1.58320987F, 3.66150236F, 3.58385754F, 5.71344042F, 1.95872295F,
+    5.36586189F, 4.21857214F, 1.4495306F, 8.77652F, 8.88121319F, 9.0548048F,
+    3.53910279F, 2.97107744F, 9.06117153F, 0.336971939F, 9.29428F,
+    7.46995068F, 1.75675118F, 7.2659235F, 5.85605049F, 1.27653539F,
+    3.05991459F, 4.43252087F, 7.09877777F, 9.11166668F, 9.01756F, 9.25170422F,
+    5.75892353F, 5.92726326F, 8.84515095F, 6.38347292F, 1.60110593F,
+    8.00941467F, 2.77542353F, 4.41701889F, 4.20061302F, 2.24543667F,
+    5.64411068F, 4.56263828F, 1.13914227F };
+
+  static const float gemmC[400] = {
+    8.89247131F, 7.50677824F, 9.94982147F, 6.09410763F, 9.38635063F,
+    3.01820636F, 7.43147373F, 8.97153187F, 5.09758377F, 7.48111486F,
+    9.07107925F, 2.84900951F, 1.61161745F, 4.4398F, 5.4628706F, 8.59227276F,
+    3.35095954F, 9.54609776F, 6.88506079F, 0.735066533F, 0.59213382F,
+    2.17626238F, 7.98191404F, 5.62968063F, 5.49932766F, 7.76460695F,
+    8.40954113F, 7.35757923F, 3.49168038F, 9.32409763F, 4.28206396F,
+    8.03502274F, 3.05342674F, 9.78941345F, 2.20663691F, 6.13623953F,
+    7.28104591F, 6.69313431F, 2.80221081F, 6.89461184F, 7.62704754F,
+    5.57031107F, 3.15670323F, 9.93972778F, 6.2677803F, 3.15189457F,
+    2.17198062F, 4.02478313F, 0.222307399F, 7.06391954F, 4.35831308F,
+    0.150140569F, 4.2003026F, 6.03485823F, 0.24239023F, 2.56900239F,
+    0.740730941F, 6.35269785F, 3.24030304F, 3.35353303F, 5.26203632F,
+    6.06928778F, 2.43750787F, 6.29853916F, 1.68021381F, 9.44331932F,
+    2.62257457F, 2.97152114F, 4.95683861F, 0.539529085F, 1.99947155F,
+    8.62303829F, 2.22101331F, 0.00570779108F, 0.733338654F, 3.4409678F,
+    0.61466229F, 4.26956224F, 0.0139661897F, 1.72916746F, 9.96433926F,
+    1.92268395F, 9.39096355F, 1.45160341F, 4.96529388F, 6.23136568F, 3.85536F,
+    8.06283951F, 3.52602267F, 0.592366874F, 9.99508667F, 4.89905882F,
+    0.631627083F, 2.41008162F, 3.82525063F, 6.63644743F, 0.833860874F,
+    8.98109245F, 6.11819553F, 4.19543362F, 6.46676874F, 9.26230621F,
+    0.811671555F, 2.17720079F, 6.09357595F, 0.357289165F, 4.68230295F,
+    5.20453215F, 7.63421345F, 2.27793765F, 3.37815022F, 2.27287626F,
+    3.22333288F, 1.6743114F, 3.75289226F, 4.87764835F, 3.91026545F,
+    5.41200066F, 4.73076F, 1.00765F, 2.59467196F, 4.94100809F, 4.37650824F,
+    2.51459599F, 0.71309495F, 4.91243505F, 0.951248884F, 5.44111967F,
+    3.21189475F, 5.69402885F, 8.74080181F, 1.98880208F, 0.469484776F,
+    3.93977523F, 6.00458241F, 2.61358333F, 5.14937F, 2.02925301F, 7.2279F,
+    5.24082851F, 8.92702484F, 7.87473249F, 4.42631435F, 2.99043226F,
+    3.42508674F, 6.04146051F, 3.83839774F, 4.28633213F, 2.68180752F,
+    6.68000698F, 5.75224495F, 9.84633732F, 6.17245865F, 8.70508289F,
+    4.12925816F, 0.348981321F, 5.77439642F, 1.76397169F, 1.23106277F,
+    8.07276726F, 8.86107254F, 4.16618109F, 2.63971019F, 3.89775372F,
+    8.8918457F, 7.1322484F, 6.1985631F, 7.20123959F, 7.65737104F, 6.2974472F,
+    9.32337379F, 2.64015222F, 7.12931681F, 0.534368217F, 5.61906815F,
+    8.50285244F, 6.92269945F, 4.2837F, 9.98289776F, 9.44441223F, 7.49933815F,
+    9.51518345F, 1.79286146F, 1.30675685F, 8.9772377F, 7.31424952F,
+    7.15101576F, 2.63648129F, 9.7994194F, 9.88946342F, 5.60708284F,
+    0.67217809F, 3.67933702F, 9.92470551F, 3.4972856F, 4.41530228F,
+    5.86499214F, 7.2768712F, 7.60969973F, 6.43873F, 9.24814224F, 0.896307588F,
+    5.57273531F, 0.857632041F, 9.22881222F, 6.33554459F, 3.98309541F,
+    6.21944046F, 1.95722485F, 9.80955124F, 0.677073896F, 7.926085F,
+    3.57422614F, 5.10305309F, 7.92188883F, 1.13765597F, 9.85270786F,
+    0.493414104F, 7.86926413F, 9.90545082F, 2.41171169F, 5.97673368F,
+    3.23051858F, 3.29411697F, 2.99968028F, 6.69573164F, 6.8696413F,
+    4.34254313F, 5.26335144F, 5.70597792F, 7.4641614F, 5.22347927F,
+    0.36766091F, 0.497000515F, 2.28723884F, 5.77072716F, 5.38167524F,
+    9.40537262F, 8.28113079F, 5.35567141F, 9.55508232F, 3.04585242F,
+    2.13108301F, 3.15482664F, 5.52192879F, 2.0762372F, 6.1135006F,
+    9.40994835F, 5.79665422F, 4.39501381F, 0.434757F, 0.966745675F,
+    6.69949675F, 9.34417534F, 9.15470409F, 3.894485F, 7.04110765F,
+    3.91377163F, 5.32623672F, 2.5203383F, 7.01072407F, 9.68191528F,
+    9.87186337F, 0.117573746F, 3.21994376F, 5.63604403F, 6.15627098F,
+    1.42448366F, 5.56172848F, 7.80962563F, 5.45863247F, 9.71471F, 4.35854F,
+    1.18818069F, 7.61484385F, 6.84083223F, 0.642780423F, 4.27189207F,
+    4.42977285F, 2.22371197F, 1.0346781F, 2.31356192F, 0.487405866F,
+    9.07765388F, 1.19750488F, 1.52586567F, 8.02355194F, 9.8738451F,
+    5.86217976F, 3.39854145F, 9.88938427F, 7.5720706F, 7.30649805F,
+    1.22116768F, 7.46414709F, 5.38286638F, 4.90236282F, 2.12953186F,
+    5.6801877F, 7.79776335F, 9.59862614F, 6.40740538F, 2.61807251F,
+    8.1376543F, 4.36685658F, 7.35844135F, 9.84192944F, 7.1264286F,
+    2.91950893F, 3.67091131F, 3.12134862F, 9.53191471F, 8.06195F, 9.78407097F,
+    6.99984455F, 2.86294389F, 3.29560399F, 9.45867729F, 9.22726059F,
+    4.78539228F, 7.14526606F, 2.20331573F, 8.41199303F, 6.95923615F,
+    6.63209057F, 7.52412128F, 2.02850199F, 3.32639432F, 4.37211704F,
+    4.39989185F, 8.03530693F, 1.57466829F, 8.73280525F, 9.18287086F,
+    7.35958767F, 4.26807308F, 3.21823025F, 5.40609121F, 3.19649339F,
+    3.3390367F, 9.15818787F, 9.49570465F, 1.05489659F, 8.38048077F, 4.78661F,
+    9.8017149F, 8.69108486F, 5.66567707F, 1.95259035F, 9.70500469F,
+    3.81893754F, 4.36489677F, 5.41190481F, 8.04623508F, 2.56636477F,
+    8.355937F, 7.71251345F, 7.23137522F, 1.64480519F, 4.49124813F,
+    7.73742628F, 6.92694378F, 0.0982611403F, 8.41939163F, 6.451931F,
+    9.91021729F, 8.17010784F, 6.33900452F, 0.264018327F, 3.3027544F,
+    1.78677988F, 6.77173424F, 1.49555159F, 3.61530423F, 9.65785217F,
+    1.39041853F, 9.92997169F, 4.91877317F, 2.81767917F, 2.13626504F,
+    9.79324818F, 3.58355665F, 8.63139439F, 3.05209494F, 1.76472187F,
+    9.0307188F, 0.0554992259F, 8.23690414F, 6.15907621F, 7.18222809F,
+    5.1165657F, 5.6422143F, 3.17093754F, 0.627964854F, 2.112077F, 4.48822546F,
+    3.4671576F, 9.06381607F, 0.360507071F, 4.7531662F };
+
+  static const float gemmAlpha[4] = {
+    0.363082469F, 7.86419F, 1.84876311F, 8.56158352F };
+
+  static const float gemmBeta[4] = {
+    2.60491562F, 8.3880024F, 9.84814F, 8.3380537F };
+
+  // mlGemv: A, x, z, beta
+  static const float gemvA[400] = {
+    8.89355183F, 4.56787872F, 5.01960611F, 3.57426763F, 1.93365157F, 9.94315F,
+    5.33383465F, 6.14486551F, 9.34166431F, 4.78183651F, 4.15140867F,
+    5.68520594F, 2.68398905F, 5.06363869F, 2.2263813F, 0.147600189F,
+    8.33410835F, 7.29718208F, 7.31444311F, 4.8620224F, 2.03397346F,
+    8.89189434F, 4.68149042F, 9.37376404F, 8.01269817F, 8.07543087F,
+    3.53723168F, 3.46549726F, 3.52511835F, 3.11159492F, 7.55145121F,
+    4.44767857F, 7.46242666F, 8.50842285F, 8.02718067F, 8.06853867F,
+    7.18519068F, 0.0272353813F, 8.46274948F, 7.04473972F, 8.52767277F,
+    5.09189034F, 8.41008854F, 3.39473629F, 8.17214203F, 5.15605354F,
+    3.94239545F, 3.30230188F, 4.62144852F, 5.50126028F, 6.56559038F,
+    3.88382888F, 4.95562267F, 9.14636517F, 8.59283066F, 1.65165889F,
+    4.44284773F, 3.78941035F, 3.91279411F, 5.30239439F, 3.21100593F,
+    6.33888245F, 0.953066468F, 7.14185F, 5.55366945F, 5.2259264F, 1.96351099F,
+    0.638379931F, 4.90506887F, 4.20652866F, 4.54788446F, 1.41657722F,
+    8.65172195F, 5.23376179F, 9.71112347F, 1.65007162F, 3.59117413F,
+    5.3534708F, 0.403721362F, 3.59708452F, 2.95918226F, 4.01637125F,
+    2.12701869F, 4.58302927F, 7.797369F, 9.34188652F, 9.45202637F,
+    5.12194777F, 1.32582915F, 1.97581506F, 2.96168804F, 5.22951031F,
+    0.514842272F, 1.03592372F, 4.37309456F, 6.85533619F, 8.79378223F,
+    9.34466267F, 2.82455492F, 8.83793736F, 7.48141527F, 4.6551466F,
+    5.2859025F, 9.51730061F, 9.81279659F, 5.62915421F, 1.33510506F,
+    0.474726826F, 9.73775768F, 3.26722813F, 6.81313181F, 9.91118431F,
+    6.2909565F, 1.63100421F, 6.34688139F, 2.38592482F, 7.97391891F,
+    9.66444874F, 5.51800203F, 8.03939056F, 5.26805449F, 0.632442176F,
+    6.54882908F, 7.71907377F, 5.20940113F, 4.06845045F, 6.72902107F,
+    6.20146179F, 6.28422976F, 9.06049347F, 9.26755333F, 6.31395149F,
+    6.99516344F, 2.20040607F, 3.20653486F, 3.57118654F, 5.19455671F,
+    1.94657719F, 8.35009384F, 8.43649483F, 1.66590858F, 4.06445694F,
+    5.8533206F, 1.58943772F, 0.613050938F, 4.56940794F, 7.88240337F,
+    8.42094326F, 7.04898071F, 0.687213957F, 9.38457203F, 7.70664787F,
+    2.07973909F, 7.94114923F, 9.92709255F, 0.561131179F, 1.92694902F,
+    8.65584087F, 3.04399323F, 2.08458F, 3.36043787F, 6.96889305F, 2.83444262F,
+    3.45543647F, 2.19631791F, 6.92904472F, 9.10691166F, 6.97813654F, 4.38564F,
+    1.73158181F, 2.76542974F, 9.60164452F, 2.71240878F, 8.2477026F,
+    3.63456392F, 3.64597964F, 9.0710659F, 7.55235386F, 4.63807774F,
+    1.52804577F, 3.1937747F, 3.25456285F, 4.43187714F, 0.231135175F,
+    8.43322372F, 4.80349398F, 2.10156488F, 1.51781344F, 1.43716979F,
+    5.72974491F, 1.62514722F, 8.06296062F, 1.11817336F, 6.26916456F,
+    6.75151443F, 1.68777883F, 0.269986421F, 7.00556183F, 1.38582611F,
+    9.3600769F, 4.85354185F, 0.819970191F, 9.2824707F, 8.89334202F,
+    3.9675386F, 8.71131897F, 1.32072401F, 2.12184834F, 2.33924055F,
+    9.96535873F, 7.06366062F, 9.44258F, 6.12556744F, 7.61981916F, 2.08140206F,
+    0.675686657F, 0.51997304F, 5.4449892F, 3.80034137F, 4.55695343F,
+    1.98929226F, 5.32173634F, 8.3203907F, 9.43984604F, 8.91404F, 2.22370648F,
+    9.61286163F, 1.84532678F, 9.77004623F, 7.76385355F, 9.08932209F,
+    5.86040592F, 6.61322355F, 1.06963074F, 2.40745831F, 0.621600866F,
+    5.36141634F, 7.38342905F, 0.18428871F, 4.56586361F, 0.132126406F,
+    1.01691949F, 5.37265301F, 5.61571074F, 9.73611F, 9.83595371F, 3.46664262F,
+    1.1433605F, 1.42728627F, 3.78482771F, 2.2256012F, 4.09024F, 8.63858604F,
+    0.0709085763F, 8.30439377F, 2.41167521F, 9.21803093F, 1.03441453F,
+    3.66076255F, 3.96449089F, 0.180362284F, 8.98919392F, 3.36497569F,
+    9.9118042F, 2.99364591F, 7.40250969F, 9.44812584F, 5.94236422F,
+    7.13212633F, 3.5057745F, 9.5456F, 0.869502127F, 4.69311047F, 5.28086185F,
+    9.61512375F, 8.07825184F, 7.20355129F, 5.21836042F, 6.00257F,
+    0.594679594F, 1.45142186F, 4.32936239F, 1.26345515F, 8.53395557F,
+    2.35414219F, 5.92928886F, 6.59487677F, 9.48331356F, 0.034913715F,
+    2.03494549F, 2.44284678F, 2.47186375F, 6.20175743F, 2.85174847F,
+    3.19201946F, 4.34211826F, 5.04081917F, 7.28939438F, 8.55611801F,
+    1.49843264F, 1.386796F, 1.82783306F, 9.14081192F, 7.80997086F,
+    4.68266344F, 2.10241413F, 5.73643589F, 8.38018894F, 8.60306549F,
+    1.89570379F, 1.57764232F, 2.04463959F, 7.14660883F, 1.60526013F,
+    3.3099916F, 6.12731647F, 1.93052459F, 4.64242506F, 5.26544285F,
+    9.01889706F, 8.91478157F, 2.70034981F, 6.75611067F, 7.26871F, 6.05265951F,
+    1.6248256F, 4.65173388F, 3.15073848F, 5.0563879F, 9.41321087F,
+    2.57409954F, 3.08112621F, 5.78834152F, 8.22133064F, 4.91149616F,
+    4.8047843F, 3.40375638F, 5.1064558F, 2.37319517F, 5.73145533F,
+    2.61027241F, 3.23468F, 1.7235055F, 5.95532799F, 3.16561556F, 7.17146349F,
+    1.4843626F, 5.73935223F, 0.109899975F, 4.05686665F, 2.00048304F,
+    9.3144865F, 4.67858124F, 4.89148092F, 9.18386173F, 9.09692669F,
+    8.02498817F, 1.5047555F, 4.27849F, 9.1459322F, 6.01375341F, 1.87017262F,
+    0.411061376F, 3.75596285F, 3.72159791F, 7.82693815F, 5.92564F,
+    1.48865986F, 1.78215814F, 1.22855175F, 2.46720695F, 1.65368629F,
+    9.36774063F, 8.1400547F, 4.9121933F, 9.9825449F, 2.33448339F, 6.49357224F,
+    9.51950264F, 7.59622335F, 4.62405157F, 2.8869679F, 6.04804754F,
+    6.70537281F, 5.58624411F, 3.58296919F, 0.10297852F, 1.37817633F,
+    5.91864347F, 6.19787741F, 6.3463006F, 2.41259861F, 0.426108032F,
+    1.41855764F, 5.81369F, 2.02117443F, 6.54868555F, 7.27920961F,
+    0.115743004F, 8.59063339F };
+
+  static const float gemvX[40] = {
+    3.72341084F, 2.05988955F, 6.51314163F, 1.12252951F, 1.66227806F,
+    0.145220056F, 1.81331241F, 8.89186478F, 6.15927649F, 2.77416253F,
+    9.16781521F, 1.34423852F, 6.32391834F, 4.69256F, 6.8113575F, 0.666300595F,
+    2.64913654F, 8.20190048F, 8.10120487F, 2.47780204F, 9.77395058F,
+    5.73533964F, 3.69658399F, 5.35935F, 4.77251196F, 6.9843235F, 5.15898F,
+    9.29441929F, 5.50722837F, 2.04652429F, 2.56426382F, 8.05645275F,
+    2.16853786F, 3.84619331F, 1.39571071F, 0.577332199F, 5.79334F,
+    9.32007885F, 7.84432697F, 5.62121391F };
+
+  static const float gemvZ[40] = {
+    0.758510828F, 2.35631561F, 1.30502653F, 9.31223774F, 2.64225149F,
+    4.62035418F, 8.53274632F, 2.37871552F, 3.20525694F, 6.57087898F,
+    9.76775265F, 4.00537634F, 6.0920825F, 2.51103F, 3.18911743F, 4.56687593F,
+    5.60542965F, 2.32669449F, 5.53912735F, 8.9172287F, 5.34343386F,
+    3.77733779F, 5.65509796F, 8.94718742F, 8.96546F, 7.4111619F, 5.85733318F,
+    5.00474834F, 5.42933226F, 2.44653893F, 6.77971411F, 6.875144F, 3.9568727F,
+    4.06102037F, 7.89398336F, 9.27550125F, 9.85645866F, 3.10645771F,
+    2.69238782F, 1.88966703F };
+
+  static const float gemvBeta[4] = {
+    6.01999283F, 3.66133881F, 8.7223053F, 4.38774824F };
+
+  // mlDotp: x, y
+  static const float dotpX[400] = {
+    79.8909073F, 42.770153F, 37.3707581F, 86.5761261F, 36.3307457F,
+    58.1311111F, 21.5260906F, 74.1878357F, 85.407341F, 87.4643402F,
+    36.7720642F, 51.3365822F, 86.0471573F, 73.0734406F, 3.00337839F,
+    71.3564072F, 28.5184689F, 49.051033F, 80.6565323F, 95.0634766F,
+    4.85815382F, 12.6612043F, 3.32408166F, 93.9623108F, 30.2548828F,
+    25.1607666F, 20.6386776F, 85.5178833F, 96.2566299F, 96.483078F,
+    16.5808296F, 46.0287476F, 31.477232F, 82.0829468F, 76.4301605F, 76.45578F,
+    95.3278046F, 26.6075211F, 89.0537109F, 68.653717F, 13.1467609F, 58.5743F,
+    26.027401F, 20.4478302F, 26.5001545F, 45.509594F, 84.9637451F,
+    21.0066795F, 80.3692627F, 65.4361877F, 21.9340019F, 74.5703659F,
+    19.576643F, 8.96823883F, 2.86525559F, 81.6841202F, 42.3759232F,
+    66.6821594F, 50.6373405F, 26.7430096F, 10.8249731F, 22.9552708F,
+    33.6464615F, 70.0219727F, 6.65047884F, 44.330513F, 29.2295914F,
+    52.2248383F, 60.9073372F, 39.8711586F, 72.7837143F, 8.14774799F,
+    89.050354F, 74.923851F, 72.4592285F, 84.5162659F, 0.652195F, 26.1397114F,
+    42.365F, 58.5078697F, 71.9659F, 16.7082253F, 3.64289618F, 21.2201595F,
+    34.4965935F, 33.2536697F, 37.6869049F, 47.0485916F, 97.3561325F,
+    67.9392929F, 54.2027779F, 79.7240829F, 50.9949455F, 46.1667F, 72.0194168F,
+    79.962944F, 43.7122536F, 3.80286527F, 47.5935173F, 92.3882599F,
+    17.6686802F, 58.9308586F, 53.7754555F, 45.5250511F, 40.7248802F, 89.9909F,
+    2.30624413F, 31.9250202F, 37.8995781F, 25.7034779F, 72.4331589F,
+    45.0915146F, 36.2661896F, 4.40866232F, 53.5184097F, 95.9409485F,
+    91.9751816F, 98.9183044F, 59.1322823F, 57.5476837F, 54.0432777F,
+    64.9625626F, 80.7637939F, 1.93156922F, 21.4000988F, 67.0574722F,
+    94.4202271F, 62.1284523F, 74.4208F, 19.9119854F, 69.7681198F, 38.8599358F,
+    65.0809555F, 43.3430672F, 72.6865616F, 91.4300308F, 55.3415222F,
+    60.588089F, 3.18345523F, 83.2944641F, 7.83060932F, 68.1132889F,
+    26.0874348F, 13.3933954F, 4.04654789F, 6.55583811F, 27.8182621F,
+    49.9442406F, 18.1963367F, 22.6706505F, 72.7276688F, 27.6175117F,
+    82.7316208F, 43.2075615F, 29.9563675F, 69.246994F, 55.3798943F,
+    61.9056053F, 43.8625336F, 98.2482605F, 2.11767387F, 74.2889328F,
+    29.6332073F, 64.3483047F, 9.12910652F, 90.0976868F, 82.155304F,
+    10.2452946F, 73.084053F, 99.4416F, 53.2195549F, 74.806633F, 21.1869316F,
+    72.2430954F, 60.7919312F, 65.2267914F, 10.8272257F, 48.1520386F,
+    88.0878525F, 95.2254105F, 38.5528336F, 87.8191223F, 94.7608109F,
+    21.3401318F, 28.8353424F, 63.3119507F, 7.68615913F, 15.5757446F,
+    63.8250313F, 57.5533829F, 46.7063484F, 36.1738853F, 83.1345291F,
+    22.721035F, 87.5674591F, 18.791153F, 8.01122856F, 36.9004364F,
+    32.2833862F, 80.188652F, 19.1160812F, 26.6115456F, 98.5424728F,
+    29.0419388F, 8.42162514F, 64.9345169F, 52.6385422F, 34.1583061F,
+    35.6798172F, 4.48986816F, 48.1640892F, 74.35923F, 20.806469F, 83.8579254F,
+    54.6678047F, 42.4924049F, 39.4960518F, 13.1985626F, 80.1075058F,
+    49.0474091F, 86.216423F, 27.949379F, 28.0767021F, 78.8714676F,
+    2.23246193F, 20.8751202F, 73.110466F, 57.0637245F, 92.3691101F,
+    47.1171951F, 94.4011307F, 39.9574852F, 34.430748F, 7.07936382F,
+    85.8422546F, 10.9659195F, 40.1643448F, 82.1541367F, 56.3713837F,
+    66.2926712F, 58.9806175F, 25.3099461F, 61.9072952F, 26.7557812F,
+    25.4381447F, 31.4834709F, 11.4360704F, 78.0829773F, 32.8768806F,
+    49.5024681F, 39.719F, 73.1642F, 70.9428864F, 16.4224892F, 56.7064F,
+    45.4083862F, 5.06786919F, 28.2894611F, 89.086853F, 75.8604584F,
+    62.7495956F, 35.4356613F, 83.9615631F, 86.3167419F, 89.2571945F,
+    37.3490715F, 41.9019852F, 67.1237946F, 43.7569847F, 41.9630508F,
+    13.6435881F, 69.6412888F, 58.0666847F, 68.7831039F, 95.3805161F,
+    78.9546051F, 82.2352219F, 95.9601669F, 62.9794312F, 35.7719383F,
+    1.99965084F, 80.8023148F, 9.51388454F, 74.8143539F, 4.56834936F,
+    18.9668198F, 51.3195343F, 56.8069763F, 18.7810459F, 31.4976978F,
+    58.6061401F, 29.173378F, 80.4453888F, 95.9045105F, 53.6682281F,
+    20.7738495F, 27.884779F, 21.482481F, 50.9788628F, 39.5769081F,
+    94.8635635F, 61.1134644F, 61.12043F, 48.1017876F, 66.7041855F,
+    69.2172775F, 27.0378189F, 24.2358227F, 48.9019356F, 61.1947937F,
+    81.2341766F, 78.1505432F, 20.0619297F, 19.852829F, 39.523365F,
+    61.0666771F, 43.8278656F, 93.9011765F, 46.2468262F, 19.0360107F,
+    4.00059271F, 28.8780098F, 71.7255F, 61.9200478F, 88.257843F, 89.313324F,
+    0.670004606F, 35.4970589F, 1.67695212F, 86.2602463F, 7.65273094F,
+    54.4366951F, 7.90204763F, 20.8213654F, 55.2351646F, 83.4602737F,
+    89.2445068F, 10.8639956F, 71.3848724F, 99.7810059F, 67.8846893F,
+    50.783947F, 43.8522148F, 88.4760666F, 44.8978386F, 37.9134674F,
+    96.7935486F, 6.40804291F, 35.9275093F, 9.1124649F, 40.1618462F,
+    33.0604362F, 1.48161972F, 8.41872597F, 35.6345177F, 91.6911774F,
+    26.4733124F, 87.2930679F, 30.6008873F, 6.08370972F, 93.6233902F,
+    89.7554092F, 78.6719513F, 47.0157471F, 43.1284447F, 70.2321777F,
+    98.6818695F, 92.0987473F, 20.6835899F, 20.3334942F, 8.37097263F,
+    9.0257206F, 37.5058F, 18.8195457F, 34.7356377F, 61.8358116F, 91.9273682F,
+    24.0483761F, 64.234993F, 68.9506073F, 78.2034836F, 66.5949326F,
+    14.2499571F, 12.2837305F, 15.8462172F, 35.8283234F, 31.9537144F,
+    91.8392792F, 83.4804459F, 98.2046204F, 77.3019104F, 67.1437149F, 5.28447F,
+    47.7811203F, 49.4013443F, 12.8391333F, 50.5524864F, 94.4122238F,
+    21.6866951F, 50.5531883F };
+
+  static const float dotpY[400] = {
+    10.4797945F, 21.4428463F, 34.9927597F, 4.48862F, 68.3616333F, 90.60392F,
+    76.5976181F, 72.9932175F, 71.1281509F, 17.3357391F, 57.3137817F,
+    69.519989F, 99.1919632F, 55.0130501F, 4.25152922F, 20.9346657F,
+    37.2589035F, 87.5370941F, 91.4440079F, 77.7355194F, 97.1593933F,
+    46.8521614F, 1.00149167F, 96.1604462F, 82.4172897F, 77.557F, 90.3241425F,
+    54.8188629F, 52.8111801F, 89.3791656F, 50.5551796F, 42.2380257F,
+    40.5029793F, 1.67812419F, 48.8038673F, 69.345047F, 13.8626184F,
+    22.6698914F, 97.452713F, 71.9534912F, 14.6181631F, 31.8499489F,
+    15.9577246F, 9.58875275F, 14.9227571F, 45.0245323F, 13.3350754F,
+    4.22489452F, 3.19060087F, 64.8169632F, 39.8030396F, 73.5526657F,
+    45.4880104F, 74.4299545F, 90.9747F, 63.9740944F, 63.8820534F, 44.3385315F,
+    69.4114151F, 12.6230726F, 3.94325709F, 77.1813507F, 51.3681641F,
+    80.1557541F, 66.6605225F, 37.6462669F, 83.4632645F, 44.8592644F,
+    61.9045296F, 15.5725403F, 59.4005966F, 3.34734368F, 91.3054F, 74.425148F,
+    81.912262F, 92.8159256F, 88.5696945F, 28.8597374F, 74.9369659F, 55.6794F,
+    21.0497265F, 16.8834763F, 98.8988953F, 86.4233475F, 71.0768585F,
+    19.5838985F, 36.3974533F, 36.0491714F, 97.5162888F, 23.9760799F,
+    85.8617783F, 48.5235786F, 11.6023073F, 95.843132F, 4.64661407F,
+    19.4300671F, 44.3167381F, 5.26092815F, 80.2540359F, 21.9098892F,
+    4.86771154F, 63.2003899F, 38.9698296F, 66.3448715F, 73.1353531F,
+    19.719698F, 34.5689278F, 40.001976F, 55.9489365F, 41.469429F, 48.0479927F,
+    23.1164322F, 51.4186134F, 61.3380356F, 59.2878265F, 42.1601601F,
+    1.2039125F, 63.2324562F, 76.920372F, 81.4870224F, 72.0760727F,
+    90.2679672F, 27.2428322F, 88.5470123F, 16.9151936F, 80.7213745F,
+    80.4802475F, 30.6918354F, 63.4711342F, 90.1784515F, 89.5688553F,
+    98.276741F, 85.103241F, 26.8828316F, 36.3612671F, 52.8875237F,
+    41.1141701F, 81.8041611F, 55.7440147F, 23.8634491F, 10.9064922F,
+    50.6961517F, 10.2906694F, 24.8903427F, 63.1228447F, 76.1898575F,
+    51.1606789F, 64.4145813F, 63.5908852F, 90.158371F, 8.42251301F,
+    11.7062922F, 63.280098F, 20.7354126F, 95.8753586F, 81.7719F, 25.9047604F,
+    74.5343933F, 80.956459F, 74.5343704F, 49.7473755F, 99.5705795F,
+    1.50430477F, 1.0683006F, 24.2634201F, 17.727396F, 6.99008F, 94.5474701F,
+    74.4183197F, 76.7375717F, 30.5424175F, 40.841198F, 46.8883F, 36.0368767F,
+    58.3756065F, 46.4538765F, 31.1084194F, 89.9641342F, 2.4611187F,
+    36.1071663F, 45.0636253F, 86.5955124F, 79.8311081F, 48.5275192F,
+    89.8169098F, 62.4748154F, 43.0556335F, 35.5112686F, 29.4042568F,
+    5.76643133F, 28.9492245F, 91.7149887F, 77.8894424F, 11.383316F,
+    36.6441917F, 70.7772751F, 21.157196F, 59.6544075F, 56.0684624F,
+    50.3628159F, 39.2795219F, 4.62581968F, 57.4432831F, 53.5718117F,
+    73.1208725F, 90.4186249F, 78.7109222F, 9.69924259F, 84.3485413F,
+    19.4323788F, 53.7297F, 64.1333237F, 88.9440155F, 83.9347763F, 93.425827F,
+    64.7929382F, 50.4463882F, 51.5433693F, 84.1764145F, 64.9124069F,
+    44.1327667F, 30.9222431F, 47.6325188F, 2.08004069F, 9.45461273F,
+    98.6888351F, 59.8644409F, 61.3189583F, 69.6885071F, 71.554924F,
+    7.57580233F, 0.149923265F, 26.3931F, 16.0078621F, 8.27295113F, 63.028347F,
+    38.7778702F, 66.1891327F, 15.7253313F, 39.5959549F, 75.251358F,
+    47.0433922F, 70.0023117F, 93.4319534F, 79.0952225F, 42.7127876F,
+    17.2781162F, 64.1713562F, 21.9616146F, 50.9413033F, 65.3045197F,
+    44.6929932F, 52.2010078F, 59.4291801F, 94.6725616F, 40.6119194F,
+    1.68274391F, 54.8624039F, 34.0559654F, 71.5954666F, 42.7070808F,
+    7.76367712F, 32.4318466F, 83.6709595F, 98.3154144F, 29.7649498F,
+    17.0019016F, 70.6627121F, 56.0998573F, 35.1129532F, 85.9942627F,
+    1.083251F, 78.5767441F, 87.0722427F, 0.224369735F, 48.7579803F,
+    36.1720314F, 5.84084845F, 15.0025301F, 50.6292648F, 45.1829872F,
+    24.284338F, 13.7164F, 1.46490705F, 21.665617F, 88.6411057F, 32.5631409F,
+    55.5788193F, 45.1800079F, 85.2784195F, 42.170681F, 59.5754509F,
+    79.5285339F, 78.8007507F, 83.4320374F, 49.3011703F, 20.8897018F,
+    59.706295F, 67.3278046F, 28.3800831F, 94.2425156F, 80.9229736F,
+    4.12231684F, 56.6837082F, 0.670556068F, 71.629837F, 15.4572449F,
+    79.8435287F, 84.6728287F, 13.8016615F, 35.9647751F, 34.3534317F,
+    91.247963F, 93.6513214F, 6.16246319F, 9.76277542F, 8.53743362F,
+    62.4129028F, 71.6358337F, 5.43115854F, 94.4407F, 79.0584183F, 65.0573196F,
+    22.348299F, 58.5857735F, 81.2369537F, 55.0923576F, 84.584137F,
+    42.2387085F, 89.5718384F, 11.1286774F, 32.7562485F, 18.489399F,
+    46.9108925F, 85.6685181F, 73.3561401F, 61.3893242F, 14.4354219F,
+    49.6790543F, 0.813811839F, 76.076767F, 99.5085831F, 75.611557F,
+    54.6094093F, 84.991684F, 40.8285294F, 33.0893402F, 79.1704F, 49.5233192F,
+    12.987957F, 80.5707855F, 88.057869F, 60.492794F, 40.5633316F, 23.1110859F,
+    35.6966362F, 92.7494888F, 65.1788F, 32.7010536F, 84.9069595F, 21.5657463F,
+    22.5313206F, 35.9678917F, 27.2272205F, 26.8303146F, 10.9348497F,
+    68.0769882F, 17.7919827F, 56.2273407F, 59.08535F, 78.6359787F,
+    65.2571869F, 53.1470261F, 12.5945206F, 83.1829681F, 40.1703911F,
+    7.50963783F, 2.77413177F, 57.4499817F, 59.4368591F, 93.5397797F,
+    26.0786858F, 93.633194F, 10.6351156F, 20.1271114F, 63.8240318F,
+    14.850646F, 81.2141953F, 67.6006775F, 94.1587753F, 70.8025055F,
+    4.89266539F, 88.1162186F, 90.9852676F, 12.5988655F, 63.9574432F,
+    52.5050354F, 79.3574905F, 60.9531097F, 27.9867287F };
+
+  // mlAxpy: y, x, a
+  static const float axpyY[400] = {
+    15.0337238F, 47.6492348F, 32.1463203F, 36.719532F, 27.9067287F,
+    15.1456299F, 15.6785078F, 16.4370308F, 1.62118244F, 51.1055603F,
+    7.57770967F, 30.5438633F, 74.7655182F, 66.3858948F, 43.1216087F,
+    0.182829559F, 15.1056366F, 91.365593F, 30.7762737F, 45.3304F, 84.2023163F,
+    14.6472158F, 81.8232422F, 87.0193863F, 51.2713852F, 54.0399F, 5.89708185F,
+    40.882164F, 74.4691162F, 66.1355133F, 86.442131F, 6.99611807F,
+    82.8370895F, 74.1432F, 43.8764572F, 33.7652855F, 87.0179138F, 36.4060059F,
+    41.0990791F, 46.7791862F, 81.6365204F, 65.0692368F, 95.0078506F,
+    65.8608093F, 52.7551193F, 72.5657349F, 55.6344833F, 52.8448715F,
+    48.0980759F, 51.4331779F, 75.3225861F, 89.844017F, 19.1099281F,
+    57.703846F, 54.0918503F, 64.8631287F, 8.75913906F, 80.7338181F,
+    52.1174965F, 78.5742874F, 26.7444973F, 77.3107F, 68.9984055F, 3.91880488F,
+    47.2511597F, 25.9368057F, 32.7052F, 58.1403084F, 73.9813919F, 91.8186951F,
+    64.5060272F, 73.6262817F, 43.6885376F, 2.15982056F, 65.5854187F,
+    59.0946655F, 25.6324749F, 58.8630219F, 28.8666382F, 82.1373749F,
+    75.6578064F, 75.2520599F, 67.0747757F, 3.13552666F, 87.8290482F,
+    21.3591957F, 37.1818771F, 81.6265717F, 38.6720085F, 5.19741964F,
+    10.8005295F, 4.60907269F, 13.2607117F, 28.8623199F, 1.90354335F,
+    21.2803211F, 21.3118782F, 98.896286F, 28.0981941F, 3.71524096F,
+    53.8106346F, 66.3496094F, 44.9309044F, 56.8349571F, 74.3985062F,
+    41.4033165F, 49.0077209F, 33.1853027F, 79.9907303F, 64.609108F,
+    74.6959763F, 67.3073959F, 50.5020103F, 2.13671374F, 53.2153168F,
+    86.5194931F, 26.7075672F, 87.6855698F, 25.8804092F, 27.100523F,
+    41.3029938F, 71.4251556F, 9.58354092F, 12.2217665F, 49.3763275F,
+    86.3360138F, 89.2437286F, 6.56881809F, 20.8557587F, 80.7405853F,
+    67.8948593F, 32.5302277F, 98.8895416F, 17.5671673F, 0.946677148F,
+    75.6345749F, 91.4368362F, 57.0642967F, 33.8062286F, 89.496933F,
+    94.6526337F, 99.2270432F, 48.6580658F, 25.5661297F, 36.9683647F,
+    79.8953705F, 94.6857376F, 87.2550507F, 14.8939734F, 44.4396858F,
+    40.6023788F, 96.9144F, 15.8402901F, 11.0954647F, 68.0687637F, 60.3708496F,
+    64.1570129F, 28.5142288F, 24.3771935F, 52.3078651F, 30.5549889F,
+    26.4708271F, 1.69496095F, 27.0630894F, 97.993042F, 98.6250763F,
+    1.41319358F, 67.5790405F, 36.1878853F, 0.322476655F, 39.3738289F,
+    49.1926613F, 87.071167F, 74.5754547F, 68.6314392F, 38.690239F,
+    62.0016975F, 53.6217918F, 39.4184456F, 16.1171341F, 5.29939556F,
+    12.8136969F, 99.44841F, 87.7742462F, 90.4008102F, 26.8820515F,
+    51.0897369F, 51.8831329F, 87.8809509F, 18.1966114F, 86.6907425F, 79.7487F,
+    90.7982712F, 77.1698074F, 91.6136551F, 79.2231F, 14.7371521F, 22.3919792F,
+    79.9798F, 77.4158783F, 92.3568192F, 22.2665195F, 66.8992767F, 3.23332596F,
+    41.2595863F, 35.0673523F, 9.96339512F, 59.6277695F, 37.1644325F,
+    40.6956253F, 42.3831749F, 94.3820114F, 81.896965F, 32.6832619F,
+    9.91227436F, 16.8782F, 61.7439346F, 83.4131546F, 78.0775452F, 37.4708214F,
+    16.5123501F, 87.9859543F, 7.43516588F, 3.07324052F, 53.9771652F,
+    70.3174591F, 55.4067841F, 18.7667694F, 74.4634323F, 19.2925434F,
+    39.6188889F, 90.7393875F, 80.8721924F, 47.6122437F, 15.5631313F,
+    35.970253F, 82.7281494F, 94.1961746F, 68.7576599F, 98.0293503F,
+    76.7451553F, 68.4051895F, 33.8732452F, 32.134903F, 47.3710938F,
+    52.8356743F, 77.1630325F, 8.02466202F, 23.0132351F, 65.8486F, 6.06878138F,
+    70.6569595F, 82.2506638F, 96.893074F, 49.2096405F, 90.7360687F,
+    22.2969513F, 8.16068745F, 66.8912048F, 17.6866646F, 88.7919693F,
+    21.2462063F, 75.1277313F, 39.0340691F, 87.2589F, 89.6931152F, 94.5871735F,
+    74.978981F, 95.0435181F, 54.9012566F, 11.4927053F, 11.0236292F,
+    37.5475044F, 29.6749611F, 6.02034473F, 31.7340889F, 81.1470261F,
+    0.532971F, 22.3371601F, 53.2266693F, 95.6693954F, 23.9452019F,
+    81.9586487F, 99.8064346F, 59.6750793F, 77.9726486F, 57.9006767F,
+    11.5466957F, 62.943428F, 33.8798599F, 28.667572F, 52.2365036F,
+    42.2732086F, 37.307682F, 6.55620337F, 5.40286207F, 23.0679245F,
+    21.6365376F, 11.849659F, 65.7456436F, 81.925766F, 10.4592848F, 90.6028F,
+    11.2817059F, 1.08777857F, 73.6531448F, 4.17549181F, 12.2378922F,
+    14.4597034F, 80.3186417F, 1.98167598F, 31.1218948F, 21.8694267F,
+    94.6650848F, 42.6654434F, 39.9773865F, 25.0981731F, 96.3102F, 87.3237F,
+    13.7914648F, 80.3096237F, 99.6120682F, 8.13177F, 59.5181236F, 16.5624218F,
+    93.7439041F, 17.8204479F, 22.0125141F, 81.9786606F, 69.1680222F,
+    25.4892521F, 4.90299702F, 58.2213287F, 63.0562439F, 75.0185471F,
+    6.63523531F, 57.7213058F, 89.7700806F, 81.3141632F, 99.7174F, 19.9691753F,
+    71.4701233F, 78.2137604F, 44.3097496F, 66.2436752F, 48.0206F, 35.0119438F,
+    6.99646711F, 18.7865429F, 56.857872F, 3.37520885F, 89.278923F,
+    49.8361053F, 50.2846413F, 34.9995117F, 50.6868973F, 47.3631248F,
+    19.8063469F, 94.6781235F, 19.4365158F, 66.4246063F, 94.5638962F,
+    34.4265137F, 38.994133F, 1.41760337F, 97.7640686F, 83.6702118F,
+    10.5756807F, 95.3704758F, 0.348908365F, 63.3066521F, 67.5458908F,
+    9.39907074F, 42.2243309F, 34.4417648F, 81.4215317F, 10.1183786F,
+    55.2093773F, 42.4176483F, 82.1603088F, 80.0776138F, 86.7889862F,
+    24.3788719F, 74.5068893F, 8.86308289F, 78.3887939F, 23.9180908F,
+    76.5154114F, 63.5355034F, 60.1694794F, 29.2272701F, 85.2518921F,
+    5.29464865F, 63.530159F, 63.9597397F, 38.2193871F, 22.4613323F,
+    3.75050068F, 18.1357632F, 74.9887085F };
+
+  static const float axpyX[400] = {
+    87.825325F, 3.47576427F, 87.928772F, 95.0295563F, 16.5634785F,
+    22.8386974F, 33.6366196F, 88.5114F, 28.4118385F, 36.8428192F, 9.87349606F,
+    54.9044952F, 41.0594673F, 58.4516411F, 21.3720226F, 53.6629105F,
+    46.688076F, 96.041275F, 62.3385925F, 18.4934025F, 40.622921F, 99.4190445F,
+    97.0196381F, 21.5635548F, 62.4900589F, 66.0594482F, 63.7608185F,
+    89.9893799F, 22.9542046F, 88.2405319F, 39.58498F, 58.8711319F,
+    24.5182896F, 37.6823F, 23.1945457F, 39.2425613F, 96.5938F, 74.9767685F,
+    72.956604F, 22.163147F, 73.3745422F, 56.1790962F, 64.7114258F,
+    63.7664909F, 93.7314224F, 49.1730728F, 55.3195305F, 13.4098148F, 53.9723F,
+    29.0959206F, 77.9995346F, 39.5978088F, 9.58128F, 23.589056F, 33.3461189F,
+    60.5131721F, 99.0484924F, 69.3621826F, 50.6406059F, 10.9103317F,
+    97.2274475F, 25.1775589F, 74.4303818F, 68.6796646F, 96.5567856F,
+    94.4155884F, 82.4331284F, 13.7050209F, 99.6751328F, 45.4158745F,
+    30.4072742F, 88.2303F, 77.6259079F, 90.7282639F, 40.2871399F, 96.6584473F,
+    99.3203506F, 88.5299301F, 88.483757F, 16.2790947F, 99.5002213F,
+    84.8730164F, 77.1589661F, 3.18955779F, 29.8608837F, 30.8454609F,
+    21.302124F, 51.5677528F, 74.9636765F, 27.2361908F, 67.1887436F,
+    0.375581682F, 42.4164886F, 77.5761108F, 95.1774F, 50.7547569F, 99.671814F,
+    21.1048851F, 32.7514267F, 76.6614532F, 8.95646763F, 52.0371399F,
+    92.3149719F, 83.3476334F, 84.3693542F, 98.2441635F, 18.2575226F,
+    22.4473476F, 33.8654518F, 69.2995834F, 44.5192451F, 52.9905F, 11.4066248F,
+    15.9707355F, 76.6303635F, 30.0862465F, 47.0716591F, 58.1601715F,
+    31.9911499F, 73.7120361F, 23.5624352F, 27.538559F, 31.0425549F,
+    91.0482635F, 58.8268852F, 12.1800098F, 61.5287361F, 17.9430599F,
+    12.7522068F, 12.9925976F, 91.4912338F, 37.7040253F, 60.8733749F,
+    14.8763294F, 79.1186905F, 30.8576622F, 1.31583643F, 21.3467522F,
+    73.8685684F, 84.7277069F, 12.7970486F, 40.5737762F, 19.2064362F,
+    73.9326782F, 80.8335114F, 94.4546F, 79.824791F, 81.2521057F, 18.0356026F,
+    16.013628F, 11.1519451F, 73.4929657F, 20.4120903F, 34.2669182F,
+    12.580081F, 66.9520493F, 84.5809479F, 93.5709457F, 31.8901844F, 74.4249F,
+    79.4434F, 8.22010136F, 15.6643391F, 88.9524307F, 90.0714264F, 98.0023117F,
+    32.8003616F, 69.1515503F, 4.3189764F, 77.0260162F, 64.5218201F,
+    5.0747962F, 32.6566277F, 55.7268867F, 96.2995758F, 64.2486877F,
+    20.1759796F, 14.32969F, 12.7674685F, 1.86489606F, 59.2104149F,
+    82.1644745F, 57.413063F, 46.6207504F, 36.7692719F, 24.3484917F,
+    28.566864F, 28.505743F, 5.0962038F, 74.9750748F, 79.3678131F, 70.382225F,
+    74.2682419F, 68.2450714F, 36.3070259F, 91.3465195F, 17.0747414F,
+    40.226181F, 87.845253F, 34.6302376F, 16.567749F, 84.5536118F, 24.3023205F,
+    38.2000046F, 98.7658234F, 86.2312088F, 26.3582153F, 76.8422699F,
+    46.4834862F, 47.7637482F, 55.7896194F, 54.5952F, 16.511158F, 84.8538284F,
+    92.5121155F, 77.2262955F, 1.46880615F, 78.4298935F, 33.1239624F, 37.3424F,
+    5.35582447F, 43.2004166F, 45.7875023F, 24.4751263F, 90.6218719F,
+    38.5656624F, 11.1893702F, 79.1594849F, 14.6631136F, 42.5172501F,
+    59.2903252F, 0.497886509F, 56.343502F, 30.0483952F, 35.4329376F,
+    41.021019F, 61.4652863F, 39.1375656F, 18.0526104F, 87.6770706F,
+    17.6014538F, 19.9684238F, 46.8751068F, 3.45960855F, 69.606308F,
+    19.5649281F, 24.3973866F, 70.2715912F, 39.7033882F, 27.6035423F,
+    81.104454F, 61.0279121F, 60.1438637F, 38.1090698F, 15.3843241F,
+    16.0713196F, 25.1823502F, 54.540741F, 63.0057487F, 9.94394779F,
+    52.0657463F, 56.2042274F, 91.8685379F, 17.7284641F, 35.9604759F,
+    56.9257507F, 33.7976341F, 62.8519592F, 54.8415756F, 43.412693F,
+    98.781517F, 34.601F, 55.8982048F, 97.0059509F, 12.4400234F, 72.0404F,
+    45.9941254F, 32.7924194F, 67.517395F, 51.9012146F, 16.5235138F,
+    89.4719849F, 74.4719467F, 19.4351883F, 86.3639F, 56.5730553F, 45.5659752F,
+    31.1726265F, 70.8896942F, 37.6876373F, 56.1654091F, 10.9529858F,
+    88.7639389F, 82.8144836F, 99.0788345F, 41.6797409F, 15.4245424F,
+    81.7542496F, 15.4643497F, 11.1925077F, 33.6409569F, 65.802F, 1.3730092F,
+    45.1816025F, 20.9697018F, 6.10119677F, 73.342659F, 25.8362484F,
+    26.7904797F, 40.1877251F, 26.8467751F, 48.0785F, 79.2010498F,
+    0.453753144F, 42.1281281F, 76.7869949F, 56.4001808F, 55.9775467F,
+    9.97231483F, 85.2548218F, 74.9961395F, 19.2333889F, 54.1588821F,
+    34.4350395F, 1.88401878F, 70.7673721F, 97.8156052F, 43.1243935F,
+    45.230381F, 55.5021362F, 64.7588654F, 27.6687908F, 75.5020294F,
+    56.0641785F, 66.4983673F, 25.1812763F, 56.0612717F, 20.4273567F,
+    14.8769817F, 5.17969F, 33.1938934F, 0.997090161F, 45.4932594F,
+    31.3083839F, 91.8452F, 36.4349747F, 66.7153702F, 23.1038666F, 13.8272152F,
+    55.1626511F, 34.6112785F, 67.1100159F, 59.2982941F, 68.4904251F,
+    43.137722F, 13.2671499F, 17.3535938F, 66.997612F, 41.1896248F, 96.735878F,
+    67.1528778F, 2.96778679F, 8.91999912F, 27.9814816F, 96.6628571F,
+    64.1652527F, 39.1092224F, 88.0085F, 16.4642601F, 50.4965286F, 9.37268925F,
+    63.7856522F, 3.36577201F, 53.5212631F, 32.2904968F, 56.7991257F, 86.607F,
+    83.3417511F, 51.8215332F, 41.7747345F, 49.7802162F, 48.5091591F,
+    19.2404728F, 42.6991882F, 90.6176F, 52.1811256F, 21.7395115F, 94.4438171F,
+    52.0721359F, 58.9036331F, 58.3256493F, 27.4140968F, 38.5893974F,
+    55.2834053F, 10.1396942F, 85.4398499F, 28.5925388F, 20.5920181F,
+    46.6780586F, 86.7842865F };
+
+  static const float axpyA[4] = {
+    29.0024052F, 16.8149376F, 42.0270653F, 86.9266739F };
+
+  // mlDist: 3D points
+  static const float distP[1200] = {
+    94.430336F, 47.4179039F, 7.76787376F, 33.8475647F, 62.7342224F,
+    96.6340714F, 67.2861328F, 30.3696175F, 40.0897102F, 36.9409943F,
+    61.7380714F, 94.3065491F, 60.2187042F, 31.6917515F, 87.2750778F,
+    67.8570557F, 96.8142624F, 33.1510391F, 79.384819F, 79.3637466F, 73.8073F,
+    49.3659248F, 51.2116318F, 22.8868904F, 73.4920578F, 70.57267F,
+    61.3598938F, 47.5032883F, 39.4533577F, 16.7725391F, 92.0682602F,
+    56.3749809F, 53.6219788F, 87.8346558F, 64.3056335F, 98.8335266F,
+    45.0544052F, 71.21521F, 34.3078537F, 45.6649704F, 15.447957F, 12.6158552F,
+    53.5045F, 8.50775242F, 22.7475643F, 94.7409821F, 27.765625F, 1.21100283F,
+    28.4930553F, 17.9885864F, 31.6876888F, 79.9492111F, 17.1151657F,
+    41.5483055F, 5.88832426F, 17.6349125F, 88.6347961F, 99.3754349F,
+    5.79202127F, 93.1865768F, 88.642334F, 66.4412689F, 92.8839493F,
+    86.1743622F, 79.1097107F, 37.7364197F, 28.1150913F, 15.1504507F, 67.9015F,
+    0.611498535F, 15.5168171F, 82.2401428F, 79.9063797F, 26.2475224F,
+    71.3286133F, 94.2452164F, 85.6527786F, 87.5999222F, 31.6278381F,
+    83.9840469F, 88.1552429F, 67.4112396F, 5.51392508F, 46.1094933F,
+    89.7445145F, 7.55144882F, 50.1146889F, 13.3778486F, 44.0954399F,
+    35.2483521F, 48.0098305F, 78.7969666F, 54.7011719F, 1.73639143F,
+    65.7079315F, 2.16680384F, 57.4255562F, 63.5888214F, 39.7641029F,
+    32.9030571F, 44.7273674F, 73.2210922F, 67.8491058F, 38.4403076F,
+    72.9405136F, 15.9668093F, 32.7937927F, 44.1155624F, 34.0686531F,
+    20.554285F, 96.7678909F, 47.6767807F, 91.796F, 45.7314339F, 85.977005F,
+    4.41060686F, 45.2022247F, 8.77247906F, 74.2673569F, 69.2598419F,
+    79.0766373F, 40.3062668F, 18.7851028F, 48.9161072F, 16.1607742F,
+    38.6534042F, 52.6797142F, 49.1730766F, 65.5829315F, 49.288063F,
+    30.2422447F, 53.7539368F, 8.99815083F, 38.4485F, 34.5472107F, 79.7556763F,
+    61.8758545F, 71.9244308F, 74.5107117F, 37.8824844F, 20.2933331F,
+    75.3143463F, 8.7605629F, 25.388052F, 98.5032425F, 74.4373932F,
+    13.4119081F, 2.8650713F, 23.3404217F, 16.629776F, 41.1787529F, 21.5845F,
+    47.9614639F, 88.0978622F, 66.5839081F, 41.7210884F, 99.5320511F,
+    14.0860119F, 47.0190468F, 18.2860298F, 81.7617569F, 28.4473801F,
+    55.1602859F, 33.5959854F, 87.5474243F, 18.4027805F, 8.13550758F,
+    43.6528702F, 64.075F, 32.2589722F, 27.5168056F, 52.9606895F, 49.1097946F,
+    56.9240379F, 89.1528549F, 91.2416077F, 85.0616837F, 67.9677124F,
+    10.7255468F, 49.1982918F, 1.50411403F, 33.0193863F, 27.5969963F,
+    98.275856F, 97.2017288F, 84.448349F, 42.3999634F, 81.4770508F,
+    73.5826569F, 99.4807129F, 76.1098557F, 49.2323303F, 67.8372269F,
+    28.6377144F, 79.4873657F, 21.8128548F, 27.3373833F, 4.12752485F,
+    82.2447891F, 44.0753517F, 30.2114391F, 29.3620682F, 12.7264557F,
+    27.2670612F, 15.1572704F, 4.88982677F, 70.5793F, 33.9313393F, 32.2524414F,
+    1.65609217F, 61.7301559F, 80.8164749F, 2.4385891F, 19.6386833F,
+    38.8934898F, 57.6585503F, 89.8173F, 84.3647079F, 14.7902403F, 13.6163015F,
+    45.9718933F, 20.8782F, 44.384552F, 31.3938351F, 44.9556694F, 21.3781128F,
+    94.1435394F, 17.4706306F, 20.7451439F, 47.6716728F, 63.5000763F,
+    45.7219963F, 90.6468506F, 84.6516495F, 7.30462265F, 81.1550674F,
+    57.7790184F, 87.5317383F, 99.6625519F, 84.291069F, 17.0920696F,
+    52.0977173F, 92.004715F, 75.3398361F, 26.7365818F, 72.1569901F,
+    23.055027F, 48.7369232F, 45.6153259F, 82.1549606F, 17.6589012F,
+    69.729393F, 89.1545868F, 64.8133087F, 69.8256F, 43.6392136F, 12.8848257F,
+    96.8449249F, 87.6663666F, 17.9756565F, 41.6926155F, 59.0745621F,
+    53.1233177F, 47.2604942F, 84.1191254F, 95.8737183F, 76.693924F,
+    7.14148378F, 99.1439F, 13.1499052F, 12.3385611F, 95.6126099F, 36.0470924F,
+    34.9038162F, 27.4111614F, 63.1281815F, 0.31436193F, 3.52427626F,
+    37.6916618F, 18.5384789F, 29.2835407F, 89.3293686F, 65.2714539F,
+    28.8020649F, 45.2587395F, 46.0150299F, 34.5801582F, 81.022377F,
+    16.2657394F, 55.6987953F, 80.5864182F, 73.291275F, 12.3399267F,
+    84.466507F, 22.1684F, 98.6068802F, 43.9013138F, 23.1593571F, 90.2931595F,
+    50.8665161F, 16.8257561F, 61.6989784F, 69.7547302F, 11.0053358F,
+    20.6595135F, 39.466259F, 17.7978306F, 70.6787415F, 48.4643135F, 86.8653F,
+    69.0900803F, 67.5142822F, 44.9369736F, 9.9773531F, 43.1477F, 35.4691849F,
+    89.2260132F, 10.288414F, 49.2025909F, 57.5719872F, 0.0810912475F,
+    98.7358475F, 68.2675171F, 65.6726074F, 36.9497528F, 7.58769083F,
+    19.005579F, 97.7056046F, 61.3398552F, 33.9073029F, 50.2729378F,
+    74.9547577F, 86.9469452F, 31.9083595F, 98.1731262F, 73.9221725F,
+    29.9327583F, 89.985939F, 70.6178665F, 12.9447813F, 11.8285742F,
+    38.3131523F, 54.9121323F, 73.7438126F, 72.4329529F, 31.3519154F,
+    58.737236F, 34.154068F, 72.6357F, 53.7691536F, 73.7061615F, 95.9609451F,
+    88.9780121F, 56.6368599F, 42.5067787F, 59.4390717F, 68.0684128F,
+    77.9376755F, 59.5441475F, 28.1441822F, 94.0471878F, 90.636322F,
+    8.11064911F, 36.4494438F, 90.7319717F, 29.7440414F, 21.7101021F,
+    67.269928F, 11.1491423F, 88.081459F, 48.9587975F, 51.4892883F,
+    25.9252987F, 2.13883758F, 99.9913254F, 54.4388275F, 98.9162674F,
+    71.6829758F, 68.5948639F, 5.52080965F, 20.1708336F, 26.171524F,
+    93.8304596F, 52.5039635F, 74.4967651F, 78.0107422F, 72.2595367F,
+    68.1370316F, 91.4301376F, 75.6912842F, 6.75604725F, 42.9194183F,
+    71.9754181F, 18.5555935F, 80.7411728F, 72.1318207F, 49.3205185F,
+    0.912341714F, 75.4530411F, 84.7620773F, 74.6583633F, 77.8907242F,
+    54.9923668F, 93.2772827F, 10.3365097F, 97.9058685F, 71.5369F, 56.5521088F,
+    39.8662682F, 8.54824734F, 82.9211807F, 19.4122276F, 96.1026917F, 45.6374F,
+    42.7316284F, 40.3551559F, 35.8907776F, 52.7054176F, 96.5906601F,
+    1.50384355F, 6.89324713F, 69.5521317F, 78.4716415F, 2.21189737F,
+    92.614357F, 32.2382317F, 50.8310318F, 20.5477505F, 88.2857513F,
+    31.374218F, 63.7664566F, 57.333252F, 25.771059F, 67.9705F, 41.0536652F,
+    84.5802078F, 47.0564F, 0.532254457F, 85.1203461F, 44.9190483F,
+    89.7416229F, 32.579483F, 6.15535069F, 42.2187042F, 43.8148918F,
+    6.34453964F, 51.0642891F, 99.6728058F, 14.1096878F, 59.8811722F,
+    38.5318375F, 98.7878F, 83.9975F, 52.6814384F, 87.7405396F, 49.1243172F,
+    44.4828796F, 42.9849892F, 72.284F, 41.2035065F, 77.0257721F, 94.5589F,
+    3.80709052F, 65.2975311F, 25.8143864F, 29.5414124F, 67.3642426F,
+    65.9015961F, 42.492527F, 36.8079758F, 27.3647804F, 26.2111874F,
+    81.918869F, 42.0464516F, 18.9166985F, 18.96595F, 92.6532593F, 18.3447247F,
+    76.2970428F, 97.7155075F, 65.1299133F, 91.9093628F, 16.8507195F,
+    3.39685559F, 40.090004F, 63.344574F, 74.4995651F, 20.4414082F,
+    59.3770828F, 87.5821F, 59.9150658F, 93.5467911F, 19.819273F, 1.30890906F,
+    3.40179634F, 21.7779274F, 46.4823F, 1.30970514F, 35.2361641F, 47.2941551F,
+    86.6378479F, 79.5380859F, 23.9444141F, 33.4860344F, 87.4832611F,
+    78.1144333F, 89.4814F, 57.7524109F, 76.7201F, 45.4051552F, 39.1535416F,
+    84.8572845F, 4.06499577F, 33.1250877F, 13.6851702F, 47.0847969F,
+    37.3140144F, 58.6966896F, 55.492939F, 68.4181747F, 39.0545959F,
+    30.0604706F, 57.134716F, 71.0572739F, 98.2177429F, 46.31073F, 5.20857859F,
+    95.1139221F, 9.54238415F, 64.3608932F, 22.4742584F, 49.2176247F,
+    60.8218117F, 3.11405849F, 55.3831787F, 90.2377F, 39.4915848F, 36.3612099F,
+    84.1731949F, 55.5510712F, 1.35872555F, 45.9961166F, 85.4621506F,
+    63.4872932F, 59.9658508F, 64.7795105F, 66.9101486F, 94.6500778F,
+    41.0606918F, 33.4381638F, 55.5352364F, 81.4863434F, 44.2317162F,
+    9.34812546F, 70.660881F, 0.834877849F, 70.8212204F, 4.25625229F,
+    53.2990227F, 45.2753334F, 75.6519852F, 61.9009438F, 35.2882843F,
+    95.7151184F, 66.2685852F, 38.8456306F, 17.5449543F, 93.0645828F,
+    36.9984474F, 48.504528F, 64.0952911F, 0.132604048F, 96.5324936F,
+    98.9877777F, 18.9683475F, 43.671524F, 60.0685158F, 70.1917114F,
+    50.5382118F, 53.1188965F, 12.4668684F, 6.59052086F, 69.7486954F,
+    85.693573F, 10.1803713F, 33.6561508F, 69.3088074F, 96.4588776F,
+    8.99280643F, 73.5597382F, 94.3906F, 74.1850204F, 31.5619049F, 77.3945618F,
+    40.4735947F, 98.2444229F, 72.3831406F, 75.4945145F, 55.3584518F,
+    15.3177214F, 88.7028198F, 86.1450806F, 63.859684F, 15.0414305F,
+    94.6254272F, 38.2558212F, 89.4970856F, 76.7678375F, 11.9725018F, 54.2302F,
+    7.7609849F, 1.55294383F, 44.3726578F, 13.7032766F, 94.434967F,
+    50.1465912F, 75.1102753F, 36.22089F, 58.8738174F, 84.2012405F,
+    20.0653954F, 90.1402893F, 97.8246918F, 6.83675337F, 50.1085548F,
+    29.8152332F, 20.7066021F, 21.0095062F, 50.8170052F, 83.266716F,
+    73.2638931F, 76.7869F, 1.97916603F, 71.2024841F, 22.8178158F, 34.8490181F,
+    57.0372086F, 22.8853722F, 14.2269306F, 99.2764664F, 89.8917694F,
+    54.5048294F, 86.1277313F, 83.2673187F, 19.2336292F, 10.9795923F,
+    99.0164642F, 92.5953217F, 3.18639612F, 96.4634933F, 17.2446346F,
+    66.8650589F, 72.8168945F, 38.6030235F, 17.0552883F, 93.6378632F,
+    38.7370872F, 13.1931324F, 56.872364F, 73.7656708F, 3.24925923F, 90.4838F,
+    41.683815F, 47.0354F, 87.5989075F, 28.615387F, 30.619194F, 55.1639481F,
+    69.2653F, 53.5667534F, 36.7669F, 71.8443909F, 4.43013906F, 37.6257744F,
+    38.3286247F, 42.81007F, 42.0235748F, 88.5448303F, 53.2514076F,
+    73.5564575F, 80.0741348F, 78.1872F, 38.5764885F, 53.3410492F, 66.300087F,
+    23.4839134F, 5.16811037F, 90.9000473F, 12.7598829F, 84.1019363F,
+    76.3103714F, 74.9984283F, 29.9482841F, 57.5531464F, 83.7145F, 72.817627F,
+    91.1097946F, 12.3739376F, 41.3931923F, 51.6556625F, 83.959137F,
+    90.0435486F, 49.0969086F, 88.7149734F, 87.1593094F, 85.8463058F,
+    56.2531624F, 97.0626144F, 66.9533768F, 12.9831142F, 26.1210194F,
+    92.4324722F, 34.9937706F, 7.02029419F, 37.9675F, 11.4366388F, 80.6863861F,
+    19.986845F, 10.8241491F, 69.2382736F, 79.7630615F, 81.0069504F,
+    14.3123026F, 67.517807F, 47.3446274F, 12.3180027F, 3.1077435F,
+    1.08530116F, 36.6358414F, 32.4682198F, 6.78788519F, 87.6493073F,
+    36.8513565F, 18.2530022F, 0.114416391F, 86.4887238F, 57.6408272F,
+    92.0508118F, 64.5644836F, 6.25037432F, 37.2402763F, 58.5383415F,
+    7.20053625F, 5.77297401F, 17.9825039F, 79.4218F, 90.3048325F, 61.1174202F,
+    46.9780655F, 61.7932892F, 59.1774559F, 94.203804F, 13.9021864F,
+    75.4591293F, 90.1704407F, 94.4119568F, 7.06872368F, 96.8653564F,
+    41.8436241F, 14.8955832F, 16.9860897F, 27.3495865F, 81.3355331F,
+    25.0601597F, 2.78988457F, 4.55073643F, 50.5435677F, 26.4318485F,
+    57.7613449F, 46.638382F, 81.5603714F, 19.454607F, 99.5395355F,
+    32.4324303F, 50.0859642F, 59.3891029F, 30.3054142F, 2.16402769F,
+    92.0862427F, 44.9873581F, 26.2191086F, 78.4821625F, 54.40242F,
+    84.9528503F, 49.1786842F, 46.2465019F, 55.3955879F, 39.8902F, 4.34878302F,
+    88.4510803F, 17.9755878F, 43.5793343F, 56.3235512F, 95.6312485F,
+    98.7080383F, 84.2587433F, 8.78077698F, 94.4086533F, 93.9645F, 40.4162712F,
+    36.7112F, 18.5021839F, 71.3528061F, 61.7216873F, 46.4647255F, 80.4945F,
+    22.2094746F, 22.5025482F, 95.6929779F, 36.4398155F, 95.1059F, 35.6317368F,
+    9.47733879F, 39.2671127F, 95.0168304F, 94.9978867F, 20.3647289F,
+    19.2975693F, 30.738512F, 88.4799423F, 13.4997711F, 85.4244385F,
+    20.3816795F, 18.4801292F, 14.1605911F, 52.0839233F, 67.1975784F,
+    91.5997925F, 40.3215F, 99.9441452F, 92.3605804F, 20.586689F, 90.9651718F,
+    1.11422539F, 66.255806F, 31.0712681F, 88.9443893F, 73.4777298F,
+    89.4879074F, 21.8348713F, 60.9489326F, 69.0231476F, 78.9165268F,
+    36.2888069F, 29.8528557F, 54.919651F, 66.9681549F, 77.4073257F,
+    72.6623688F, 12.7589016F, 54.4927216F, 54.9049911F, 48.8292084F,
+    46.2860641F, 14.5814724F, 22.212F, 45.2649536F, 74.9117355F, 9.32176F,
+    92.1091843F, 5.51775503F, 82.3451462F, 57.1383705F, 68.2746582F,
+    61.4538307F, 86.0865784F, 92.8339767F, 78.6830063F, 35.2840805F,
+    24.036087F, 45.7853737F, 98.5149612F, 61.1621F, 67.1082687F, 24.0212231F,
+    84.8478165F, 45.186573F, 63.4959068F, 67.3789825F, 9.66015244F,
+    96.5840912F, 86.8437347F, 88.0315933F, 82.3706055F, 28.3010025F,
+    49.7598152F, 11.1027594F, 80.1598358F, 37.024292F, 97.299F, 23.5398884F,
+    40.1181831F, 11.8976727F, 68.9779587F, 81.4355164F, 13.9150791F,
+    3.19405913F, 33.36F, 91.0164337F, 64.021904F, 38.8164864F, 66.7404861F,
+    80.8687515F, 63.9869156F, 60.0747681F, 61.7764F, 38.2132263F, 39.2504883F,
+    68.9580612F, 76.1451797F, 95.7426453F, 59.7764282F, 44.5064659F,
+    68.3416061F, 10.6510124F, 44.6454277F, 89.7054749F, 46.0689468F,
+    91.5641251F, 26.817173F, 74.1632614F, 73.4874725F, 38.5231628F,
+    5.09103966F, 38.4234352F, 78.9285F, 50.3284721F, 52.8182602F, 98.9885F,
+    73.7331314F, 20.529705F, 29.1300259F, 26.8410473F, 29.6003075F,
+    69.8008041F, 77.6026611F, 1.00273955F, 11.5057402F, 37.0336952F,
+    44.2303696F, 81.3824F, 48.1749878F, 86.144249F, 12.3642578F, 40.2793465F,
+    37.7876816F, 68.1605377F, 53.7972031F, 41.7026024F, 28.1310253F,
+    35.2693367F, 10.8823843F, 40.8835564F, 58.2770042F, 13.94732F,
+    98.3106766F, 78.8737183F, 7.60182619F, 14.2536783F, 63.0987816F,
+    15.7254581F, 76.0098F, 28.2066F, 36.7671776F, 60.1833611F, 84.2376F,
+    95.8899384F, 34.9760551F, 5.48662F, 81.5159378F, 73.3940353F, 55.0225563F,
+    33.5008659F, 69.6185F, 78.0202408F, 27.8346367F, 25.7965603F, 37.755825F,
+    67.5217209F, 9.04718781F, 77.5614929F, 13.6116219F, 67.7740784F, 77.0249F,
+    46.0155678F, 96.2494125F, 99.3507233F, 73.7491F, 65.1407394F, 31.3591156F,
+    21.6083F, 54.7183F, 46.6831551F, 0.228054449F, 72.7918167F, 54.1170883F,
+    4.71590614F, 75.4218597F, 53.6929817F, 76.6458282F, 79.5548172F,
+    3.79283428F, 22.089941F, 27.7213192F, 72.8480759F, 36.7422485F, 20.5124F,
+    23.1440468F, 17.5036678F, 80.6418152F, 8.10521126F, 59.54813F,
+    36.1146088F, 85.0466766F, 71.1966248F, 79.2409668F, 40.6422272F,
+    45.3117561F, 76.5080948F, 55.0160446F, 25.1440506F, 17.6675224F,
+    9.8733387F, 64.2649765F, 2.31556892F, 66.4886322F, 54.6731606F,
+    68.3963165F, 32.5950127F, 90.2326126F, 70.8311081F, 97.9439316F,
+    72.7872086F, 21.6413898F, 13.9940653F, 87.5532532F, 40.0024452F,
+    68.9043655F, 55.8595924F, 4.51252127F, 90.5401535F, 91.2506866F,
+    85.4617081F, 40.1573257F, 4.34704924F, 99.840065F, 24.3944588F,
+    44.6221962F, 61.7746696F, 79.8169174F, 86.9480286F, 56.8753052F,
+    12.0172205F, 37.3978653F, 42.5049858F, 30.0354023F, 88.914772F,
+    88.7659073F, 85.3027344F, 55.5683441F, 33.8372536F, 23.7771111F, 36.6086F,
+    59.899147F, 94.7423248F, 22.8566761F, 6.83359718F, 22.1666889F, 40.918F,
+    18.4236355F, 24.0102539F, 4.34259605F, 43.802166F, 49.8254509F,
+    28.8703613F, 23.8775082F, 8.01151371F, 8.17033482F, 58.6503296F,
+    54.5285263F, 57.2804489F, 20.5759F, 1.35320139F, 33.0115814F, 87.859169F,
+    23.2083416F, 64.1195374F, 94.1250534F, 9.5509634F, 10.411005F,
+    50.7060814F, 33.1386185F, 74.2279F, 70.4457626F, 50.3746223F, 58.6143188F,
+    18.6861839F, 85.5405273F, 81.1578903F, 0.0283103064F, 90.2383347F,
+    1.680902F, 30.6218643F, 25.3370056F, 29.548233F, 92.3464355F, 69.1116333F,
+    32.850853F, 36.2320518F, 30.7404976F, 55.61063F, 49.6472397F, 44.6857452F,
+    86.9329F, 75.3336716F, 64.9520721F, 43.0104485F, 49.5262451F, 56.9876251F,
+    20.7018185F, 90.6420822F, 74.0799332F, 31.8359432F, 70.8291245F,
+    16.9808731F, 37.3523598F, 69.4036789F, 6.38809443F, 42.9453506F,
+    40.7518616F, 37.3915825F, 1.88747621F, 28.3989792F, 51.2789116F,
+    82.8404388F, 98.6580353F, 49.9402809F, 32.5793228F, 80.5619888F,
+    15.1978951F, 44.972187F, 55.9722137F, 98.0065384F, 60.8509903F,
+    68.3461761F, 82.5485306F, 7.17078066F, 87.6415939F, 2.40694952F,
+    3.63633013F, 97.3949356F, 26.5588551F, 87.2024078F, 13.5334072F,
+    48.8235817F, 7.75637436F, 82.9893112F, 69.9272842F, 14.9824276F,
+    79.2324066F, 83.9722366F, 2.34207129F, 50.0062828F, 73.2609F, 4.31510639F,
+    58.9791031F, 62.2416458F, 47.5627899F, 77.147171F, 82.2459793F,
+    24.949194F, 50.316925F, 37.026371F, 58.9948578F, 46.9624901F, 46.6435204F,
+    11.0961723F, 9.34033489F, 73.7763824F, 75.5978317F, 95.9926529F,
+    93.1373138F, 54.3308792F, 12.5923805F, 82.2045746F, 63.8542252F,
+    86.6807404F, 78.8059387F, 45.7108955F, 40.0221F, 19.1326866F, 92.9010086F,
+    52.912632F, 67.6135712F, 44.6582909F, 83.8390045F, 87.9641876F, 91.78862F,
+    61.5817909F, 35.2929153F };
+
+  // mlRbf: centers, their outputs, widths, query points
+  static const float rbfX[200] = {
+    15.290041F, 15.4762602F, 10.3755465F, 13.5001993F, 14.0322876F,
+    4.61099052F, 4.39280462F, 2.67284942F, 5.94431829F, 2.25745392F,
+    8.0767622F, 7.3019743F, 15.7322578F, 13.3488798F, 2.94789386F,
+    5.68107939F, 13.6884928F, 12.8009539F, 16.9906158F, 19.6761055F,
+    0.925916433F, 11.777997F, 0.368228614F, 10.6191654F, 0.194988832F,
+    0.217154399F, 13.6329012F, 2.81823277F, 12.0630856F, 8.66298389F,
+    7.52608824F, 0.297046334F, 5.41654158F, 0.138323724F, 0.77773571F,
+    18.6210117F, 16.5453339F, 7.02357244F, 8.73151F, 19.5399303F, 6.60019064F,
+    5.83220863F, 7.36680603F, 2.28136921F, 19.3918972F, 16.0225163F,
+    5.33213043F, 16.3942909F, 16.1335945F, 5.87520885F, 6.02531385F,
+    5.24999475F, 19.7290897F, 6.75892496F, 1.47904575F, 0.526839495F,
+    3.80391669F, 9.95940781F, 1.90021729F, 8.95389652F, 10.1500015F,
+    17.1187572F, 10.7406368F, 18.6355076F, 18.3452969F, 0.555999637F,
+    15.8685846F, 15.9729509F, 4.95943737F, 0.779787302F, 9.83829212F,
+    17.1670132F, 6.82479191F, 9.86042F, 2.24966431F, 3.5641582F, 14.3626928F,
+    12.1256113F, 15.2378426F, 19.1179142F, 11.2282629F, 7.41185665F,
+    5.09285069F, 17.5762367F, 16.8148575F, 14.8398523F, 16.4529839F,
+    13.869957F, 19.2090054F, 5.80809498F, 11.445797F, 5.05233431F,
+    17.6120205F, 2.60245657F, 10.0080194F, 4.08659172F, 1.38503361F,
+    14.8480005F, 12.988987F, 3.27706027F, 17.4900188F, 12.0531225F,
+    5.48911619F, 9.52900696F, 4.89822721F, 0.225723907F, 17.0024319F,
+    16.943552F, 11.2590113F, 15.6249256F, 1.52548289F, 0.595644474F,
+    17.8543262F, 4.29163742F, 12.6796646F, 6.5882597F, 12.239131F,
+    18.3612671F, 6.2066493F, 1.21033323F, 9.69765568F, 16.6857452F,
+    14.0170593F, 13.3357611F, 4.94342375F, 5.75539446F, 16.7729816F,
+    0.763784289F, 2.45936227F, 16.109005F, 16.4139824F, 4.92699F, 3.9134047F,
+    15.9956093F, 1.94623744F, 9.41162777F, 5.92939472F, 4.19844389F,
+    4.88834667F, 1.24645555F, 14.7425756F, 1.68569279F, 18.4706497F,
+    14.0600452F, 14.4822102F, 17.8679142F, 15.7262774F, 17.1517677F,
+    11.159811F, 4.15978622F, 14.1059647F, 17.3711395F, 15.19765F, 11.9355545F,
+    19.380188F, 19.8768749F, 17.7900314F, 1.06868351F, 9.12401485F,
+    5.46823168F, 3.71885967F, 1.37595475F, 9.73788F, 6.4015274F, 4.85086918F,
+    16.70788F, 10.8253183F, 7.46087456F, 4.41260433F, 12.0460529F,
+    13.5961294F, 1.62898898F, 18.7501411F, 13.490056F, 16.7138481F,
+    14.6072083F, 2.11578393F, 18.5368347F, 15.6507626F, 9.7277832F,
+    16.355175F, 2.90471625F, 14.7477055F, 19.4061508F, 8.63496113F,
+    7.2336359F, 10.1004848F, 10.0572023F, 8.65605736F, 15.7475348F,
+    16.0754852F, 14.1031694F, 19.274231F, 7.06349325F, 8.11272335F,
+    18.557272F, 12.9035959F, 13.991643F, 15.0213737F, 13.4319105F };
+
+  static const float rbfY[200] = {
+    5.98357105F, 0.949645F, 15.2962847F, 13.044261F, 6.84219837F, 9.72431087F,
+    15.7595253F, 2.53547978F, 15.8627625F, 10.3920536F, 2.32297063F,
+    10.1134434F, 18.5443058F, 4.60152674F, 7.00271606F, 5.52242136F,
+    3.59842229F, 16.8141212F, 6.09284782F, 12.2323236F, 6.55858946F,
+    14.9327784F, 14.3899202F, 0.496665835F, 0.148961127F, 8.30731487F,
+    2.73158193F, 5.07270479F, 12.2572527F, 15.8980923F, 13.5001545F,
+    10.5105438F, 1.91374266F, 10.615942F, 11.1104279F, 11.4299173F,
+    10.8179836F, 17.6568489F, 16.9691315F, 9.78533649F, 4.8205533F,
+    5.5823946F, 1.39670789F, 7.09314823F, 19.1643181F, 18.795723F,
+    17.2408218F, 6.49513102F, 3.10786939F, 4.4519949F, 4.62676859F,
+    6.52972651F, 11.706789F, 15.2834377F, 18.9826813F, 3.00485682F,
+    16.986002F, 7.58303547F, 3.8220284F, 1.56289184F, 10.6345348F,
+    7.28231859F, 7.74861908F, 8.49266434F, 18.1812096F, 1.28499806F,
+    4.44129658F, 17.8726063F, 10.6355047F, 6.18431091F, 15.6813364F,
+    0.159748495F, 17.8498096F, 12.6260729F, 14.1962757F, 17.0141144F,
+    3.09490657F, 11.7138968F, 16.8698769F, 0.883519351F, 2.28948927F,
+    3.67127132F, 2.40699673F, 10.4080858F, 17.9235878F, 17.7729053F,
+    2.47567558F, 13.4194403F, 5.08785677F, 12.3243866F, 9.12755585F,
+    17.4892941F, 9.51245403F, 15.2267103F, 7.98504925F, 3.20698309F,
+    13.6588774F, 2.4109745F, 19.6468906F, 2.20081067F, 16.0007648F,
+    6.36625385F, 8.96153164F, 16.7670784F, 0.0239006616F, 19.3618603F,
+    0.133938864F, 15.2806797F, 9.87656116F, 11.3811131F, 19.7334824F,
+    10.305336F, 6.35351F, 16.3336964F, 5.35770416F, 15.076705F, 8.59609127F,
+    5.29335546F, 2.9326489F, 8.88874245F, 16.4194984F, 13.2713127F, 3.08307F,
+    11.5939646F, 7.71868086F, 9.09458733F, 0.25638932F, 16.5721302F,
+    14.3369112F, 0.0476119891F, 13.4650927F, 4.62163067F, 10.3102264F,
+    14.1630039F, 2.91793108F, 15.5763969F, 10.2960835F, 10.2541323F,
+    19.8935795F, 6.81492376F, 14.2611465F, 9.49302F, 3.5688448F, 4.70707846F,
+    18.4774647F, 17.286684F, 0.30142656F, 0.665863454F, 19.0748653F,
+    14.7273083F, 4.98796701F, 12.2649364F, 6.06085491F, 10.1449175F,
+    15.7400303F, 13.3220501F, 1.86924028F, 0.246622249F, 8.26998234F,
+    12.7657385F, 12.8715277F, 17.823534F, 8.71684647F, 16.3745499F,
+    8.55739212F, 6.78865767F, 5.88698292F, 12.2517185F, 13.4225636F,
+    15.0801334F, 12.9759893F, 10.5166006F, 3.45290399F, 6.61558294F,
+    6.93462229F, 15.4020805F, 6.92850399F, 1.20077109F, 14.4547596F,
+    7.54243279F, 6.60638857F, 7.97039652F, 4.5792551F, 1.64797235F,
+    9.67592907F, 7.69380379F, 1.51448166F, 10.1852198F, 2.0268364F,
+    4.40660906F, 19.3584709F, 4.0465F, 19.3376579F, 8.43509388F, 17.1420822F,
+    2.05645204F, 17.8270779F, 14.0078459F, 11.126668F, 6.18572855F };
+
+  static const float rbfS[100] = {
+    0.409569174F, 0.0596155971F, 0.80968076F, 0.684062541F, 0.0512121245F,
+    0.924186289F, 0.626638F, 0.337614805F, 0.297795385F, 0.0931438133F,
+    0.276542962F, 0.563773215F, 0.115593798F, 0.0149186049F, 0.879789054F,
+    0.241711274F, 0.872231483F, 0.286924332F, 0.238982111F, 0.444692522F,
+    0.131513476F, 0.146381244F, 0.572100043F, 0.223635092F, 0.781511605F,
+    0.491994739F, 0.252697229F, 0.309132904F, 0.435964942F, 0.947770894F,
+    0.99437F, 0.685843468F, 0.0960800499F, 0.247838F, 0.230108187F,
+    0.14145954F, 0.925802827F, 0.56918776F, 0.75007081F, 0.64590013F,
+    0.858265698F, 0.163483918F, 0.34623906F, 0.758532524F, 0.928790212F,
+    0.493177176F, 0.321140677F, 0.34930864F, 0.116693325F, 0.415337831F,
+    0.538322747F, 0.211705133F, 0.364845514F, 0.287652135F, 0.803365529F,
+    0.875197053F, 0.964248657F, 0.47025016F, 0.686368883F, 0.797675371F,
+    0.706258893F, 0.773095965F, 0.0997264087F, 0.896923721F, 0.0192555375F,
+    0.340630442F, 0.0926248133F, 0.678569376F, 0.339583933F, 0.111013308F,
+    0.380679F, 0.244409144F, 0.66599685F, 0.494203687F, 0.406710804F,
+    0.422271788F, 0.486513615F, 0.579239547F, 0.668070853F, 0.0287827905F,
+    0.625473917F, 0.886429191F, 0.802671969F, 0.756492734F, 0.292559087F,
+    0.398419142F, 0.33801043F, 0.465450108F, 0.00876136217F, 0.88616854F,
+    0.628743827F, 0.988750398F, 0.766270578F, 0.862629056F, 0.0888568535F,
+    0.457306713F, 0.346306175F, 0.437222868F, 0.266125172F, 0.0214474462F };
+
+  static const float rbfXhat[80] = {
+    14.8532658F, 13.6970549F, 3.058424F, 4.25366545F, 18.2001038F,
+    7.72203207F, 13.0513792F, 16.8631668F, 9.40613174F, 10.6552734F,
+    18.2121277F, 14.3979673F, 8.53977299F, 5.05073786F, 0.421651F,
+    7.32877731F, 3.27770257F, 2.76335812F, 5.53136539F, 9.05528736F,
+    1.94785428F, 9.27947903F, 11.0236301F, 19.6575489F, 15.8587379F,
+    8.26637268F, 9.48909378F, 15.2375164F, 1.99476504F, 2.35730934F,
+    0.665518582F, 14.602849F, 2.43096399F, 3.70165634F, 16.6372108F,
+    0.252817631F, 18.4506721F, 12.9312458F, 11.41294F, 12.151041F,
+    9.06314373F, 3.58670497F, 7.0027914F, 6.0992918F, 2.75835371F, 17.972168F,
+    15.8139429F, 8.70573807F, 15.4309797F, 1.62482154F, 8.57296944F,
+    16.3401203F, 17.8065071F, 9.80052567F, 13.7433243F, 5.23210335F,
+    19.6154308F, 18.5268517F, 10.8255768F, 13.2153339F, 13.7303162F,
+    9.68154621F, 19.2106972F, 8.05408382F, 3.84380603F, 4.38598585F,
+    10.5202579F, 14.7186985F, 19.2501926F, 13.2179813F, 8.25203514F,
+    1.73099601F, 14.134059F, 5.84004F, 2.89453F, 3.55199885F, 19.363121F,
+    1.65528929F, 2.69205976F, 9.22596836F };
+
+  // staged inputs and outputs of one kernel in the three formats, pairs
+  // aligned to 4 bytes
+  RT_LOCAL_DATA static float inF32[IN_MAX];
+  RT_LOCAL_DATA static mlF16 inF16[IN_MAX] __attribute__ ((aligned (4)));
+  RT_LOCAL_DATA static mlBF16 inBF16[IN_MAX] __attribute__ ((aligned (4)));
+  RT_LOCAL_DATA static float outF32[OUT_MAX];
+  RT_LOCAL_DATA static mlF16 outF16[OUT_MAX] __attribute__ ((aligned (4)));
+  RT_LOCAL_DATA static mlBF16 outBF16[OUT_MAX] __attribute__ ((aligned (4)));
+  RT_LOCAL_DATA static float tmpF32[100];
+  RT_LOCAL_DATA static mlF16 tmpF16[100] __attribute__ ((aligned (4)));
+  RT_LOCAL_DATA static mlBF16 tmpBF16[100] __attribute__ ((aligned (4)));
+
+  static const int inSize[N_KERNELS] = { 1208, 484, 800, 804, 1200, 580 };
+  static const int outSize[N_KERNELS] = { 400, 40, 4, 400, 400, 80 };
+  static const char *kernNames[N_KERNELS] = { "gemm 10x10", "gemv 10x10", "dotp 100", "axpy 100", "dist 100", "rbf 10x25" };
+  static const char *fmtNames[N_FORMATS] = { "fp32", "fp16", "bf16" };
+
+  // tolerated error relative to the largest fp32 result, in units of the
+  // rounding of the format (2^-11 for fp16, 2^-8 for bf16)
+  static const int tolUlps[N_KERNELS] = { TOL_GEMM, TOL_GEMV, TOL_DOTP, TOL_AXPY, TOL_DIST, TOL_RBF };
+  static const float unitRound[N_FORMATS] = { 0.0F, 4.8828125e-4F, 3.90625e-3F };
+
+/////////////////////////////////////////////////////////
+// subfunctions
+/////////////////////////////////////////////////////////
+
+// fp32 kernels, the loops of the fp32 tests
+static void gemmF32(const float *A, const float *B, float *C, float a, float b)
+{
+  int i2, i3, i4;
+  float f0;
+
+  for (i2 = 0; i2 < 10; i2++) {
+    for (i3 = 0; i3 < 10; i3++) {
+      f0 = 0.0F;
+      for (i4 = 0; i4 < 10; i4++) {
+        f0 += a * A[i2 + 10 * i4] * B[i4 + 10 * i3];
+      }
+      C[i2 + 10 * i3] = f0 + b * C[i2 + 10 * i3];
+    }
+  }
+}
+
+static void gemvF32(const float *A, const float *x, const float *z, float b, float *y)
+{
+  int ix, k;
+  float b_y;
+
+  for (ix = 0; ix < 10; ix++) {
+    b_y = 0.0F;
+    for (k = 0; k < 10; k++) {
+      b_y += A[ix + 10 * k] * x[k];
+    }
+    y[ix] = b_y + b * z[ix];
+  }
+}
+
+static float dotpF32(const float *x, const float *y, int n)
+{
+  float f0 = 0.0F;
+  int i;
+
+  for (i = 0; i < n; i++)
+    f0 += y[i] * x[i];
+
+  return f0;
+}
+
+static void axpyF32(float a, const float *x, const float *y, float *out, int n)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    out[i] = a * x[i] + y[i];
+}
+
+static void distF32(const float *p, float *d, int n)
+{
+  int j;
+
+  for (j = 0; j < n; j++, p += 3)
+    d[j] = fSqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+}
+
+static void rbfF32(const float *x, const float *y, const float *s, const float *xhat, float *yhat)
+{
+  float a[25], w[25];
+  float b_a, b_w, b_y, z;
+  int nOut, i0, b_k;
+
+  for (i0 = 0; i0 < 20; i0++)
+    yhat[i0] = 0.0F;
+
+  for (nOut = 0; nOut < 10; nOut++) {
+    for (i0 = 0; i0 < 25; i0++) {
+      b_a = x[i0 << 1] - xhat[nOut << 1];
+      b_w = b_a * b_a;
+      b_a = x[1 + (i0 << 1)] - xhat[1 + (nOut << 1)];
+      b_w = -s[i0] * (b_w + b_a * b_a);
+      b_w = fExp(b_w);
+      a[i0] = y[i0 << 1] * b_w;
+      w[i0] = b_w;
+    }
+
+    b_y = a[0];
+    for (b_k = 0; b_k < 24; b_k++)
+      b_y += a[b_k + 1];
+    yhat[nOut << 1] = b_y;
+
+    for (i0 = 0; i0 < 25; i0++)
+      a[i0] = y[1 + (i0 << 1)] * w[i0];
+
+    b_y = a[0];
+    for (b_k = 0; b_k < 24; b_k++)
+      b_y += a[b_k + 1];
+    yhat[1 + (nOut << 1)] = b_y;
+
+    b_y = w[0];
+    for (b_k = 0; b_k < 24; b_k++)
+      b_y += w[b_k + 1];
+
+    z = fDiv(1.0F, b_y);
+    for (i0 = 0; i0 < 20; i0++)
+      yhat[i0] *= z;
+  }
+}
+
+// instance inst of kernel kern, on the staged inputs, same interface as
+// the half precision ones
+static void runF32(int kern, int inst, const float *in, float *out, float *tmp)
+{
+  int i;
+
+  (void)tmp;
+
+  switch (kern) {
+  case K_GEMM:
+    for (i = 0; i < 100; i++)
+      out[100 * inst + i] = in[GEMM_C + 100 * inst + i];
+    gemmF32(in + GEMM_A + 100 * inst, in + GEMM_B + 100 * inst, out + 100 * inst,
+            in[GEMM_ALPHA + inst], in[GEMM_BETA + inst]);
+    break;
+  case K_GEMV:
+    gemvF32(in + GEMV_A + 100 * inst, in + GEMV_X + 10 * inst, in + GEMV_Z + 10 * inst,
+            in[GEMV_BETA + inst], out + 10 * inst);
+    break;
+  case K_DOTP:
+    out[inst] = dotpF32(in + DOTP_X + 100 * inst, in + DOTP_Y + 100 * inst, 100);
+    break;
+  case K_AXPY:
+    axpyF32(in[AXPY_A + inst], in + AXPY_X + 100 * inst, in + AXPY_Y + 100 * inst,
+            out + 100 * inst, 100);
+    break;
+  case K_DIST:
+    distF32(in + DIST_P + 300 * inst, out + 100 * inst, 100);
+    break;
+  case K_RBF:
+    rbfF32(in + RBF_X + 50 * inst, in + RBF_Y + 50 * inst, in + RBF_S + 25 * inst,
+           in + RBF_XHAT + 20 * inst, out + 20 * inst);
+    break;
+  }
+}
+
+// fp16 and bfloat16 kernels
+#define H_T mlF16
+#define H_V v2F16
+#define HOP(op) F16_##op
+#define HFN(name) name##F16
+#include "mlHalfKern.h"
+#undef H_T
+#undef H_V
+#undef HOP
+#undef HFN
+
+#define H_T mlBF16
+#define H_V v2BF16
+#define HOP(op) BF16_##op
+#define HFN(name) name##BF16
+#include "mlHalfKern.h"
+#undef H_T
+#undef H_V
+#undef HOP
+#undef HFN
+
+static void stage(int at, const float *x, int n)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    inF32[at + i] = x[i];
+}
+
+// inputs of kernel kern to L1, converted to the half formats
+void loadKernel(int kern)
+{
+  int i;
+
+  switch (kern) {
+  case K_GEMM:
+    stage(GEMM_A, gemmA, 400);
+    stage(GEMM_B, gemmB, 400);
+    stage(GEMM_C, gemmC, 400);
+    stage(GEMM_ALPHA, gemmAlpha, 4);
+    stage(GEMM_BETA, gemmBeta, 4);
+    break;
+  case K_GEMV:
+    stage(GEMV_A, gemvA, 400);
+    stage(GEMV_X, gemvX, 40);
+    stage(GEMV_Z, gemvZ, 40);
+    stage(GEMV_BETA, gemvBeta, 4);
+    break;
+  case K_DOTP:
+    stage(DOTP_X, dotpX, 400);
+    stage(DOTP_Y, dotpY, 400);
+    break;
+  case K_AXPY:
+    stage(AXPY_Y, axpyY, 400);
+    stage(AXPY_X, axpyX, 400);
+    stage(AXPY_A, axpyA, 4);
+    break;
+  case K_DIST:
+    stage(DIST_P, distP, 1200);
+    break;
+  case K_RBF:
+    stage(RBF_X, rbfX, 200);
+    stage(RBF_Y, rbfY, 200);
+    stage(RBF_S, rbfS, 100);
+    stage(RBF_XHAT, rbfXhat, 80);
+    break;
+  }
+
+  for (i = 0; i < inSize[kern]; i++)
+  {
+    inF16[i] = F16_TO(inF32[i]);
+    inBF16[i] = BF16_TO(inF32[i]);
+  }
+}
+
+// the 4 instances of kernel kern in format fmt, returns the cycles
+int runKernel(int kern, int fmt)
+{
+  int inst;
+
+  reset_timer();
+  start_timer();
+
+  for (inst = 0; inst < N_INST; inst++)
+  {
+    switch (fmt)
+    {
+      case F_FP32:
+        runF32(kern, inst, inF32, outF32, tmpF32);
+        break;
+      case F_FP16:
+        runF16(kern, inst, inF16, outF16, tmpF16);
+        break;
+      default:
+        runBF16(kern, inst, inBF16, outBF16, tmpBF16);
+        break;
+    }
+  }
+
+  stop_timer();
+
+  return get_time();
+}
+
+static float maxAbs(const float *x, int n)
+{
+  float m = 0.0F;
+  int i;
+
+  for (i = 0; i < n; i++)
+    if (fAbs(x[i]) > m)
+      m = fAbs(x[i]);
+
+  return m;
+}
+
+// max |half - fp32| / max |fp32| over the outputs of kernel kern, -1 if a
+// half result is not finite
+float relErr(int kern, int fmt)
+{
+  float e = 0.0F;
+  float h, d;
+  int i;
+
+  for (i = 0; i < outSize[kern]; i++)
+  {
+    h = (fmt == F_FP16) ? F16_FROM(outF16[i]) : BF16_FROM(outBF16[i]);
+    if (!(fAbs(h) <= 3.40282347e+38F))
+      return -1.0F;
+    d = fAbs(h - outF32[i]);
+    if (d > e)
+      e = d;
+  }
+
+  return fDiv(e, maxAbs(outF32, outSize[kern]));
+}
+
+/////////////////////////////////////////////////////////
+// main testing function 
+/////////////////////////////////////////////////////////
+int main(int argc, const char * const argv[])
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  (void)argc;
+  (void)argv;
+
+  int coreid = get_core_id();
+  int errors = 0;
+  int cycles32 = 0;
+  int kern, fmt, cycles, bytes, ok;
+  float err, ref;
+  boolean_T pass;
+
+  init_fp_regs();
+
+  /////////////////////////////////////////////////////////
+  // main test loop 
+  // every kernel in the three formats, on core 0
+  /////////////////////////////////////////////////////////
+
+  synch_barrier();
+
+  perf_begin();
+
+  if (coreid == 0)
+  {
+#ifndef ML_HALF_SIMD
+    // the cycles of the emulated formats say nothing about the packed ones
+    printf("fp16/bfloat16 emulated in fp32, speedups are not representative\n");
+#endif
+
+    for (kern = 0; kern < N_KERNELS; kern++)
+    {
+      loadKernel(kern);
+      ref = 0.0F;
+
+      for (fmt = 0; fmt < N_FORMATS; fmt++)
+      {
+        cycles = runKernel(kern, fmt);
+        bytes = (inSize[kern] + outSize[kern]) * (fmt == F_FP32 ? 4 : 2);
+
+        if (fmt == F_FP32)
+        {
+          cycles32 = cycles;
+          ref = maxAbs(outF32, outSize[kern]);
+          printf("%s, %s: time=%d, bytes %d\n", kernNames[kern], fmtNames[fmt], cycles, bytes);
+          continue;
+        }
+
+        err = relErr(kern, fmt);
+
+        // fp16 may only overflow where the fp32 results do not fit in it
+        if (err < 0.0F)
+        {
+          ok = (fmt == F_FP16) && (ref > FP16_MAX);
+          printf("%s, %s: time=%d, speedup x100 %d, bytes %d, rel err overflow (max %d)\n",
+                 kernNames[kern], fmtNames[fmt], cycles, (cycles32 * 100) / cycles, bytes, (int) ref);
+        }
+        else
+        {
+          ok = err <= tolUlps[kern] * unitRound[fmt];
+          printf("%s, %s: time=%d, speedup x100 %d, bytes %d, rel err x1e6 %d\n",
+                 kernNames[kern], fmtNames[fmt], cycles, (cycles32 * 100) / cycles, bytes, (int) (err * 1e6F));
+        }
+
+        if (!ok)
+        {
+          errors++;
+          printf("%s, %s: error out of tolerance\n", kernNames[kern], fmtNames[fmt]);
+        }
+      }
+    }
+  }
+
+  synch_barrier();
+
+  perf_end();
+
+  /////////////////////////////////////////////////////////
+  // check results
+  /////////////////////////////////////////////////////////
+
+  pass = (errors == 0);
+
+  if (coreid == 0)
+    flagPassFail(pass, coreid);
+
+  synch_barrier();
+/////////////////////////////////////////////////////////
+// synchronize and exit
+/////////////////////////////////////////////////////////
+
+  return !pass;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+#ifndef __ML_HALF_H__
+#define __ML_HALF_H__
+
+/////////////////////////////////////////////////////////
+// defines
+/////////////////////////////////////////////////////////
+
+// include the shared header for ml kernels
+#include "mlShared.h"
+
+// kernels, run on the stimuli of the fp32 tests of the same name
+#define K_GEMM 0
+#define K_GEMV 1
+#define K_DOTP 2
+#define K_AXPY 3
+#define K_DIST 4
+#define K_RBF  5
+#define N_KERNELS 6
+
+// instances per kernel (the per-core slices of the fp32 tests)
+#define N_INST 4
+
+// formats
+#define F_FP32 0
+#define F_FP16 1
+#define F_BF16 2
+#define N_FORMATS 3
+
+// largest fp16 value, above it the results are inf
+#define FP16_MAX 65504.0F
+
+// tolerated relative error per kernel, in units of the rounding of the
+// format, about 4x the measured one. rbf rescales the outputs by 1/sum(w)
+// once per output (like the fp32 test), the rounding errors compound.
+#define TOL_GEMM 8
+#define TOL_GEMV 6
+#define TOL_DOTP 4
+#define TOL_AXPY 4
+#define TOL_DIST 6
+#define TOL_RBF  128
+
+// staged inputs of one kernel, offsets of the inputs (all the instances
+// back to back) in the staging buffers
+#define GEMM_A     0
+#define GEMM_B     400
+#define GEMM_C     800
+#define GEMM_ALPHA 1200
+#define GEMM_BETA  1204
+#define GEMV_A     0
+#define GEMV_X     400
+#define GEMV_Z     440
+#define GEMV_BETA  480
+#define DOTP_X     0
+#define DOTP_Y     400
+#define AXPY_Y     0
+#define AXPY_X     400
+#define AXPY_A     800
+#define DIST_P     0
+#define RBF_X      0
+#define RBF_Y      200
+#define RBF_S      400
+#define RBF_XHAT   500
+#define IN_MAX     1208
+#define OUT_MAX    400
+
+// fp16 and bfloat16 storage and arithmetic, native or emulated
+#include "half_fmt.h"
+
+/////////////////////////////////////////////////////////
+// subfunctions
+/////////////////////////////////////////////////////////
+void loadKernel(int kern);
+int runKernel(int kern, int fmt);
+float relErr(int kern, int fmt);
+
+/////////////////////////////////////////////////////////
+// main testing function 
+/////////////////////////////////////////////////////////
+int main(int argc, const char * const argv[]);
+
+#endif
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/*
+ * Half precision kernels, included by mlHalf.c once per format, with
+ * H_T (scalar), H_V (pair), HOP(op) (the ops of the format, see mlHalf.h)
+ * and HFN(name) defined. Same loops and rounding points as the fp32 tests,
+ * the contiguous dimension in pairs.
+ */
+
+// C = a*A*B + b*C, 10 x 10 column major, aA is scratch for a*A
+static void HFN(gemm)(const H_T *A, const H_T *B, H_T *C, H_T a, H_T b, H_T *aA)
+{
+  H_V va = HOP(VSPLAT)(a);
+  H_V vb = HOP(VSPLAT)(b);
+  H_V acc[5];
+  int i2, i3, i4;
+
+  for (i2 = 0; i2 < 100; i2 += 2)
+    HOP(VST)(aA + i2, HOP(VMUL)(va, HOP(VLD)(A + i2)));
+
+  for (i3 = 0; i3 < 10; i3++) {
+    for (i2 = 0; i2 < 5; i2++)
+      acc[i2] = HOP(VSPLAT)(HOP(TO)(0.0F));
+
+    for (i4 = 0; i4 < 10; i4++) {
+      H_V bk = HOP(VSPLAT)(B[i4 + 10 * i3]);
+      for (i2 = 0; i2 < 5; i2++)
+        acc[i2] = HOP(VFMA)(HOP(VLD)(aA + 2 * i2 + 10 * i4), bk, acc[i2]);
+    }
+
+    for (i2 = 0; i2 < 5; i2++)
+      HOP(VST)(C + 2 * i2 + 10 * i3, HOP(VFMA)(vb, HOP(VLD)(C + 2 * i2 + 10 * i3), acc[i2]));
+  }
+}
+
+// y = A x + b z, A 10 x 10 column major
+static void HFN(gemv)(const H_T *A, const H_T *x, const H_T *z, H_T b, H_T *y)
+{
+  H_V acc[5];
+  int i, k;
+
+  for (i = 0; i < 5; i++)
+    acc[i] = HOP(VSPLAT)(HOP(TO)(0.0F));
+
+  for (k = 0; k < 10; k++) {
+    H_V xk = HOP(VSPLAT)(x[k]);
+    for (i = 0; i < 5; i++)
+      acc[i] = HOP(VFMA)(HOP(VLD)(A + 2 * i + 10 * k), xk, acc[i]);
+  }
+
+  for (i = 0; i < 5; i++)
+    HOP(VST)(y + 2 * i, HOP(VFMA)(HOP(VSPLAT)(b), HOP(VLD)(z + 2 * i), acc[i]));
+}
+
+// n even, two partial sums added at the end
+static H_T HFN(dotp)(const H_T *x, const H_T *y, int n)
+{
+  H_V acc = HOP(VSPLAT)(HOP(TO)(0.0F));
+  int i;
+
+  for (i = 0; i < n; i += 2)
+    acc = HOP(VFMA)(HOP(VLD)(x + i), HOP(VLD)(y + i), acc);
+
+  return HOP(ADD)(HOP(VLANE)(acc, 0), HOP(VLANE)(acc, 1));
+}
+
+// out = a x + y, n even
+static void HFN(axpy)(H_T a, const H_T *x, const H_T *y, H_T *out, int n)
+{
+  H_V va = HOP(VSPLAT)(a);
+  int i;
+
+  for (i = 0; i < n; i += 2)
+    HOP(VST)(out + i, HOP(VFMA)(va, HOP(VLD)(x + i), HOP(VLD)(y + i)));
+}
+
+// d[j] = |p_j| of 3D points stored back to back, n even: two points are
+// three pairs, squared as pairs and summed lane by lane
+static void HFN(dist)(const H_T *p, H_T *d, int n)
+{
+  int j;
+
+  for (j = 0; j < n; j += 2, p += 6) {
+    H_V s0 = HOP(VLD)(p);
+    H_V s1 = HOP(VLD)(p + 2);
+    H_V s2 = HOP(VLD)(p + 4);
+    s0 = HOP(VMUL)(s0, s0);
+    s1 = HOP(VMUL)(s1, s1);
+    s2 = HOP(VMUL)(s2, s2);
+    d[j]   = HOP(TO)(fSqrt(HOP(FROM)(HOP(ADD)(HOP(ADD)(HOP(VLANE)(s0, 0), HOP(VLANE)(s0, 1)), HOP(VLANE)(s1, 0)))));
+    d[j+1] = HOP(TO)(fSqrt(HOP(FROM)(HOP(ADD)(HOP(ADD)(HOP(VLANE)(s1, 1), HOP(VLANE)(s2, 0)), HOP(VLANE)(s2, 1)))));
+  }
+}
+
+// mlRbf: for each of the 10 outputs the weights w = exp(-s |x_i - xhat|^2)
+// of the 25 centers, y_hat = sum(y_i w), the 2D y_i as a pair, then (like
+// the fp32 test) all of y_hat scaled by 1 / sum(w). exp and 1/x in fp32.
+static void HFN(rbf)(const H_T *x, const H_T *y, const H_T *s, const H_T *xhat, H_T *yhat)
+{
+  int i, n;
+
+  for (i = 0; i < 20; i++)
+    yhat[i] = HOP(TO)(0.0F);
+
+  for (n = 0; n < 10; n++) {
+    H_V xh = HOP(VLD)(xhat + 2 * n);
+    H_V acc = HOP(VSPLAT)(HOP(TO)(0.0F));
+    H_T sw = HOP(TO)(0.0F);
+    H_T w, z;
+
+    for (i = 0; i < 25; i++) {
+      H_V dd = HOP(VSUB)(HOP(VLD)(x + 2 * i), xh);
+      dd = HOP(VMUL)(dd, dd);
+      w = HOP(MUL)(s[i], HOP(ADD)(HOP(VLANE)(dd, 0), HOP(VLANE)(dd, 1)));
+      w = HOP(TO)(fExp(-HOP(FROM)(w)));
+      acc = HOP(VFMA)(HOP(VLD)(y + 2 * i), HOP(VSPLAT)(w), acc);
+      sw = HOP(ADD)(sw, w);
+    }
+
+    HOP(VST)(yhat + 2 * n, acc);
+    z = HOP(TO)(fDiv(1.0F, HOP(FROM)(sw)));
+    for (i = 0; i < 20; i += 2)
+      HOP(VST)(yhat + i, HOP(VMUL)(HOP(VLD)(yhat + i), HOP(VSPLAT)(z)));
+  }
+}
+
+// instance inst of kernel kern, on the staged inputs in and outputs out
+static void HFN(run)(int kern, int inst, const H_T *in, H_T *out, H_T *tmp)
+{
+  int i;
+
+  switch (kern) {
+  case K_GEMM:
+    for (i = 0; i < 100; i++)
+      out[100 * inst + i] = in[GEMM_C + 100 * inst + i];
+    HFN(gemm)(in + GEMM_A + 100 * inst, in + GEMM_B + 100 * inst, out + 100 * inst,
+              in[GEMM_ALPHA + inst], in[GEMM_BETA + inst], tmp);
+    break;
+  case K_GEMV:
+    HFN(gemv)(in + GEMV_A + 100 * inst, in + GEMV_X + 10 * inst, in + GEMV_Z + 10 * inst,
+              in[GEMV_BETA + inst], out + 10 * inst);
+    break;
+  case K_DOTP:
+    out[inst] = HFN(dotp)(in + DOTP_X + 100 * inst, in + DOTP_Y + 100 * inst, 100);
+    break;
+  case K_AXPY:
+    HFN(axpy)(in[AXPY_A + inst], in + AXPY_X + 100 * inst, in + AXPY_Y + 100 * inst,
+              out + 100 * inst, 100);
+    break;
+  case K_DIST:
+    HFN(dist)(in + DIST_P + 300 * inst, out + 100 * inst, 100);
+    break;
+  case K_RBF:
+    HFN(rbf)(in + RBF_X + 50 * inst, in + RBF_Y + 50 * inst, in + RBF_S + 25 * inst,
+             in + RBF_XHAT + 20 * inst, out + 20 * inst);
+    break;
+  }
+}
@@ -0,0 +1 @@
+../ml_shared/math_fns.c
\ No newline at end of file
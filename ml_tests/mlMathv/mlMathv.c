@@ -0,0 +1,904 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/////////////////////////////////////////////////////////
+// includes
+/////////////////////////////////////////////////////////
+#include "mlMathv.h"
+#include "math_fns.h"
+#ifndef LINUX
+#include "pulp.h"
+#endif
+
+/////////////////////////////////////////////////////////
+// batch math functions of math_fns (fExpv, fLogv, fSinCosv, fAtan2v):
+// max error in ulps against float rounded double references, elements
+// per cycle against the scalar versions, and scaling over the cores.
+/////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////
+// shared globals
+/////////////////////////////////////////////////////////
+
+RT_LOCAL_DATA static const float exp_x[N_ELEM] = {
+  -20.3213787F, -46.6241417F, -57.943573F, 72.9208527F,
+  14.139329F, 33.7732162F, 9.78540802F, -19.8797894F,
+  41.0342369F, 13.8748932F, 49.7116737F, 28.7766705F,
+  59.8771515F, -10.1059608F, -59.8663521F, -60.7788658F,
+  39.5546913F, -57.6856117F, 27.564661F, 21.6353512F,
+  -76.5876465F, 50.2550011F, -81.2239075F, 64.7060471F,
+  60.1830254F, -49.2221642F, 40.0916481F, 41.1595192F,
+  -65.1243362F, 30.2416534F, -65.3406754F, 72.8137741F,
+  33.549015F, 84.5008621F, -77.6323318F, -31.3849602F,
+  21.4824867F, 19.4361706F, -55.1341743F, 68.361557F,
+  61.1422882F, -34.2521477F, -61.4661713F, 29.8403587F,
+  -15.7415514F, 29.0844612F, -0.678704202F, -17.9057198F,
+  -83.2086639F, -63.3838768F, -6.77698374F, 40.4371452F,
+  -12.5087299F, 43.2772865F, 7.46276855F, 67.0616989F,
+  27.6457729F, -30.6726646F, -62.7078934F, -75.4972382F,
+  -80.0706482F, 63.9346657F, 66.0534973F, 44.489666F,
+  -67.8673782F, 28.5884552F, -64.6603241F, 68.5868149F,
+  27.7017841F, 44.183094F, 19.5848866F, -13.7833443F,
+  61.4705238F, 81.293602F, -44.6931381F, -10.4571457F,
+  41.3487282F, 31.9918747F, -15.1427526F, -8.24738407F,
+  82.3353271F, -38.7101555F, -49.9818268F, 33.0727119F,
+  -38.5317383F, 70.0536804F, -29.9956608F, 74.809166F,
+  -20.5327911F, 67.8957062F, 44.4465637F, 41.1029892F,
+  -49.4946327F, -58.2557831F, -81.5707779F, -55.3905296F,
+  29.646944F, -75.7359619F, -45.4885826F, 12.2312412F,
+  -59.8487663F, -29.4127254F, -47.0346069F, 31.315403F,
+  -66.2596817F, 87.5664597F, 17.7790089F, 37.783226F,
+  9.69698429F, 0.118243195F, 82.8701172F, 69.4010162F,
+  56.8404045F, -81.7773209F, 16.1649456F, 77.7980499F,
+  24.7035751F, 2.77282405F, 26.6976414F, -56.0234795F,
+  40.3468285F, 50.1486168F, -74.4490967F, 2.2140193F,
+  17.1653881F, -25.3969898F, 32.2970467F, 74.3381042F,
+  71.5844421F, -33.1404037F, -60.4425316F, 62.4382744F,
+  20.0939999F, 58.1655159F, 65.0621185F, -38.097187F,
+  15.7931137F, -33.9355087F, 52.5610962F, 34.022995F,
+  -45.1666794F, 0.523123145F, 16.9755001F, -46.2191772F,
+  -55.0639725F, -4.00847864F, -74.3840027F, -0.346904457F,
+  77.4965057F, 57.5479507F, -77.4944534F, 57.5065842F,
+  38.3794479F, 36.9307823F, -82.3096924F, 45.9821167F,
+  -52.7991447F, 53.5325966F, -30.571434F, -22.8370209F,
+  -56.8546143F, 64.8277283F, -48.1821671F, 65.7429047F,
+  2.9166739F, -61.0132637F, 27.6519165F, 5.89830732F,
+  -82.2686234F, 57.1282005F, -39.589119F, -82.822197F,
+  47.1133728F, 40.2343979F, -19.4891834F, -54.4124413F,
+  5.2146039F, 15.6247845F, 33.6599541F, -1.32457852F,
+  12.3718901F, 39.1367493F, -53.8062935F, -55.3973083F,
+  -2.22014856F, 44.9736443F, 53.4901695F, 62.3341331F,
+  -10.1848774F, 37.8958511F, -68.4240265F, -18.9784851F,
+  -75.3109207F, 59.1762466F, 87.9601974F, 30.1916084F,
+  44.6794701F, -21.8597736F, 52.109333F, -72.1212234F,
+  -22.1411991F, -25.6071987F, 64.1883469F, -56.7276878F,
+  -59.1512756F, -71.3568268F, 60.5000191F, -31.8033905F,
+  71.0401459F, -32.2252312F, 59.4241676F, -52.8849907F,
+  70.9363403F, 83.3905487F, 66.7162247F, 34.0774994F,
+  69.8622665F, 73.0070953F, 81.6652527F, -38.8016319F,
+  61.7302742F, 49.4417648F, -26.4728127F, -57.5672569F,
+  70.4373398F, -4.33360767F, 5.76852655F, 68.1467743F,
+  -2.32725668F, -42.8127136F, 33.0441208F, 6.15755796F,
+  -39.3304672F, 34.1080589F, 71.2054443F, -43.9581108F,
+  55.2304268F, 44.8914719F, 4.43079472F, -53.1763496F,
+  29.3620071F, -37.7532806F, -43.1138649F, 62.3491287F,
+  -39.64571F, -70.8176575F, 60.9600372F, 87.1014557F,
+  -33.5609207F, -16.1300297F, 8.29201126F, 44.7464218F,
+  -84.8629379F, 26.3917599F, -46.1090965F, 75.5860825F };
+
+RT_LOCAL_DATA static const float exp_ref[N_ELEM] = {
+  1.49464263e-09F, 5.64147316e-21F, 6.845828e-26F, 4.66792565e+31F,
+  1382396.25F, 4.65073353e+14F, 17772.5078F, 2.32443376e-09F,
+  6.62129063e+17F, 1061181.25F, 3.88602495e+21F, 3.14448255e+12F,
+  1.00998866e+26F, 4.08354135e-05F, 1.00086073e-26F, 4.01859227e-27F,
+  1.50794034e+17F, 8.86047768e-26F, 9.35793852e+11F, 2.48950861e+09F,
+  5.47529794e-34F, 6.69067089e+21F, 5.30768559e-36F, 1.26322052e+28F,
+  1.37137375e+26F, 4.19841846e-22F, 2.57977331e+17F, 7.50502379e+17F,
+  5.21026883e-29F, 1.36076528e+13F, 4.19667417e-29F, 4.19392131e+31F,
+  3.71665364e+14F, 4.99181094e+36F, 1.92622336e-34F, 2.34252908e-14F,
+  2.13661094e+09F, 276071520.0F, 1.13640285e-24F, 4.8870524e+29F,
+  3.57897272e+26F, 1.33192956e-15F, 2.02106838e-27F, 9.10968016e+12F,
+  1.45724002e-07F, 4.27780525e+12F, 0.507273912F, 1.67357328e-08F,
+  7.29350695e-37F, 2.96983333e-28F, 0.0011397074F, 3.64442509e+17F,
+  3.6942613e-06F, 6.23859434e+18F, 1741.96411F, 1.33206615e+29F,
+  1.01486114e+12F, 4.77563376e-14F, 5.83858952e-28F, 1.62916868e-33F,
+  1.68174183e-35F, 5.84080232e+27F, 4.86037056e+28F, 2.09708687e+19F,
+  3.35407019e-30F, 2.60500357e+12F, 8.28663197e-29F, 6.12174496e+29F,
+  1.07332685e+12F, 1.54338381e+19F, 320337792.0F, 1.03268917e-06F,
+  4.96946099e+26F, 2.02005293e+35F, 3.89060136e-20F, 2.87421553e-05F,
+  9.06827094e+17F, 7.83239631e+13F, 2.6520766e-07F, 0.000261942885F,
+  5.72503613e+35F, 1.5430965e-17F, 1.96412191e-22F, 2.30832145e+14F,
+  1.8445001e-17F, 2.65415856e+30F, 9.39831573e-14F, 3.08466475e+32F,
+  1.2098238e-09F, 3.06711828e+29F, 2.00861797e+19F, 7.09253376e+17F,
+  3.19708462e-22F, 5.00996717e-26F, 3.75198655e-36F, 8.79424602e-25F,
+  7.50765317e+12F, 1.28318616e-33F, 1.75614176e-20F, 205097.594F,
+  1.01861726e-26F, 1.68350983e-13F, 3.74222366e-21F, 3.98204999e+13F,
+  1.67411716e-29F, 1.0706074e+38F, 52641160.0F, 2.56475905e+16F,
+  16268.4727F, 1.12551785F, 9.77315117e+35F, 1.38190557e+30F,
+  4.84701113e+24F, 3.05183344e-36F, 10479648.0F, 6.12722446e+33F,
+  5.35335895e+10F, 16.0037651F, 3.93222455e+11F, 4.6699476e-25F,
+  3.32969882e+17F, 6.01544226e+21F, 4.64695141e-33F, 9.15242863F,
+  28499244.0F, 9.33743187e-12F, 1.0627452e+14F, 1.92587667e+32F,
+  1.22667128e+31F, 4.04860615e-15F, 5.6252531e-27F, 1.30797067e+27F,
+  532982880.0F, 1.82373862e+25F, 1.80351214e+28F, 2.84840603e-17F,
+  7225404.0F, 1.8280826e-15F, 6.71419646e+22F, 5.97033874e+14F,
+  2.42303884e-20F, 1.68728912F, 23570350.0F, 8.45797427e-21F,
+  1.21904746e-24F, 0.0181610044F, 4.95950213e-33F, 0.70687288F,
+  4.53215543e+33F, 9.83461758e+24F, 2.21098847e-34F, 9.4360924e+24F,
+  4.65567282e+16F, 1.09354076e+16F, 1.79206926e-36F, 9.32780717e+19F,
+  1.17387757e-23F, 1.7738272e+23F, 5.28439055e-14F, 1.20783564e-10F,
+  2.03401782e-25F, 1.42667367e+28F, 1.18782025e-21F, 3.56271195e+28F,
+  18.4797192F, 3.17889548e-27F, 1.02111524e+12F, 364.420105F,
+  1.86720003e-36F, 6.46341803e+24F, 6.40713837e-18F, 1.07343776e-36F,
+  2.89119802e+20F, 2.97561656e+17F, 3.43522499e-09F, 2.33871344e-24F,
+  183.93895F, 6106012.5F, 4.15271664e+14F, 0.265915006F,
+  236071.516F, 9.92828506e+16F, 4.28769252e-24F, 8.73483395e-25F,
+  0.108592972F, 3.40255792e+19F, 1.70014309e+23F, 1.17860985e+27F,
+  3.77367032e-05F, 2.87050982e+16F, 1.92230754e-30F, 5.72464609e-09F,
+  1.96283e-33F, 5.01091875e+25F, 1.587188e+38F, 1.29434166e+13F,
+  2.53540476e+19F, 3.2093786e-10F, 4.27361881e+22F, 4.7659625e-32F,
+  2.42214082e-10F, 7.56719427e-12F, 7.52739728e+27F, 2.30928849e-25F,
+  2.04610258e-26F, 1.02358498e-31F, 1.88288776e+26F, 1.54156913e-14F,
+  7.11775991e+30F, 1.01102039e-14F, 6.4207845e+25F, 1.07730916e-23F,
+  6.41595308e+30F, 1.64458048e+36F, 9.42949011e+28F, 6.30477979e+14F,
+  2.19177949e+30F, 5.08836974e+31F, 2.92933197e+35F, 1.40820336e-17F,
+  6.44343516e+26F, 2.966782e+21F, 3.1842235e-12F, 9.97373852e-26F,
+  3.8953636e+30F, 0.0131201288F, 320.065796F, 3.94246652e+29F,
+  0.0975630283F, 2.55079004e-19F, 2.2432584e+14F, 472.273346F,
+  8.29841404e-18F, 6.50042562e+14F, 8.39714313e+30F, 8.11400074e-20F,
+  9.68879132e+23F, 3.13414096e+19F, 83.9981461F, 8.0501654e-24F,
+  5.64621843e+12F, 4.01752458e-17F, 1.88749743e-19F, 1.19641693e+27F,
+  6.05462046e-18F, 1.75502024e-31F, 2.98268781e+26F, 6.72483421e+37F,
+  2.65874897e-15F, 9.88136932e-08F, 3991.85474F, 2.71096598e+19F,
+  1.39474353e-37F, 2.89598079e+11F, 9.44221338e-21F, 6.7083932e+32F };
+
+RT_LOCAL_DATA static const float log_x[N_ELEM] = {
+  7.56545251e-06F, 4.5188989e+26F, 0.00102139683F, 2.0083639e+09F,
+  1.87487655e-28F, 1.44916791e-18F, 5.94974428e-13F, 1.44171626e-08F,
+  2.42294789e-20F, 1.83697757e-05F, 1.9370514e-25F, 9469.27148F,
+  5.97374756e+27F, 2.70019058e+21F, 20746106.0F, 8.03075822e+28F,
+  5.14397412e+13F, 113068048.0F, 0.00274651614F, 8.71443918e-26F,
+  3.91076343e+23F, 5.9142344e+23F, 1.95087338e+18F, 2.17398395e+11F,
+  5.76991047e+18F, 3.27019953e+27F, 2.07849861e+28F, 1.53750552e+16F,
+  9.46930928e-30F, 6.91802488e+26F, 11574.6748F, 0.00134225946F,
+  7.23305347e-05F, 1.67982778e-14F, 1.10473966e-28F, 12596884.0F,
+  11264826.0F, 1.5301694e-25F, 2.35872614e+25F, 1.61518048e+24F,
+  7.6219635e+21F, 175.38739F, 1.24116013e-07F, 0.0169420019F,
+  1.72134715e-08F, 2.15316639e+27F, 1.44490844e+25F, 8.18071739e+23F,
+  15.3773136F, 4.57738972F, 1.69171665e+11F, 2.26413005e-13F,
+  1.11513705e-19F, 1.24658565e+29F, 1.49895067e-14F, 1.62115974e-14F,
+  0.345809162F, 1.97835554e-25F, 26.4876213F, 4.10604176e-21F,
+  5.59463534e+19F, 8.17159256e-26F, 1.32549961e+18F, 1.32879767e-14F,
+  1.90923357e+17F, 1.10377918e+18F, 2.10346555e+27F, 2.97686664e-20F,
+  1.20451192e+29F, 7.59199685e-22F, 1.17804178e-09F, 2.76065318e-30F,
+  0.435947567F, 8.27965418e-26F, 2158.63965F, 9.67816637e+25F,
+  8.00240626e+16F, 731351936.0F, 2.7718568e-25F, 1.54188694e+29F,
+  7.68510766e-09F, 9.28023302e+26F, 5.58163948e-22F, 8.72606132e-13F,
+  7.29634989e+26F, 6.59653222e+14F, 1.51922886e-19F, 0.00285911723F,
+  348.431091F, 1.29300109e-15F, 1.30012121e-17F, 1.07855577e-25F,
+  3.688133F, 8.94475215e-06F, 9.91645654e-10F, 0.05979231F,
+  6.23781193e-10F, 1.51062167e-07F, 6.7530313e+15F, 7.78583398e-22F,
+  5.33559977e-25F, 0.000654896721F, 2.39341072e-13F, 0.0320813432F,
+  3.83940144e+21F, 5.94188369e+26F, 1.00587249e+19F, 1.72897608e+25F,
+  6.89294898e-17F, 5.96589778e-10F, 4.99650298e-24F, 2.40337671e-13F,
+  4.33546995e-15F, 2.44977625e-16F, 1.01516219e-10F, 2.69076698e+26F,
+  8.20464039F, 9.58295961e+23F, 43.4557419F, 8.58884743e+14F,
+  1.59417016e+10F, 358337.5F, 2.90269064e+25F, 437864.188F,
+  1.62632775F, 5.8181866e-17F, 8.72528084e-25F, 5.38951426e-05F,
+  2.35308062e-06F, 6.8108067e-23F, 1.40203135e+27F, 1.14398922e-29F,
+  0.000304148125F, 6.29572643e-16F, 3.15676743e-06F, 1.58694396e+20F,
+  6.75632633e+27F, 8.15292935e-07F, 5.2389966e+12F, 3.5214539e+23F,
+  2.58920327e-13F, 6.35367826e-07F, 0.000101149766F, 1.62843442e+20F,
+  1.56168438e-12F, 6.20790656e+23F, 1.32181652e-19F, 7.10913802e+10F,
+  70872552.0F, 1.09040267e-28F, 4.31119099e-11F, 1.35558182e+20F,
+  1.29597788e-06F, 2.70674817e-27F, 0.0160016734F, 282.868713F,
+  0.0147732282F, 1.82666099e-05F, 1.94644694e+26F, 1.76371343e+10F,
+  0.000445078738F, 0.000646870001F, 1.52553738e+16F, 1.97500925e-16F,
+  0.0835708529F, 4.19280345e+15F, 2.63027722e-25F, 7.55194442e-22F,
+  1.11571702e-27F, 1.54147697e+10F, 1.01014525e+18F, 5.09227213e+09F,
+  15742940.0F, 8.01374214e-29F, 6.80429402e-09F, 0.00555329816F,
+  1.61199068e-10F, 1.0452484e-15F, 1.93757597e-08F, 4.39668102e-17F,
+  1.58952653e-26F, 18573.5293F, 2.9047384e-29F, 0.000100963858F,
+  1.25304121e-06F, 4.16779778e+18F, 2.36284464e+12F, 0.00323234405F,
+  2.32044597e-30F, 5.06036958e+12F, 2.68701291e+13F, 187524688.0F,
+  2.72646433e+29F, 0.323611677F, 5.62693003e-07F, 114.299194F,
+  1.92697164e-24F, 39051412.0F, 8.32215438e-23F, 1.49411564e+10F,
+  5165660.0F, 1.22386981e+11F, 1.17733004e-19F, 5.49543792e+12F,
+  3.81826536e+26F, 1.38420439e+29F, 8.19930087e+15F, 2.77416405e-21F,
+  2.84451131e+16F, 4.31403027e-20F, 5.98916632e+28F, 8.53605735e-29F,
+  1.00917924e-29F, 1.29458942e-06F, 4.77268705e-26F, 1.39520193e+27F,
+  6.60429962e+25F, 3.79957e-15F, 1.50185365e+22F, 9.92060989e-10F,
+  1.22582473e+19F, 2.98524593e-23F, 2.79809511e+26F, 0.000537000597F,
+  1.44044848e-16F, 0.000497586967F, 1.19358013e-30F, 1.70602787e-28F,
+  0.030586537F, 588859.0F, 6.39292592e+29F, 18.6611366F,
+  1.44177031e-10F, 4.85598271e-15F, 1.85209491e-29F, 9.43477634e+24F,
+  9.28990036e+11F, 7.33143523e-15F, 2.41968176e+15F, 2.58366325e+11F,
+  224133344.0F, 0.00133343739F, 1.66975235e+22F, 3.66715784e+25F,
+  3.11237382e+15F, 1.38026924e-19F, 0.000686209591F, 437595520.0F,
+  1.2740781e+27F, 2.03137374F, 0.0841202438F, 1.20880908e-26F,
+  7.28423144e-27F, 1.29787284e-14F, 3.82809539e+10F, 7.48706401e-18F };
+
+RT_LOCAL_DATA static const float log_ref[N_ELEM] = {
+  -11.7919188F, 61.3754807F, -6.88658428F, 21.4205856F,
+  -63.8438416F, -41.0755424F, -28.1502571F, -18.0548458F,
+  -45.1667175F, -10.9048042F, -56.9034615F, 9.1558075F,
+  63.9571724F, 49.3476105F, 16.8478699F, 66.5556641F,
+  31.5714321F, 18.5435009F, -5.89742184F, -57.7022324F,
+  54.3231888F, 54.7368202F, 42.1148071F, 26.1049976F,
+  43.1991882F, 63.3546486F, 65.2040253F, 37.2715225F,
+  -66.8294983F, 61.801342F, 9.35657501F, -6.61340094F,
+  -9.53426456F, -31.7175007F, -64.3727722F, 16.3489609F,
+  16.237196F, -57.1392479F, 58.4227486F, 55.7414894F,
+  50.3853226F, 5.16699696F, -15.9020491F, -4.07795954F,
+  -17.877573F, 62.9367371F, 57.9326744F, 55.0612373F,
+  2.73289323F, 1.52112889F, 25.8541794F, -29.116415F,
+  -43.6401405F, 66.9953766F, -31.8314266F, -31.7530499F,
+  -1.06186819F, -56.8823624F, 3.27667761F, -46.9418259F,
+  45.4709244F, -57.7665482F, 41.7283211F, -31.9519176F,
+  39.7906494F, 41.5452728F, 62.9133835F, -44.9608307F,
+  66.9610443F, -48.629776F, -20.559412F, -68.062088F,
+  -0.830233276F, -57.7534103F, 7.6772337F, 59.8344994F,
+  38.9211044F, 20.4104061F, -56.5451088F, 67.2079773F,
+  -18.6839809F, 62.0951004F, -48.9373894F, -27.767292F,
+  61.8545876F, 34.1227341F, -43.3309135F, -5.85724258F,
+  5.85344028F, -34.2818108F, -38.8814888F, -57.489006F,
+  1.30512035F, -11.624444F, -20.7316551F, -2.81687832F,
+  -21.1952209F, -15.705574F, 36.4487686F, -48.6045647F,
+  -55.8902245F, -7.33103323F, -29.0608864F, -3.43948054F,
+  49.699604F, 61.6492386F, 43.7549706F, 58.1121559F,
+  -37.2134476F, -21.2397919F, -53.6533051F, -29.0567322F,
+  -33.0719452F, -35.9453659F, -23.0108032F, 60.8570404F,
+  2.10469985F, 55.2194443F, 3.77174306F, 34.3866577F,
+  23.4922047F, 12.7892303F, 58.6302643F, 12.9896641F,
+  0.486324549F, -37.3829575F, -55.3984032F, -9.82847023F,
+  -12.9597855F, -51.040947F, 62.5077209F, -66.6404495F,
+  -8.09799576F, -35.0014915F, -12.6659622F, 46.5135117F,
+  64.0802765F, -14.0197182F, 29.2871513F, 54.2183304F,
+  -28.9822559F, -14.269062F, -9.19890785F, 46.5393219F,
+  -27.185257F, 54.7852821F, -43.470108F, 24.9872322F,
+  18.0763931F, -64.3858337F, -23.8672218F, 46.3559341F,
+  -13.5562449F, -61.1740494F, -4.13506174F, 5.64498281F,
+  -4.21493864F, -10.9104357F, 60.5332184F, 23.5932732F,
+  -7.71725941F, -7.34336519F, 37.26371F, -36.1607895F,
+  -2.48206043F, 35.9721451F, -56.597538F, -48.635067F,
+  -62.0602989F, 23.4585915F, 41.4566269F, 22.3509903F,
+  16.5719032F, -64.6938095F, -18.8057117F, -5.19336319F,
+  -22.5483818F, -34.4945221F, -17.759243F, -37.6630974F,
+  -59.4037781F, 9.82949257F, -65.7086258F, -9.20074749F,
+  -13.5899372F, 42.8739204F, 28.4908867F, -5.73454762F,
+  -68.2357941F, 29.2524605F, 30.9220371F, 19.0494213F,
+  67.777977F, -1.12821102F, -14.3905315F, 4.7388196F,
+  -54.6060944F, 17.4803886F, -50.8405342F, 23.4273853F,
+  15.4575434F, 25.5304546F, -43.5858688F, 29.33494F,
+  61.2070084F, 67.10009F, 36.6428261F, -47.3339386F,
+  37.8867531F, -44.5898285F, 66.2623367F, -64.6306686F,
+  -66.765831F, -13.5573168F, -58.3043022F, 62.5028381F,
+  59.4523468F, -33.2038879F, 51.0635719F, -20.7312374F,
+  43.9527321F, -51.8657761F, 60.8961525F, -7.52951145F,
+  -36.4764061F, -7.60574007F, -68.9005966F, -63.9382133F,
+  -3.48719525F, 13.2859421F, 68.6301575F, 2.9264431F,
+  -22.6599789F, -32.9585648F, -66.1586533F, 57.506443F,
+  27.5573635F, -32.5466042F, 35.4224129F, 26.2776451F,
+  19.2277508F, -6.61999512F, 51.169548F, 58.8640442F,
+  35.6741638F, -43.4268379F, -7.28432751F, 19.8968048F,
+  62.4120216F, 0.70871228F, -2.47550797F, -59.677578F,
+  -60.1840858F, -31.9754639F, 24.3682175F, -39.4333534F };
+
+RT_LOCAL_DATA static const float sc_x[N_ELEM] = {
+  50.977047F, 28.5794048F, -42.6277313F, 4.41594744F,
+  66.8901367F, -93.7418289F, 25.341362F, 50.4180222F,
+  93.3052597F, -33.5292931F, 27.4509087F, 61.1678619F,
+  -39.3786926F, 55.0476608F, 49.9597969F, 90.3047409F,
+  -17.1075611F, -78.1630173F, 3.30882549F, 35.5851898F,
+  82.7682571F, 51.2603226F, 9.42977905F, 71.1285782F,
+  70.1183167F, 22.4180717F, -45.6555252F, -98.0596008F,
+  17.2387638F, -97.3363266F, -29.7809429F, 97.9010239F,
+  -48.3332939F, 37.803688F, 46.9577904F, -35.2656517F,
+  20.3326817F, 77.1346588F, 44.9163857F, -33.0203476F,
+  98.9273453F, 34.1606941F, -51.9580612F, 61.6139755F,
+  56.7450523F, 75.4797745F, 67.2970276F, 59.3393784F,
+  -21.8051395F, 51.19627F, 52.9280777F, 64.4672165F,
+  -56.9764938F, 97.283287F, 15.1182852F, 81.742218F,
+  3.39950609F, 56.1088104F, 20.8193207F, -41.8084679F,
+  -1.89492476F, 64.3179779F, -44.1638756F, 84.9406738F,
+  46.3446236F, 57.6007462F, 5.4682169F, 41.7097321F,
+  27.0861664F, -16.9337082F, -99.616951F, 12.1301928F,
+  38.065937F, 10.9473648F, -19.8813438F, 9.49300385F,
+  -79.0614471F, 28.8309631F, -86.7922134F, -73.6332703F,
+  -84.0989685F, 90.5220413F, 81.7015381F, 25.2570343F,
+  87.5255432F, -58.1034393F, 32.4127426F, -5.24102974F,
+  -78.4581451F, 15.4756212F, -77.923027F, -43.9164467F,
+  -71.4780502F, -50.8821869F, 79.3356934F, -1.2957958F,
+  9.89702702F, -71.1146774F, -69.5670547F, -78.9198303F,
+  40.26968F, 15.7132463F, 48.3654633F, 17.2458897F,
+  -49.7869301F, -20.2930832F, -26.6376896F, 85.3463821F,
+  40.584343F, 66.4880905F, 31.5496826F, 92.4930496F,
+  52.917923F, -99.9340744F, -83.947937F, -92.2587585F,
+  78.7020569F, -57.9955788F, -7.47595692F, 16.9080296F,
+  -55.1865616F, -44.8001328F, 76.6391983F, -63.4186249F,
+  66.3478622F, -6.24092531F, 37.8539467F, -21.5228367F,
+  35.6991234F, 40.8938179F, -15.4549885F, -40.1278496F,
+  -14.0932703F, 49.1044502F, -97.8265076F, -58.5414505F,
+  -29.8519344F, 39.4242783F, 1.73006117F, -55.0181656F,
+  75.7364807F, 14.9592352F, 77.9669418F, -24.0251484F,
+  90.090683F, 16.1942959F, -30.8030834F, -69.2430496F,
+  60.094635F, -65.1360779F, 64.34021F, 62.3627777F,
+  -73.5448608F, 45.5679474F, 40.2244339F, -81.3474884F,
+  51.8494148F, 89.9410782F, -32.873745F, 6.00297689F,
+  -17.8988953F, -52.2780037F, -67.7664108F, 32.8523178F,
+  93.5046387F, -74.6210785F, -95.6718674F, 8.14082241F,
+  -46.9330521F, 73.6495438F, -41.295681F, -95.4321671F,
+  -37.9422379F, -17.9143047F, -13.4376955F, -17.9760723F,
+  -43.0230865F, 92.64711F, -97.2402649F, -55.2851868F,
+  63.972187F, -59.7132416F, -58.035656F, -21.8477192F,
+  26.4370747F, 64.8733597F, 57.4157753F, -64.583519F,
+  86.3998642F, -64.998558F, 61.4292412F, 71.8475418F,
+  -76.9205933F, -24.288887F, -57.4592247F, -7.83099604F,
+  56.4556732F, 60.5711517F, 51.5056038F, -94.0298615F,
+  -42.0674095F, 84.6152802F, 47.4707794F, 52.5934868F,
+  -65.1977005F, -68.8224792F, -2.16374183F, 21.9605465F,
+  -75.0783463F, 74.9307938F, 14.5461025F, 85.586647F,
+  81.2734985F, -20.0277481F, -44.8685341F, 67.2686234F,
+  -0.506600261F, 20.0777702F, 44.123394F, 95.5811081F,
+  2.96166968F, -8.27240753F, 71.4188004F, -84.6927109F,
+  -12.322011F, -56.115387F, 22.1766434F, 64.4513474F,
+  -14.8116636F, -58.4874191F, -75.7776031F, 80.2241516F,
+  17.0858269F, 87.078186F, -46.2732925F, -42.8780365F,
+  -64.0480804F, 27.5359077F, 12.2566366F, 71.3026428F,
+  17.8253059F, -33.144146F, -79.4832535F, 57.1883621F,
+  89.6618729F, -34.3797112F, -37.5546494F, 5.0876112F,
+  -24.9334564F, 48.9133301F, -3.91516113F, -3.46388483F,
+  -24.4784222F, -49.8544579F, 84.6288681F, 88.715126F };
+
+RT_LOCAL_DATA static const float sin_ref[N_ELEM] = {
+  0.653019428F, -0.300360858F, 0.976713121F, -0.956382036F,
+  -0.793592632F, 0.484639227F, 0.207110777F, 0.151948825F,
+  -0.809041739F, -0.856384397F, 0.733478308F, -0.995660484F,
+  -0.994088829F, -0.997565687F, -0.300947011F, 0.718362808F,
+  0.985381305F, -0.367945969F, -0.166454434F, -0.85609746F,
+  0.885164857F, 0.838671923F, -0.00500107091F, 0.903579712F,
+  0.843237698F, -0.414072096F, -0.994758427F, 0.621165156F,
+  -0.999200284F, -0.0530207902F, 0.997940719F, -0.489618003F,
+  0.935405493F, 0.104385696F, 0.165336728F, 0.650416434F,
+  0.996159375F, 0.986313224F, 0.804057479F, -0.999434769F,
+  -0.999461353F, 0.386492074F, -0.992593706F, -0.938367844F,
+  0.195124686F, 0.0814604238F, -0.969597816F, 0.343726248F,
+  -0.184938252F, 0.802090526F, 0.460889667F, 0.997916281F,
+  -0.414893806F, 0.10588634F, 0.556093514F, 0.0607715547F,
+  -0.255063564F, -0.425810397F, 0.921462238F, 0.823619306F,
+  -0.947928667F, 0.996417522F, -0.180582285F, -0.11740081F,
+  0.702757597F, 0.86845547F, -0.727703929F, -0.763701499F,
+  0.927686334F, 0.94105804F, 0.791960895F, -0.422478259F,
+  0.358653665F, -0.998838127F, -0.858218074F, -0.0681729689F,
+  0.498294711F, -0.528327286F, 0.921676874F, 0.981210649F,
+  -0.662411451F, 0.551486909F, 0.0201277342F, 0.123973288F,
+  -0.425080746F, -0.999871612F, 0.839746416F, 0.863493443F,
+  -0.0815804377F, 0.230257273F, -0.57841903F, 0.0658028871F,
+  -0.702269793F, -0.578349829F, -0.714477479F, -0.962425053F,
+  -0.454890311F, -0.909447551F, -0.436780274F, 0.370933443F,
+  0.540494263F, -0.00528305303F, -0.94629389F, -0.999459803F,
+  0.460494667F, -0.991912246F, -0.997832835F, -0.499810964F,
+  0.253562689F, -0.492225677F, 0.133357599F, -0.983131826F,
+  0.46987763F, 0.56207335F, -0.76758492F, 0.913811386F,
+  -0.161529735F, -0.992336035F, -0.929395497F, -0.932063103F,
+  0.978303134F, -0.729667544F, 0.946100116F, -0.553675711F,
+  -0.365729541F, 0.0422474183F, 0.154216915F, -0.451380581F,
+  -0.909302235F, -0.0530884378F, -0.250285178F, -0.65399617F,
+  -0.99903667F, -0.917214811F, 0.423345894F, -0.912277162F,
+  0.999976873F, 0.988108575F, 0.987344146F, 0.999188304F,
+  0.331843376F, 0.680707574F, 0.542049885F, 0.894625723F,
+  0.849746346F, -0.467386872F, 0.575195491F, -0.127661914F,
+  -0.393443882F, -0.742883682F, 0.998051286F, -0.452061713F,
+  0.960343003F, 0.999889672F, 0.577995837F, 0.32774958F,
+  0.999913752F, 0.918831289F, -0.993624806F, -0.276555926F,
+  0.81379962F, -0.904015601F, 0.975421846F, 0.990981221F,
+  -0.676604092F, 0.701247036F, -0.989257574F, 0.959142506F,
+  -0.1896815F, -0.984220386F, 0.439441204F, -0.926268399F,
+  -0.24073787F, 0.804748237F, -0.765182614F, 0.766570628F,
+  0.81873858F, -0.9995538F, -0.148555472F, 0.95314914F,
+  0.908772886F, 0.0229791366F, -0.99649018F, -0.142938122F,
+  0.964708328F, 0.891246378F, 0.762460589F, -0.983687639F,
+  -0.999981582F, -0.827638865F, -0.985890329F, 0.397773862F,
+  -0.998827636F, 0.747210145F, -0.789845407F, -0.999735832F,
+  -0.092860572F, -0.771306455F, 0.945823371F, 0.216197491F,
+  0.941382408F, 0.206230909F, -0.339974344F, 0.726756632F,
+  -0.700248301F, 0.288403571F, -0.829298317F, 0.0305973049F,
+  0.314450204F, -0.450593382F, 0.917544603F, -0.691559196F,
+  -0.396692097F, -0.923915863F, -0.774697721F, -0.962257028F,
+  -0.485207319F, 0.941890478F, 0.140629157F, 0.971936762F,
+  0.178953782F, -0.913729668F, 0.743193448F, -0.12992245F,
+  0.241935015F, 0.419850677F, -0.184432864F, 0.998814464F,
+  -0.781021357F, -0.933064878F, -0.370344132F, -0.993561387F,
+  -0.981446147F, -0.774806082F, -0.751674473F, 0.893131852F,
+  -0.937796235F, 0.67312485F, -0.304805309F, 0.815728903F,
+  -0.854324639F, -0.98763454F, 0.809580505F, 0.596950233F,
+  0.992011786F, -0.176872596F, 0.143960536F, -0.93042618F,
+  0.197968349F, -0.976192474F, 0.698692679F, 0.316741556F,
+  0.608619094F, 0.399548799F, 0.192916423F, 0.682027757F };
+
+RT_LOCAL_DATA static const float cos_ref[N_ELEM] = {
+  0.757341146F, -0.953825653F, 0.214549437F, -0.292118818F,
+  -0.608449459F, 0.874714136F, 0.978317499F, 0.98838836F,
+  0.58775121F, -0.516338766F, -0.679712892F, -0.0930599645F,
+  -0.108570024F, 0.069732748F, 0.953640878F, -0.695668638F,
+  -0.170363441F, -0.929847181F, -0.986049175F, -0.516814411F,
+  0.465277582F, 0.544636965F, -0.999987483F, -0.428420037F,
+  0.537540853F, -0.910244107F, -0.102252699F, -0.783679724F,
+  -0.039985124F, -0.99859339F, -0.0641432256F, -0.871937037F,
+  -0.353576869F, 0.994536877F, -0.986237168F, -0.75957787F,
+  0.0875583291F, -0.164882421F, 0.594551563F, -0.033618398F,
+  -0.0328174196F, -0.922292709F, -0.121481635F, 0.345638156F,
+  0.980778456F, 0.996676564F, -0.244704068F, -0.939069867F,
+  -0.982750118F, 0.59720248F, -0.88745743F, -0.0645222366F,
+  0.90986985F, -0.994378269F, -0.831119716F, 0.99815172F,
+  -0.96692431F, 0.904812396F, -0.388467997F, -0.567143083F,
+  -0.318482727F, 0.0845703557F, 0.983559906F, -0.99308461F,
+  -0.711429358F, 0.495767117F, 0.68589139F, -0.645569503F,
+  -0.373360485F, -0.338245064F, 0.610571802F, 0.906373024F,
+  0.933470726F, -0.0481908098F, 0.51328522F, -0.997673512F,
+  -0.867007732F, -0.849040806F, 0.387958407F, -0.192939535F,
+  -0.749140203F, -0.834183574F, 0.999797404F, 0.99228555F,
+  0.90515542F, 0.0160240754F, 0.542978764F, 0.504360139F,
+  -0.996666789F, -0.973129809F, -0.81573981F, 0.997832656F,
+  -0.711910903F, 0.815788865F, -0.699658453F, 0.271547437F,
+  -0.890547454F, -0.415818602F, 0.8995682F, -0.928659439F,
+  -0.841347694F, -0.999986053F, -0.323307723F, -0.0328640118F,
+  0.88766247F, 0.126925766F, 0.0658003911F, -0.866134524F,
+  -0.967318952F, -0.870467603F, 0.991068006F, -0.182898283F,
+  -0.882731557F, 0.827087343F, -0.640947223F, -0.406138837F,
+  -0.986867845F, 0.123568676F, 0.369085371F, -0.362295985F,
+  0.207178637F, 0.683802128F, 0.323874354F, 0.832732379F,
+  -0.930721164F, 0.999107182F, 0.98803699F, -0.892331541F,
+  -0.416136354F, -0.998589814F, -0.968172133F, -0.75649786F,
+  0.0438825414F, 0.398392975F, -0.90596813F, -0.409573406F,
+  0.00680417148F, -0.153757706F, -0.158592403F, 0.0402832478F,
+  0.94333452F, -0.73255527F, -0.840346336F, 0.446816325F,
+  -0.527191758F, -0.884052873F, 0.818015993F, 0.991817772F,
+  -0.919348657F, -0.66942054F, 0.0623988733F, 0.891986668F,
+  -0.27882129F, -0.0148533648F, -0.816039681F, 0.944764614F,
+  -0.0131356632F, -0.394650608F, 0.112737708F, 0.96099782F,
+  0.581145585F, -0.427499443F, 0.220345616F, 0.134000748F,
+  0.73634702F, 0.712918341F, 0.14618285F, -0.28292349F,
+  -0.981845677F, -0.176946968F, -0.898271382F, 0.376864523F,
+  0.970590174F, 0.593616307F, 0.643813312F, 0.642159998F,
+  0.574166477F, -0.0298688523F, -0.988904059F, 0.302500844F,
+  0.417291015F, -0.999735951F, 0.0837100446F, -0.98973161F,
+  0.263320804F, -0.453519434F, 0.647034645F, -0.179885045F,
+  0.00606618589F, -0.561260998F, 0.167392671F, -0.917483509F,
+  0.0484078266F, 0.664587855F, 0.613305926F, 0.0229835734F,
+  0.99567914F, -0.63646394F, 0.32468152F, 0.976349652F,
+  -0.337341398F, -0.978503346F, -0.940434694F, -0.686895013F,
+  -0.713899374F, 0.957508922F, -0.558806121F, -0.999531806F,
+  0.949273944F, 0.892729282F, -0.397632897F, -0.722319841F,
+  0.917951703F, 0.382595718F, 0.632331729F, -0.272142351F,
+  0.874399126F, 0.335920185F, 0.990062356F, 0.235242292F,
+  -0.983857453F, -0.406322658F, -0.669076622F, -0.99152416F,
+  0.970292449F, 0.907593191F, -0.982845128F, -0.0486787073F,
+  -0.624504268F, -0.359708101F, 0.928894639F, 0.11329516F,
+  -0.191738024F, 0.632198989F, -0.659534335F, 0.449794888F,
+  0.347186178F, -0.739528894F, 0.952414691F, -0.578434408F,
+  0.519739807F, -0.156773701F, -0.587008834F, 0.802278221F,
+  -0.126145273F, -0.984233737F, 0.989583433F, 0.366479307F,
+  0.980208397F, 0.216906056F, -0.715421975F, -0.948511899F,
+  0.793462515F, 0.916711926F, -0.981215179F, 0.731326342F };
+
+RT_LOCAL_DATA static const float at_y[N_ELEM] = {
+  -5.80422306F, -2.48229384F, 4.37930441F, -2.92562556F,
+  -1.16873121F, 1.28412616F, -4.59140015F, -2.25211F,
+  4.36535263F, 8.78294373F, -8.70497513F, 7.52134371F,
+  -8.25868893F, 3.16223407F, -8.94819546F, 0.905652344F,
+  -5.42487144F, 6.17616272F, -9.58831596F, 0.242847502F,
+  9.2176075F, 0.630476952F, -1.15827858F, 2.97721243F,
+  5.88146591F, 3.71096182F, -1.67898786F, -5.89239311F,
+  5.65276432F, 0.0692951828F, 9.13083553F, -3.20819759F,
+  -3.8658855F, -0.679815829F, 9.7604866F, 5.57932568F,
+  -4.11097622F, 3.84833622F, 6.46088314F, -8.85698318F,
+  4.92964363F, -0.505346477F, 7.63591576F, 5.01330662F,
+  -2.67940569F, -8.37631989F, -1.89327478F, -2.39482307F,
+  -5.92422056F, 3.75757742F, 7.27467537F, -1.1268425F,
+  -7.68329239F, 1.1879431F, -3.19704175F, -9.12250423F,
+  -8.05680466F, -2.22372651F, -9.30865955F, -7.37577105F,
+  8.91624832F, 0.675691843F, -6.31039953F, -9.16819763F,
+  -4.27115345F, -3.53076172F, 8.84518051F, -6.31071138F,
+  8.40489578F, 0.0518726073F, 6.11560965F, 1.16489518F,
+  9.19027996F, 9.1994791F, 2.41687584F, -3.23971677F,
+  -4.05462074F, -6.72831297F, -5.40979958F, 2.24208808F,
+  -1.6629535F, 0.801603734F, 9.0424633F, 4.62857342F,
+  8.67645645F, 5.30223465F, -5.06826496F, -9.15676308F,
+  4.00017548F, -7.06521368F, 3.11378479F, -8.27921104F,
+  1.58669794F, 0.556320965F, -0.821731448F, 6.18216658F,
+  3.99278021F, -5.58167648F, -0.152809843F, -1.69329178F,
+  -2.2586844F, -5.45981312F, -5.56729746F, 2.33157635F,
+  -8.7562685F, -1.41856313F, -0.0556591973F, -0.783203185F,
+  3.83006763F, 6.09906626F, 0.756229341F, -6.75217295F,
+  -6.4603529F, 8.66337967F, -0.659199297F, -0.224484399F,
+  -5.61639786F, 2.6014204F, -2.39578414F, 1.36735094F,
+  1.06944728F, 8.23306179F, 5.52124119F, 8.26063347F,
+  7.46607018F, -8.16639328F, 2.28676033F, -4.53638458F,
+  -3.17053413F, 0.27850458F, 0.431470603F, 1.59975088F,
+  -1.23249066F, -7.84790421F, 9.6731739F, -9.27003574F,
+  8.92884922F, 9.75058365F, 3.30376887F, -5.77964783F,
+  4.03471851F, -3.32444215F, -2.81694674F, 6.97218418F,
+  4.50886297F, -9.51620579F, 8.84144306F, -2.14241195F,
+  -4.02880478F, -2.24086738F, -5.8996501F, -1.45583475F,
+  6.80221796F, 9.576231F, 6.8621707F, 2.86907911F,
+  -1.49289727F, -0.44601813F, -7.00293064F, -4.9569025F,
+  -9.06853485F, 5.5118289F, -7.9038415F, -6.42987156F,
+  -1.47420907F, 6.24241924F, -8.51631546F, 5.07817221F,
+  -4.01992941F, -1.92895317F, -0.997893512F, 9.75716019F,
+  9.89718628F, -4.71046352F, 2.00486946F, -3.45785642F,
+  -3.44359779F, 6.46300793F, 2.87920809F, 0.64131099F,
+  -3.91111493F, -2.46204948F, -0.604749322F, 6.41758871F,
+  -4.67957878F, 1.36451507F, 5.85609961F, -8.8803854F,
+  -5.4491992F, 5.26480865F, -8.60642338F, 8.92983913F,
+  -1.32732177F, 2.64081764F, -7.82107401F, -1.09950912F,
+  -0.659980118F, 5.57727242F, 1.89194739F, -7.00663996F,
+  -8.413414F, -4.78254366F, 1.65230763F, -7.69215202F,
+  -6.89533806F, -2.99283457F, -5.25158215F, 2.13902092F,
+  -5.56696367F, -5.89715195F, 5.02419567F, 2.43577576F,
+  4.79299212F, -7.09350061F, 2.55498242F, -2.43661737F,
+  -0.550084949F, -5.71559334F, 6.35348797F, 6.28363895F,
+  -0.7692191F, -2.76443815F, -5.00344896F, 0.102442287F,
+  -3.95222998F, -1.22886205F, 2.16176724F, 7.02234745F,
+  7.07800341F, -8.70334053F, 5.59954596F, -2.22672129F,
+  -7.6703577F, -0.885502398F, 7.45842028F, -2.14679098F,
+  -3.92496085F, 0.6849913F, 1.29548252F, 8.36985302F,
+  8.13939571F, 9.62986183F, -8.62905312F, 4.51935768F,
+  -0.256087512F, 1.73823059F, 6.82580471F, -4.00652838F,
+  -9.90571213F, -4.94324493F, 9.29821873F, 8.56585884F,
+  -0.730299532F, -7.31032038F, 4.82712364F, -3.75082231F };
+
+RT_LOCAL_DATA static const float at_x[N_ELEM] = {
+  7.56493807F, 0.121651761F, -4.08111954F, -8.73727131F,
+  -4.65560007F, -3.23622775F, -4.09536219F, 5.00398445F,
+  6.94152594F, 3.05939031F, -1.02766573F, 3.50688481F,
+  -9.10605145F, 0.189953446F, 0.697621226F, 2.31480837F,
+  -4.64995193F, 7.34079838F, -3.06783056F, -0.96980077F,
+  -7.58559895F, 0.374645352F, -9.93995285F, 0.603303909F,
+  -5.87266779F, 9.03044415F, -1.05839539F, -5.34449244F,
+  3.28620505F, -7.21634579F, 0.460094303F, -0.992853284F,
+  8.88325787F, 4.80188704F, 7.17564774F, 9.71431637F,
+  1.99789786F, 3.38201642F, 3.76736283F, 6.47191668F,
+  7.37039232F, 7.48654699F, 8.41629505F, 8.7482233F,
+  -6.6095891F, 5.45389748F, 4.26748657F, 7.88041973F,
+  -2.77623916F, 5.27403688F, -9.89078903F, -2.28114152F,
+  -5.45346928F, -5.15626574F, -8.31268215F, 0.280121893F,
+  -7.22174454F, -8.91911411F, 2.30444908F, 5.56130791F,
+  -3.43388319F, -9.16889F, 7.3929038F, -2.89085627F,
+  -2.25232339F, 8.04169941F, -6.97707415F, 3.08294535F,
+  -2.67057347F, 2.06297588F, -0.980177462F, -5.98419714F,
+  8.80322647F, 0.502723396F, -6.3290205F, -0.810825646F,
+  2.00019789F, 8.32851505F, -3.96881104F, -7.82963705F,
+  -0.647317588F, 6.96655035F, -9.39444256F, 8.39727879F,
+  -0.10329628F, -0.543812156F, 2.47195673F, 4.75187445F,
+  3.08719897F, 8.48088932F, 2.30813551F, -3.72322321F,
+  -1.8796562F, -1.70145488F, -5.62751722F, -3.91377831F,
+  -2.50017095F, 8.89529037F, 7.84715557F, 4.72224617F,
+  4.23093224F, -4.84699535F, -2.69540405F, -5.91513824F,
+  6.37604952F, 3.60745406F, 3.00966072F, -9.59751797F,
+  4.58163881F, 5.88853931F, 0.444515198F, 5.15639257F,
+  6.26165533F, 2.73702359F, -3.65851951F, 1.21956503F,
+  7.57500458F, -8.03378487F, 6.57955313F, -3.16012669F,
+  3.80617976F, -7.55270052F, -0.877679944F, 9.96400452F,
+  1.70339024F, -0.393253088F, -3.71620178F, -2.61108184F,
+  3.16520596F, 8.37904644F, -7.4610815F, -3.171767F,
+  -2.54304481F, -4.2031641F, 9.38284588F, 6.34405994F,
+  0.418350101F, -9.61125755F, 7.91300726F, 4.70770788F,
+  7.63891697F, -3.9411056F, -3.59050107F, -1.83330011F,
+  -1.89293408F, -0.904714644F, 9.78543854F, 7.06691551F,
+  -8.60287571F, -1.36217284F, -7.03013468F, -0.291250259F,
+  -0.956598461F, 3.31550121F, 6.88317966F, -0.435443074F,
+  7.4503994F, -6.14750433F, -3.19135141F, -7.50192213F,
+  6.45654392F, 6.28488159F, 1.70401454F, -4.42921352F,
+  -3.17644429F, -9.15023708F, 2.6033833F, -5.71249008F,
+  -5.45187521F, -4.33963251F, 5.86305332F, -4.22539711F,
+  8.74551105F, 1.60586584F, -7.58107424F, -5.55913353F,
+  9.91778564F, -0.00925884768F, 1.43757856F, -7.98474932F,
+  5.88327885F, -2.55957127F, -9.67251873F, -7.23919249F,
+  -3.66553187F, -8.21257591F, -3.8872962F, 2.92138505F,
+  -6.07105255F, 9.66938972F, 2.26739287F, 3.04086995F,
+  2.23758507F, 0.340643764F, 2.89884353F, -4.71432257F,
+  -3.12669826F, -5.53992844F, 1.0436753F, 1.28283548F,
+  6.2973876F, 4.08447361F, 7.19813538F, -1.94403327F,
+  7.34435987F, -6.82463551F, -0.322131366F, 2.70480299F,
+  -9.50785828F, -4.89093304F, -2.22936034F, 4.50098658F,
+  -1.70795178F, 9.73128033F, 3.03110003F, 6.71876478F,
+  9.65534115F, 0.447856694F, 2.25777125F, -7.88481617F,
+  1.33452451F, -4.85700035F, -2.98266697F, 0.777222931F,
+  -6.35781002F, 2.63351059F, -4.58537483F, 6.48661375F,
+  9.93215847F, -3.94824457F, -4.07585478F, -8.08424091F,
+  -9.05818558F, -7.56605196F, -5.21032572F, 3.799752F,
+  4.51385212F, -1.28922534F, -1.78973305F, -2.97691917F,
+  -6.2215991F, 9.23181248F, -7.04331589F, -1.53419733F,
+  -9.39536476F, 0.876992404F, -0.26436618F, -8.36109734F,
+  2.50574827F, 0.0202239137F, 3.99477863F, 1.06294918F,
+  -3.51601148F, 3.34700251F, -0.0682967529F, 7.42531204F };
+
+RT_LOCAL_DATA static const float atan2_ref[N_ELEM] = {
+  -0.654452026F, -1.5218277F, 2.32096434F, -2.81848288F,
+  -2.89563751F, 2.76385045F, -2.2991538F, -0.422906607F,
+  0.561381042F, 1.23560727F, -1.6883074F, 1.13450503F,
+  -2.40495372F, 1.51079905F, -1.49299145F, 0.372934431F,
+  -2.2794292F, 0.69944936F, -1.88045859F, 2.89622855F,
+  2.25937343F, 1.03463376F, -3.02558827F, 1.37086308F,
+  2.35544586F, 0.389900833F, -2.13325286F, -2.3074739F,
+  1.04420686F, 3.13199043F, 1.52044988F, -1.87092197F,
+  -0.410468072F, -0.140638024F, 0.936852098F, 0.521338522F,
+  -1.11841846F, 0.849803686F, 1.04289341F, -0.939753294F,
+  0.589508533F, -0.0673983693F, 0.736821353F, 0.520379364F,
+  -2.75645566F, -0.993641853F, -0.417561591F, -0.29502669F,
+  -2.00903058F, 0.619044185F, 2.50743628F, -2.68277121F,
+  -2.1880579F, 2.91515565F, -2.77443385F, -1.54009926F,
+  -2.30159307F, -2.8972528F, -1.3281157F, -0.924742162F,
+  1.93841529F, 3.06803155F, -0.706566036F, -1.87624228F,
+  -2.05607104F, -0.413716286F, 2.23867035F, -1.11637008F,
+  1.87844801F, 0.0251392554F, 1.7297194F, 2.9493351F,
+  0.806905568F, 1.51620364F, 2.77681088F, -1.81603539F,
+  -1.11251247F, -0.679518104F, -2.20374036F, 2.86269689F,
+  -1.94200802F, 0.114560843F, 2.37528324F, 0.503763437F,
+  1.58270109F, 1.67300177F, -1.11701095F, -1.09210634F,
+  0.913509965F, -0.694585562F, 0.932909966F, -1.99340701F,
+  2.44050884F, 2.82558203F, -2.99659705F, 2.13518167F,
+  2.13023877F, -0.560385525F, -0.0194708165F, -0.34429583F,
+  -0.490359724F, -2.29680681F, -2.02168322F, 2.76612139F,
+  -0.941413641F, -0.374657542F, -0.0184914041F, -3.06016827F,
+  0.696286559F, 0.802958429F, 1.03939223F, -0.918607354F,
+  -0.801015317F, 1.26478946F, -2.96332335F, -0.182031646F,
+  -0.637998998F, 2.82843733F, -0.34920308F, 2.73322773F,
+  0.273914039F, 2.31312156F, 1.72844148F, 0.692203641F,
+  1.3464849F, -1.61891425F, 2.58996367F, -2.09307122F,
+  -0.786239147F, 0.0332259871F, 3.0838275F, 2.6744535F,
+  -2.69029903F, -2.06249952F, 0.800632477F, -0.970642984F,
+  1.5239768F, 2.34899879F, 0.395510465F, -0.88725704F,
+  0.485936165F, -2.44086647F, -2.47634029F, 1.82792079F,
+  1.96827567F, -1.66558242F, 0.734762311F, -0.294354111F,
+  -2.70361757F, -2.11698794F, -2.44340539F, -1.76824689F,
+  1.71051049F, 1.23749125F, 0.783869743F, 1.7214179F,
+  -0.197759137F, -3.0691669F, -1.99839401F, -2.55769682F,
+  -0.952080488F, 0.719960511F, -1.35845327F, -2.17399955F,
+  -2.70706964F, 2.54290366F, -1.27412426F, 2.41491079F,
+  -2.50623822F, -2.72332454F, -0.168584839F, 1.97947073F,
+  0.847095966F, -1.24223816F, 2.88305426F, -2.5851438F,
+  -0.334191054F, 1.57222891F, 1.10771167F, 3.06144762F,
+  -0.586698711F, -2.3756125F, -3.07915139F, 2.41628289F,
+  -2.23527336F, 2.97694731F, 2.15681362F, -1.25297737F,
+  -2.4101212F, 0.498596877F, -1.31319606F, 1.24258363F,
+  -0.535399973F, 1.44251287F, -1.21584904F, -2.91246128F,
+  -2.93356729F, 2.35283542F, 1.06669426F, -1.38971341F,
+  -0.928259909F, -0.86396271F, 0.225637749F, -1.81834221F,
+  -0.753875494F, -2.72831464F, -1.63205945F, 0.669120193F,
+  -2.61189437F, -2.26319218F, 1.98841953F, 0.496034682F,
+  1.91311121F, -0.62988466F, 0.700370848F, -0.347907096F,
+  -0.056910567F, -1.49259913F, 1.2293551F, 2.46872711F,
+  -0.522885323F, -2.62415409F, -2.10835958F, 0.131050125F,
+  -2.58541751F, -0.436592996F, 2.70104623F, 0.825035036F,
+  0.619155586F, -1.99667895F, 2.19999647F, -2.87281775F,
+  -2.43896651F, -3.0250864F, 2.1805706F, -0.514272809F,
+  -0.715727448F, 2.65320396F, 2.51504445F, 1.91251481F,
+  2.22343779F, 0.806498647F, -2.25535727F, 1.89806187F,
+  -3.11434269F, 1.10352993F, 1.60950744F, -2.69473362F,
+  -1.32303381F, -1.56670511F, 1.16501188F, 1.44733608F,
+  -2.93679786F, -1.1414367F, 1.58494389F, -0.467751175F };
+
+RT_LOCAL_DATA static float out0[N_ELEM];
+RT_LOCAL_DATA static float out1[N_ELEM];
+
+static const char *funcNames[N_FUNCS] = { "exp", "log", "sincos", "atan2" };
+
+/////////////////////////////////////////////////////////
+// subfunctions
+/////////////////////////////////////////////////////////
+
+// distance in ulps, negative floats mapped below the positive ones
+static int ulpDiff(float a, float b)
+{
+  int ia = *((int*) &a);
+  int ib = *((int*) &b);
+  int d;
+
+  if (fIsNan(a) || fIsNan(b))
+    return 0x7fffffff;
+
+  if (ia < 0)
+    ia = MATH_SGN_MASK - ia;
+  if (ib < 0)
+    ib = MATH_SGN_MASK - ib;
+
+  d = ia - ib;
+  return (d < 0) ? -d : d;
+}
+
+// batch function f over all the elements on cores 0..nc-1, cycles on core 0
+static int runBatch(int f, int nc)
+{
+  int cycles = 0;
+
+  synch_barrier();
+
+  if (get_core_id() == 0)
+  {
+    reset_timer();
+    start_timer();
+  }
+
+  if (get_core_id() < nc)
+  {
+    switch (f)
+    {
+      case 0:  fExpv(exp_x, out0, N_ELEM, nc);            break;
+      case 1:  fLogv(log_x, out0, N_ELEM, nc);            break;
+      case 2:  fSinCosv(sc_x, out0, out1, N_ELEM, nc);    break;
+      default: fAtan2v(at_y, at_x, out0, N_ELEM, nc);     break;
+    }
+  }
+
+  synch_barrier();
+
+  if (get_core_id() == 0)
+  {
+    stop_timer();
+    cycles = get_time();
+  }
+
+  return cycles;
+}
+
+// same with the scalar function, one core
+static int runScalar(int f)
+{
+  int i;
+
+  reset_timer();
+  start_timer();
+
+  switch (f)
+  {
+    case 0:
+      for (i = 0; i < N_ELEM; i++)
+        out0[i] = fExp(exp_x[i]);
+      break;
+    case 1:
+      for (i = 0; i < N_ELEM; i++)
+        out0[i] = fLog(log_x[i]);
+      break;
+    case 2:
+      for (i = 0; i < N_ELEM; i++)
+      {
+        out0[i] = fSin(sc_x[i]);
+        out1[i] = fCos(sc_x[i]);
+      }
+      break;
+    default:
+      for (i = 0; i < N_ELEM; i++)
+        out0[i] = fAtan2(at_y[i], at_x[i]);
+      break;
+  }
+
+  stop_timer();
+  return get_time();
+}
+
+// max error of the outputs of function f
+static int maxUlp(int f)
+{
+  const float *ref = (f == 0) ? exp_ref : (f == 1) ? log_ref : (f == 2) ? sin_ref : atan2_ref;
+  int mx = 0;
+  int i, d;
+
+  for (i = 0; i < N_ELEM; i++)
+  {
+    d = ulpDiff(out0[i], ref[i]);
+    if (d > mx)
+      mx = d;
+    if (f == 2)
+    {
+      d = ulpDiff(out1[i], cos_ref[i]);
+      if (d > mx)
+        mx = d;
+    }
+  }
+
+  return mx;
+}
+
+/////////////////////////////////////////////////////////
+// main testing function 
+/////////////////////////////////////////////////////////
+int main(int argc, const char * const argv[])
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  (void)argc;
+  (void)argv;
+
+  static const int tol[N_FUNCS] = { EXP_MAX_ULP, LOG_MAX_ULP, SIN_MAX_ULP, ATAN2_MAX_ULP };
+  int coreid = get_core_id();
+  int ncores = get_core_num();
+  int cycles1[N_FUNCS];
+  int f, nc, cycles, ulp;
+  boolean_T pass = true;
+
+  init_fp_regs();
+
+  perf_begin();
+
+  /////////////////////////////////////////////////////////
+  // accuracy and single core throughput
+  /////////////////////////////////////////////////////////
+
+  for (f = 0; f < N_FUNCS; f++)
+  {
+    cycles1[f] = runBatch(f, 1);
+
+    if (coreid == 0)
+    {
+      ulp = maxUlp(f);
+      if (ulp > tol[f])
+        pass = false;
+
+      printf("%s batch: max ulp %d (max %d), elements/cycle x1000 %d\n",
+             funcNames[f], ulp, tol[f], (N_ELEM * 1000) / cycles1[f]);
+
+      cycles = runScalar(f);
+      printf("%s scalar: max ulp %d, elements/cycle x1000 %d\n",
+             funcNames[f], maxUlp(f), (N_ELEM * 1000) / cycles);
+    }
+  }
+
+  /////////////////////////////////////////////////////////
+  // scaling over the cores, results checked again
+  /////////////////////////////////////////////////////////
+
+  for (nc = 2; nc <= ncores; nc <<= 1)
+  {
+    for (f = 0; f < N_FUNCS; f++)
+    {
+      cycles = runBatch(f, nc);
+
+      if (coreid == 0)
+      {
+        ulp = maxUlp(f);
+        if (ulp > tol[f])
+          pass = false;
+
+        printf("%s batch, cores=%d: max ulp %d, elements/cycle x1000 %d, speedup x100 %d\n",
+               funcNames[f], nc, ulp, (N_ELEM * 1000) / cycles, (cycles1[f] * 100) / cycles);
+      }
+    }
+  }
+
+  synch_barrier();
+
+  perf_end();
+
+  /////////////////////////////////////////////////////////
+  // check results
+  /////////////////////////////////////////////////////////
+
+  if (coreid == 0)
+    flagPassFail(pass, coreid);
+
+  synch_barrier();
+/////////////////////////////////////////////////////////
+// synchronize and exit
+/////////////////////////////////////////////////////////
+
+  return !pass;
+}
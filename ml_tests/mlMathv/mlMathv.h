@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+#ifndef __ML_MATHV_H__
+#define __ML_MATHV_H__
+
+/////////////////////////////////////////////////////////
+// defines
+/////////////////////////////////////////////////////////
+
+// include the shared header for ml kernels
+#include "mlShared.h"
+
+// elements per function
+#define N_ELEM 256
+
+// accepted max error of the batch functions, in ulps
+#define EXP_MAX_ULP   2
+#define LOG_MAX_ULP   2
+#define SIN_MAX_ULP   2
+#define ATAN2_MAX_ULP 4
+
+// number of batch functions (sin and cos are counted once)
+#define N_FUNCS 4
+
+/////////////////////////////////////////////////////////
+// subfunctions
+/////////////////////////////////////////////////////////
+static int ulpDiff(float a, float b);
+static int runBatch(int f, int nc);
+static int runScalar(int f);
+static int maxUlp(int f);
+
+/////////////////////////////////////////////////////////
+// main testing function 
+/////////////////////////////////////////////////////////
+int main(int argc, const char * const argv[]);
+
+
+
+#endif
+
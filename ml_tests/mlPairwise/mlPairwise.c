@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/////////////////////////////////////////////////////////
+// includes
+/////////////////////////////////////////////////////////
+#include "mlPairwise.h"
+#include "math_fns.h"
+#ifndef LINUX
+#include "pulp.h"
+#endif
+
+/////////////////////////////////////////////////////////
+// pairwise distances and rbf kernel matrices of point sets in L2 (the
+// kernel evaluations of the svm of the seizure detection, for many points
+// at once) against size and cores, through the tiles of pairwise. the
+// sizes cover the direct form (d < PW_GEMM_D), the gemm form and partial
+// tiles and chunks. every element is checked against plain serial loops,
+// reports flops per cycle and the speedup over one core.
+/////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////
+// shared globals
+/////////////////////////////////////////////////////////
+
+  // points and kernel matrix in L2
+  static float X[N_MAX * D_MAX];
+  static float Y[M_MAX * D_MAX];
+  static float K[N_MAX * M_MAX];
+
+  // rows of X, rows of Y, dimensions
+  static const int sizes[N_SIZES][3] = {
+    { 64, 64, 3 }, { 64, 48, 12 }, { 100, 70, 33 }, { 96, 96, 64 }, { N_MAX, M_MAX, D_MAX } };
+
+  static const int kinds[N_KINDS] = { PW_DIST, PW_RBF };
+
+  static const char *kindNames[N_KINDS] = { "distances", "rbf kernel" };
+
+/////////////////////////////////////////////////////////
+// subfunctions
+/////////////////////////////////////////////////////////
+
+// element i of stimulus s, in [0, 1): the checks regenerate the inputs
+static float stim(int i, int s)
+{
+  unsigned int h = (unsigned int) (i + 7919 * s) * 2654435761U;
+  h ^= h >> 15;
+  return (float) (h >> 8) * 5.96046448e-8F;
+}
+
+// exp(-gamma |x - y|^2) around 0.5 on average: |x - y|^2 is about d/6
+static inline float gammaOf(int d)
+{
+  return 4.0F / (float) d;
+}
+
+void fillPoints(int sz)
+{
+  int n = sizes[sz][0], m = sizes[sz][1], d = sizes[sz][2];
+  int i;
+
+  for (i = 0; i < n * d; i++)
+    X[i] = stim(i, 0);
+  for (i = 0; i < m * d; i++)
+    Y[i] = stim(i, 1);
+}
+
+// kernel on cores 0..nc-1 (the others take part in the barriers), cycles on
+// core 0
+int runPairwise(int kind, int sz, int nc)
+{
+  int n = sizes[sz][0], m = sizes[sz][1], d = sizes[sz][2];
+  int coreid = get_core_id();
+  int cycles = 0;
+
+  synch_barrier();
+
+  if (coreid == 0)
+  {
+    reset_timer();
+    start_timer();
+  }
+
+  pwPairwise(kinds[kind], n, m, d, gammaOf(d), X, Y, K, nc);
+
+  synch_barrier();
+
+  if (coreid == 0)
+  {
+    stop_timer();
+    cycles = get_time();
+  }
+
+  return cycles;
+}
+
+// results against serial loops on the regenerated inputs, returns the
+// number of wrong elements. the gemm form is exact up to the rounding of
+// |x|^2 + |y|^2, the distances are compared squared
+int checkPairwise(int kind, int sz)
+{
+  int n = sizes[sz][0], m = sizes[sz][1], d = sizes[sz][2];
+  float gamma = gammaOf(d);
+  int errors = 0;
+  float s, e, nx, ny, tol, k;
+  int i, j, l;
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j < m; j++)
+    {
+      s = nx = ny = 0.0F;
+      for (l = 0; l < d; l++)
+      {
+        e = stim(i * d + l, 0) - stim(j * d + l, 1);
+        s += e * e;
+        nx += stim(i * d + l, 0) * stim(i * d + l, 0);
+        ny += stim(j * d + l, 1) * stim(j * d + l, 1);
+      }
+
+      tol = 1.0e-5F * (nx + ny + 1.0F);
+      k = K[i * m + j];
+      if (kinds[kind] == PW_DIST)
+        errors += !(fAbs(k * k - s) <= tol);
+      else
+      {
+        e = fExp(-gamma * s);
+        errors += !(fAbs(k - e) <= e * (gamma * tol + 1.0e-5F));
+      }
+    }
+
+  return errors;
+}
+
+// floating point operations of a run: a subtraction less in the gemm form
+static int flops(int sz)
+{
+  int n = sizes[sz][0], m = sizes[sz][1], d = sizes[sz][2];
+
+  return (d < PW_GEMM_D ? 3 : 2) * n * m * d;
+}
+
+/////////////////////////////////////////////////////////
+// main testing function 
+/////////////////////////////////////////////////////////
+int main(int argc, const char * const argv[])
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  (void)argc;
+  (void)argv;
+
+  int coreid = get_core_id();
+  int ncores = get_core_num();
+  int errors = 0;
+  int cycles1 = 0;
+  int kind, sz, nc, cycles, err;
+  boolean_T pass;
+
+  init_fp_regs();
+
+  /////////////////////////////////////////////////////////
+  // main test loop 
+  // the cores share the rows of every tile
+  /////////////////////////////////////////////////////////
+
+  perf_begin();
+
+  for (sz = 0; sz < N_SIZES; sz++)
+  {
+    if (coreid == 0)
+      fillPoints(sz);
+
+    for (kind = 0; kind < N_KINDS; kind++)
+    {
+      for (nc = 1; nc <= ncores; nc <<= 1)
+      {
+        cycles = runPairwise(kind, sz, nc);
+
+        if (coreid == 0)
+        {
+          if (nc == 1)
+            cycles1 = cycles;
+          err = checkPairwise(kind, sz);
+          errors += err;
+          printf("%s, %dx%d d %d, cores=%d: time=%d, errors=%d, flop per cycle x100 %d, speedup x100 %d\n",
+                 kindNames[kind], sizes[sz][0], sizes[sz][1], sizes[sz][2], nc, cycles, err,
+                 (flops(sz) * 100) / cycles, (cycles1 * 100) / cycles);
+        }
+      }
+    }
+  }
+
+  synch_barrier();
+
+  perf_end();
+
+  /////////////////////////////////////////////////////////
+  // check results
+  /////////////////////////////////////////////////////////
+
+  pass = (errors == 0);
+
+  if (coreid == 0)
+    flagPassFail(pass, coreid);
+
+  synch_barrier();
+/////////////////////////////////////////////////////////
+// synchronize and exit
+/////////////////////////////////////////////////////////
+
+  return !pass;
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+#ifndef __ML_PAIRWISE_H__
+#define __ML_PAIRWISE_H__
+
+/////////////////////////////////////////////////////////
+// defines
+/////////////////////////////////////////////////////////
+
+// include the shared header for ml kernels
+#include "mlShared.h"
+#include "pairwise.h"
+
+// point sets: rows of X, rows of Y, dimensions
+#define N_SIZES 5
+#define N_MAX   128
+#define M_MAX   128
+#define D_MAX   96
+
+// kernels of the benchmark
+#define N_KINDS 2
+
+/////////////////////////////////////////////////////////
+// subfunctions
+/////////////////////////////////////////////////////////
+void fillPoints(int sz);
+int runPairwise(int kind, int sz, int nc);
+int checkPairwise(int kind, int sz);
+
+/////////////////////////////////////////////////////////
+// main testing function 
+/////////////////////////////////////////////////////////
+int main(int argc, const char * const argv[]);
+
+#endif
@@ -0,0 +1 @@
+../ml_shared/pairwise.c
\ No newline at end of file
@@ -0,0 +1 @@
+../ml_shared/pairwise.h
\ No newline at end of file
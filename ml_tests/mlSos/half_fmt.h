@@ -0,0 +1 @@
+../ml_shared/half_fmt.h
\ No newline at end of file
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+#ifndef __ML_SOS_H__
+#define __ML_SOS_H__
+
+/////////////////////////////////////////////////////////
+// defines
+/////////////////////////////////////////////////////////
+
+// include the shared header for ml kernels
+#include "mlShared.h"
+#include "sos_cascade.h"
+
+// channels (eeg montage of the seizure detection, rounded up to pairs),
+// samples per channel, samples per block of the stream
+#define NCH   24
+#define LEN   800
+#define BLOCK 100
+
+// sections of the filter of mlButter
+#define NSECT 3
+
+// formats
+#define F_FP32 0
+#define F_FP16 1
+#define N_FORMATS 2
+
+// tolerated largest error against the fp32 reference, relative to the
+// largest output, x1e6: about 4x the measured one (fp32 only differs by
+// the fused multiply-adds)
+#define TOL_FP32 20
+#define TOL_FP16 8000
+
+/////////////////////////////////////////////////////////
+// subfunctions
+/////////////////////////////////////////////////////////
+void loadRef(void);
+int runSos(int fmt, int nc, int *err);
+
+/////////////////////////////////////////////////////////
+// main testing function 
+/////////////////////////////////////////////////////////
+int main(int argc, const char * const argv[]);
+
+#endif
@@ -0,0 +1 @@
+../ml_shared/sos_cascade.c
\ No newline at end of file
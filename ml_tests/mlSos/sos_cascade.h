@@ -0,0 +1 @@
+../ml_shared/sos_cascade.h
\ No newline at end of file
@@ -0,0 +1,434 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/*----------------------------------------------------------------------------
+| batched small matrix linear algebra, see batch_la.h for the layout.
+*----------------------------------------------------------------------------*/
+
+#include "batch_la.h"
+#include "math_fns.h"
+#ifndef LINUX
+#include "pulp.h"
+#endif
+
+// matrices [*b0, *b1) of this core
+static inline void bRange(int nb, int nc, int *b0, int *b1)
+{
+  int id = 0;
+  int chunk;
+
+#ifndef LINUX
+  if (nc > 1)
+    id = rt_core_id();
+#endif
+
+  if (id >= nc)
+  {
+    *b0 = *b1 = 0;
+    return;
+  }
+
+  chunk = (nb + nc - 1) / nc;
+  *b0 = id * chunk;
+  *b1 = *b0 + chunk;
+  if (*b1 > nb)
+    *b1 = nb;
+  if (*b0 > nb)
+    *b0 = nb;
+}
+
+// jacobi rotation annihilating the (p, q) entry: t = tan of the angle from
+// the ratio zeta = (aqq - app) / (2 apq), 0 when apq is 0. returns t
+static inline float bRot(float zeta2, float apq, float *c, float *s)
+{
+  float zeta = fDiv(zeta2, apq + apq);
+  float za   = fAbs(zeta);
+  float t;
+
+  // keeps zeta^2 finite, also for apq = 0
+  if (!(za < 1.0e18F))
+    za = 1.0e18F;
+
+  t = fDiv(1.0F, za + fSqrt(za * za + 1.0F));
+  if (zeta < 0.0F)
+    t = -t;
+  if (apq == 0.0F)
+    t = 0.0F;
+
+  *c = fDiv(1.0F, fSqrt(t * t + 1.0F));
+  *s = t * *c;
+  return t;
+}
+
+void batchChol(float *A, int *info, int n, int nb, int ld, int nc)
+{
+  float acc[BATCH_LA_BLOCK];
+  float inv[BATCH_LA_BLOCK];
+  float msk[BATCH_LA_BLOCK];
+  float w[BATCH_LA_BLOCK];
+  int b0, b1, lo, hi, nk, b, j, k, r;
+
+  bRange(nb, nc, &b0, &b1);
+
+  for (lo = b0; lo < b1; lo += BATCH_LA_BLOCK)
+  {
+    hi = (lo + BATCH_LA_BLOCK < b1) ? lo + BATCH_LA_BLOCK : b1;
+    nk = hi - lo;
+    A    += lo;
+    info += lo;
+
+    for (b = 0; b < nk; b++)
+      info[b] = 0;
+
+    for (j = 0; j < n; j++)
+    {
+      float *ajj = A + (j + n*j)*ld;
+
+      // a_jj - sum of the squares of row j of the factor
+      for (b = 0; b < nk; b++)
+        acc[b] = 0.0F;
+      for (k = 0; k < j; k++)
+      {
+        const float *ljk = A + (j + n*k)*ld;
+        for (b = 0; b < nk; b++)
+          acc[b] += ljk[b] * ljk[b];
+      }
+
+      // the matrices that stop here keep a_jj - sum and get info, the
+      // ones that stopped before are masked out of the updates
+      for (b = 0; b < nk; b++)
+      {
+        float d = ajj[b] - acc[b];
+        inv[b] = 1.0F;
+        msk[b] = 0.0F;
+        if (info[b] == 0)
+        {
+          if (d > 0.0F)
+          {
+            d      = fSqrt(d);
+            inv[b] = fDiv(1.0F, d);
+            msk[b] = 1.0F;
+          }
+          else
+          {
+            info[b] = j + 1;
+          }
+          ajj[b] = d;
+        }
+      }
+
+      // column j below the diagonal, left looking
+      for (k = 0; k < j; k++)
+      {
+        const float *ljk = A + (j + n*k)*ld;
+        for (b = 0; b < nk; b++)
+          w[b] = -(ljk[b] * msk[b]);
+
+        for (r = j + 1; r < n; r++)
+        {
+          float *arj = A + (r + n*j)*ld;
+          const float *ark = A + (r + n*k)*ld;
+          for (b = 0; b < nk; b++)
+            arj[b] += ark[b] * w[b];
+        }
+      }
+
+      for (r = j + 1; r < n; r++)
+      {
+        float *arj = A + (r + n*j)*ld;
+        for (b = 0; b < nk; b++)
+          arj[b] *= inv[b];
+      }
+    }
+
+    // strict upper part, up to the last completed column
+    for (j = 1; j < n; j++)
+    {
+      for (r = 0; r < j; r++)
+      {
+        float *arj = A + (r + n*j)*ld;
+        for (b = 0; b < nk; b++)
+          if (info[b] == 0 || j < info[b] - 1)
+            arj[b] = 0.0F;
+      }
+    }
+
+    A    -= lo;
+    info -= lo;
+  }
+}
+
+void batchSchurSym(float *A, float *U, int n, int sweeps, int nb, int ld, int nc)
+{
+  float c[BATCH_LA_BLOCK];
+  float s[BATCH_LA_BLOCK];
+  int b0, b1, lo, hi, nk, b, i, k, p, q, sw;
+
+  bRange(nb, nc, &b0, &b1);
+
+  for (lo = b0; lo < b1; lo += BATCH_LA_BLOCK)
+  {
+    hi = (lo + BATCH_LA_BLOCK < b1) ? lo + BATCH_LA_BLOCK : b1;
+    nk = hi - lo;
+    A += lo;
+    U += lo;
+
+    for (i = 0; i < n*n; i++)
+      for (b = 0; b < nk; b++)
+        U[i*ld + b] = (i % (n + 1) == 0) ? 1.0F : 0.0F;
+
+    for (sw = 0; sw < sweeps; sw++)
+    {
+      for (p = 0; p < n - 1; p++)
+      {
+        for (q = p + 1; q < n; q++)
+        {
+          float *app = A + (p + n*p)*ld;
+          float *aqq = A + (q + n*q)*ld;
+          float *apq = A + (p + n*q)*ld;
+          float *aqp = A + (q + n*p)*ld;
+
+          for (b = 0; b < nk; b++)
+          {
+            float t = bRot(aqq[b] - app[b], apq[b], &c[b], &s[b]) * apq[b];
+            app[b] -= t;
+            aqq[b] += t;
+            apq[b]  = 0.0F;
+            aqp[b]  = 0.0F;
+          }
+
+          for (k = 0; k < n; k++)
+          {
+            float *akp, *akq, *apk, *aqk;
+            if (k == p || k == q)
+              continue;
+            akp = A + (k + n*p)*ld;
+            akq = A + (k + n*q)*ld;
+            apk = A + (p + n*k)*ld;
+            aqk = A + (q + n*k)*ld;
+            for (b = 0; b < nk; b++)
+            {
+              float xp = akp[b];
+              float xq = akq[b];
+              float yp = c[b]*xp - s[b]*xq;
+              float yq = s[b]*xp + c[b]*xq;
+              akp[b] = yp;
+              apk[b] = yp;
+              akq[b] = yq;
+              aqk[b] = yq;
+            }
+          }
+
+          for (k = 0; k < n; k++)
+          {
+            float *ukp = U + (k + n*p)*ld;
+            float *ukq = U + (k + n*q)*ld;
+            for (b = 0; b < nk; b++)
+            {
+              float xp = ukp[b];
+              float xq = ukq[b];
+              ukp[b] = c[b]*xp - s[b]*xq;
+              ukq[b] = s[b]*xp + c[b]*xq;
+            }
+          }
+        }
+      }
+    }
+
+    A -= lo;
+    U -= lo;
+  }
+}
+
+void batchSvd(float *A, float *S, float *V, int m, int n, int sweeps, int nb, int ld, int nc)
+{
+  float al[BATCH_LA_BLOCK];
+  float be[BATCH_LA_BLOCK];
+  float ga[BATCH_LA_BLOCK];
+  float c[BATCH_LA_BLOCK];
+  float s[BATCH_LA_BLOCK];
+  int b0, b1, lo, hi, nk, b, i, k, p, q, sw;
+
+  bRange(nb, nc, &b0, &b1);
+
+  for (lo = b0; lo < b1; lo += BATCH_LA_BLOCK)
+  {
+    hi = (lo + BATCH_LA_BLOCK < b1) ? lo + BATCH_LA_BLOCK : b1;
+    nk = hi - lo;
+    A += lo;
+    S += lo;
+    V += lo;
+
+    for (i = 0; i < n*n; i++)
+      for (b = 0; b < nk; b++)
+        V[i*ld + b] = (i % (n + 1) == 0) ? 1.0F : 0.0F;
+
+    // rotate pairs of columns of A until they are orthogonal
+    for (sw = 0; sw < sweeps; sw++)
+    {
+      for (p = 0; p < n - 1; p++)
+      {
+        for (q = p + 1; q < n; q++)
+        {
+          for (b = 0; b < nk; b++)
+          {
+            al[b] = 0.0F;
+            be[b] = 0.0F;
+            ga[b] = 0.0F;
+          }
+          for (k = 0; k < m; k++)
+          {
+            const float *xp = A + (k + m*p)*ld;
+            const float *xq = A + (k + m*q)*ld;
+            for (b = 0; b < nk; b++)
+            {
+              al[b] += xp[b] * xp[b];
+              be[b] += xq[b] * xq[b];
+              ga[b] += xp[b] * xq[b];
+            }
+          }
+
+          for (b = 0; b < nk; b++)
+            bRot(be[b] - al[b], ga[b], &c[b], &s[b]);
+
+          for (k = 0; k < m; k++)
+          {
+            float *xp = A + (k + m*p)*ld;
+            float *xq = A + (k + m*q)*ld;
+            for (b = 0; b < nk; b++)
+            {
+              float yp = xp[b];
+              float yq = xq[b];
+              xp[b] = c[b]*yp - s[b]*yq;
+              xq[b] = s[b]*yp + c[b]*yq;
+            }
+          }
+
+          for (k = 0; k < n; k++)
+          {
+            float *vp = V + (k + n*p)*ld;
+            float *vq = V + (k + n*q)*ld;
+            for (b = 0; b < nk; b++)
+            {
+              float yp = vp[b];
+              float yq = vq[b];
+              vp[b] = c[b]*yp - s[b]*yq;
+              vq[b] = s[b]*yp + c[b]*yq;
+            }
+          }
+        }
+      }
+    }
+
+    // singular values are the column norms, U the normalized columns
+    for (p = 0; p < n; p++)
+    {
+      float *sp = S + p*ld;
+
+      for (b = 0; b < nk; b++)
+        al[b] = 0.0F;
+      for (k = 0; k < m; k++)
+      {
+        const float *xp = A + (k + m*p)*ld;
+        for (b = 0; b < nk; b++)
+          al[b] += xp[b] * xp[b];
+      }
+
+      for (b = 0; b < nk; b++)
+      {
+        sp[b] = fSqrt(al[b]);
+        be[b] = (sp[b] > 0.0F) ? fDiv(1.0F, sp[b]) : 0.0F;
+      }
+
+      for (k = 0; k < m; k++)
+      {
+        float *xp = A + (k + m*p)*ld;
+        for (b = 0; b < nk; b++)
+          xp[b] *= be[b];
+      }
+    }
+
+    A -= lo;
+    S -= lo;
+    V -= lo;
+  }
+}
+
+void batchRotate(const float *axang, const float *vin, float *vout, int nv, int nb, int ld, int nc)
+{
+  float cth[BATCH_LA_BLOCK];
+  float sth[BATCH_LA_BLOCK];
+  float R[9][BATCH_LA_BLOCK];
+  int b0, b1, lo, hi, nk, b, i, l;
+
+  bRange(nb, nc, &b0, &b1);
+
+  for (lo = b0; lo < b1; lo += BATCH_LA_BLOCK)
+  {
+    hi = (lo + BATCH_LA_BLOCK < b1) ? lo + BATCH_LA_BLOCK : b1;
+    nk = hi - lo;
+
+    fSinCosv(axang + 3*ld + lo, sth, cth, nk, 1);
+
+    for (b = 0; b < nk; b++)
+    {
+      float x = axang[lo + b];
+      float y = axang[ld + lo + b];
+      float z = axang[2*ld + lo + b];
+      float r = fDiv(1.0F, fSqrt(x * x + y * y + z * z));
+      float c = cth[b];
+      float s = sth[b];
+      float t = 1.0F - c;
+
+      x *= r;
+      y *= r;
+      z *= r;
+
+      // column major, as b_v of mlGivens
+      R[0][b] = x * x * t + c;
+      R[1][b] = x * y * t + z * s;
+      R[2][b] = x * z * t - y * s;
+      R[3][b] = y * x * t - z * s;
+      R[4][b] = y * y * t + c;
+      R[5][b] = y * z * t + x * s;
+      R[6][b] = z * x * t + y * s;
+      R[7][b] = z * y * t - x * s;
+      R[8][b] = z * z * t + c;
+    }
+
+    for (i = 0; i < nv; i++)
+    {
+      const float *a0 = vin + i*ld + lo;
+      const float *a1 = vin + (i + nv)*ld + lo;
+      const float *a2 = vin + (i + 2*nv)*ld + lo;
+
+      for (l = 0; l < 3; l++)
+      {
+        float *o = vout + (i + nv*l)*ld + lo;
+        for (b = 0; b < nk; b++)
+        {
+          float acc = a0[b] * R[3*l][b];
+          acc += a1[b] * R[3*l + 1][b];
+          acc += a2[b] * R[3*l + 2][b];
+          o[b] = acc;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/*----------------------------------------------------------------------------
+| batched small matrix linear algebra, for many tiny factorizations at once.
+|
+| the matrices are stored interleaved (structure of arrays): element e of
+| matrix b is M[e*ld + b], ld >= nb, with e = i + n*j (column major, as in
+| the matlab coder kernels). all the loops over a batch have the matrix
+| index innermost, so that the same operation runs on consecutive matrices
+| with no dependency between them.
+|
+| the matrices are split over the cores as the core ranges of mlShared.h.
+*----------------------------------------------------------------------------*/
+#ifndef __BATCH_LA_H__
+#define __BATCH_LA_H__
+
+// matrices processed together, bounds the per-matrix temporaries on the stack
+#define BATCH_LA_BLOCK 16
+
+  // cholesky of n x n symmetric positive definite matrices, lower factor in
+  // place and strict upper part zeroed. as potrf, info[b] is 0 or the column
+  // + 1 where the factorization of matrix b stopped (not positive definite),
+  // that matrix is then left as the reference kernel of mlChol leaves it
+  void batchChol(float *A, int *info, int n, int nb, int ld, int nc);
+
+  // real schur form of symmetric n x n matrices (cyclic jacobi, a fixed
+  // number of sweeps, 6 converge in single precision on the 5 x 5 ones of
+  // mlSchur): A becomes U'*A*U, diagonal with the eigenvalues, unsorted.
+  // U is written, orthogonal.
+  void batchSchurSym(float *A, float *U, int n, int sweeps, int nb, int ld, int nc);
+
+  // svd of m x n matrices, m >= n (one sided jacobi, fixed sweeps as above):
+  // A is overwritten with U (m x n), S gets the n singular values, unsorted,
+  // and V (n x n) the right singular vectors. the columns of U for zero
+  // singular values are left zero.
+  void batchSvd(float *A, float *S, float *V, int m, int n, int sweeps, int nb, int ld, int nc);
+
+  // rotation of nv 3 vectors around an axis (rodrigues, as mlGivens):
+  // axang rows 0..2 are the axis, not normalized, row 3 the angle. the
+  // component c of vector i is row i + nv*c of vin and vout, and
+  // vout = vin' * R.
+  void batchRotate(const float *axang, const float *vin, float *vout, int nv, int nb, int ld, int nc);
+
+#endif
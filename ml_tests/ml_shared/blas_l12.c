@@ -0,0 +1,534 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/*----------------------------------------------------------------------------
+| single precision blas level 1 and 2, see blas_l12.h.
+*----------------------------------------------------------------------------*/
+
+#include "blas_l12.h"
+#include "math_fns.h"
+#ifndef LINUX
+#include "pulp.h"
+#else
+#include <string.h>
+#define synch_barrier()
+#define RT_LOCAL_DATA
+#endif
+
+#define BFMA(a, b, c) __builtin_fmaf((a), (b), (c))
+
+  // tree reduction slots: the partial sum of a core and whether it is
+  // waiting to be read
+  RT_LOCAL_DATA static volatile float blasPart[BLAS_MAX_CORES];
+  RT_LOCAL_DATA static volatile int blasFull[BLAS_MAX_CORES];
+
+  // L1 tiles of the L2 variants, two buffers of two operands
+  RT_LOCAL_DATA static float blasBuf[4][BLAS_TILE];
+
+static inline int blasId(int nc)
+{
+#ifndef LINUX
+  if (nc > 1)
+    return rt_core_id();
+#endif
+  (void)nc;
+  return 0;
+}
+
+// the L2 variants run on every core, also with nc = 1
+static inline int blasCore(void)
+{
+#ifndef LINUX
+  return rt_core_id();
+#else
+  return 0;
+#endif
+}
+
+// elements [*i0, *i1) of this core, in whole unrolled blocks. a range that
+// is a multiple of the banks would start every core on the same bank, one
+// block more staggers them (the last core gets less)
+static inline void blasRange(int n, int nc, int *i0, int *i1)
+{
+  int id = blasId(nc);
+  int chunk;
+
+  if (id >= nc)
+  {
+    *i0 = *i1 = 0;
+    return;
+  }
+
+  chunk = (n + nc - 1) / nc;
+  chunk = (chunk + BLAS_UNROLL - 1) & ~(BLAS_UNROLL - 1);
+  if (nc > 1 && (chunk % BLAS_BANKS) == 0)
+    chunk += BLAS_UNROLL;
+
+  *i0 = id * chunk;
+  *i1 = *i0 + chunk;
+  if (*i1 > n)
+    *i1 = n;
+  if (*i0 > n)
+    *i0 = n;
+}
+
+// rows [*r0, *r1) of this core
+static inline void blasRows(int m, int nc, int *r0, int *r1)
+{
+  int id = blasId(nc);
+  int chunk = (m + nc - 1) / nc;
+
+  *r0 = (id < nc) ? id * chunk : m;
+  *r1 = *r0 + chunk;
+  if (*r1 > m)
+    *r1 = m;
+  if (*r0 > m)
+    *r0 = m;
+}
+
+// sum of s over cores 0..nc-1, returned on core 0. at step k the cores
+// that are multiples of 2k add the sum posted by id + k, the others post
+// theirs and leave. a slot is cleared by its reader, a core posting to a
+// slot still full (its previous sum unread) waits for it
+static float blasReduce(float s, int nc)
+{
+  int id = blasId(nc);
+  int k;
+
+  if (id >= nc)
+    return 0.0F;
+
+  for (k = 1; k < nc; k <<= 1)
+  {
+    if (id & k)
+    {
+      while (blasFull[id])
+        ;
+      blasPart[id] = s;
+      blasFull[id] = 1;
+      break;
+    }
+
+    if (id + k < nc)
+    {
+      while (!blasFull[id + k])
+        ;
+      s += blasPart[id + k];
+      blasFull[id + k] = 0;
+    }
+  }
+
+  return s;
+}
+
+static void axpyRange(int i0, int i1, float a, const float *x, float *y)
+{
+  int i;
+
+  for (i = i0; i + BLAS_UNROLL <= i1; i += BLAS_UNROLL)
+  {
+    float y0 = BFMA(a, x[i],     y[i]);
+    float y1 = BFMA(a, x[i + 1], y[i + 1]);
+    float y2 = BFMA(a, x[i + 2], y[i + 2]);
+    float y3 = BFMA(a, x[i + 3], y[i + 3]);
+    y[i]     = y0;
+    y[i + 1] = y1;
+    y[i + 2] = y2;
+    y[i + 3] = y3;
+  }
+  for (; i < i1; i++)
+    y[i] = BFMA(a, x[i], y[i]);
+}
+
+static float dotRange(int i0, int i1, const float *x, const float *y)
+{
+  float s0 = 0.0F, s1 = 0.0F, s2 = 0.0F, s3 = 0.0F;
+  int i;
+
+  for (i = i0; i + BLAS_UNROLL <= i1; i += BLAS_UNROLL)
+  {
+    s0 = BFMA(x[i],     y[i],     s0);
+    s1 = BFMA(x[i + 1], y[i + 1], s1);
+    s2 = BFMA(x[i + 2], y[i + 2], s2);
+    s3 = BFMA(x[i + 3], y[i + 3], s3);
+  }
+  for (; i < i1; i++)
+    s0 = BFMA(x[i], y[i], s0);
+
+  return (s0 + s1) + (s2 + s3);
+}
+
+void blasSaxpy(int n, float a, const float *x, float *y, int nc)
+{
+  int i0, i1;
+
+  blasRange(n, nc, &i0, &i1);
+  axpyRange(i0, i1, a, x, y);
+}
+
+float blasSdot(int n, const float *x, const float *y, int nc)
+{
+  int i0, i1;
+
+  blasRange(n, nc, &i0, &i1);
+  return blasReduce(dotRange(i0, i1, x, y), nc);
+}
+
+float blasSwdot(int n, const float *x, const float *w, const float *y, int nc)
+{
+  float s0 = 0.0F, s1 = 0.0F, s2 = 0.0F, s3 = 0.0F;
+  int i0, i1, i;
+
+  blasRange(n, nc, &i0, &i1);
+
+  for (i = i0; i + BLAS_UNROLL <= i1; i += BLAS_UNROLL)
+  {
+    s0 = BFMA(w[i]     * x[i],     y[i],     s0);
+    s1 = BFMA(w[i + 1] * x[i + 1], y[i + 1], s1);
+    s2 = BFMA(w[i + 2] * x[i + 2], y[i + 2], s2);
+    s3 = BFMA(w[i + 3] * x[i + 3], y[i + 3], s3);
+  }
+  for (; i < i1; i++)
+    s0 = BFMA(w[i] * x[i], y[i], s0);
+
+  return blasReduce((s0 + s1) + (s2 + s3), nc);
+}
+
+// rows [r0, r1) of a row major gemv, four rows at a time on the same x
+static void gemvRows(int r0, int r1, int n, float alpha, const float *A, int lda,
+                     const float *x, float beta, float *y)
+{
+  int i, j;
+
+  for (i = r0; i + 4 <= r1; i += 4)
+  {
+    const float *a0 = A + i * lda;
+    const float *a1 = a0 + lda;
+    const float *a2 = a1 + lda;
+    const float *a3 = a2 + lda;
+    float s0 = 0.0F, s1 = 0.0F, s2 = 0.0F, s3 = 0.0F;
+
+    for (j = 0; j < n; j++)
+    {
+      float xj = x[j];
+      s0 = BFMA(a0[j], xj, s0);
+      s1 = BFMA(a1[j], xj, s1);
+      s2 = BFMA(a2[j], xj, s2);
+      s3 = BFMA(a3[j], xj, s3);
+    }
+
+    if (beta == 0.0F)
+    {
+      y[i]     = alpha * s0;
+      y[i + 1] = alpha * s1;
+      y[i + 2] = alpha * s2;
+      y[i + 3] = alpha * s3;
+    }
+    else
+    {
+      y[i]     = BFMA(alpha, s0, beta * y[i]);
+      y[i + 1] = BFMA(alpha, s1, beta * y[i + 1]);
+      y[i + 2] = BFMA(alpha, s2, beta * y[i + 2]);
+      y[i + 3] = BFMA(alpha, s3, beta * y[i + 3]);
+    }
+  }
+
+  for (; i < r1; i++)
+  {
+    float s = dotRange(0, n, A + i * lda, x);
+    y[i] = (beta == 0.0F) ? alpha * s : BFMA(alpha, s, beta * y[i]);
+  }
+}
+
+void blasSgemv(int order, int m, int n, float alpha, const float *A, int lda,
+               const float *x, float beta, float *y, int nc)
+{
+  int r0, r1, i, j;
+
+  if (order == BLAS_ROW_MAJOR)
+  {
+    blasRows(m, nc, &r0, &r1);
+    gemvRows(r0, r1, n, alpha, A, lda, x, beta, y);
+    return;
+  }
+
+  // column major: y scaled by beta, then four columns per pass over the
+  // rows of this core
+  blasRange(m, nc, &r0, &r1);
+
+  for (i = r0; i < r1; i++)
+    y[i] = (beta == 0.0F) ? 0.0F : beta * y[i];
+
+  for (j = 0; j + 4 <= n; j += 4)
+  {
+    const float *a0 = A + j * lda;
+    const float *a1 = a0 + lda;
+    const float *a2 = a1 + lda;
+    const float *a3 = a2 + lda;
+    float x0 = alpha * x[j];
+    float x1 = alpha * x[j + 1];
+    float x2 = alpha * x[j + 2];
+    float x3 = alpha * x[j + 3];
+
+    for (i = r0; i < r1; i++)
+      y[i] = BFMA(a3[i], x3, BFMA(a2[i], x2, BFMA(a1[i], x1, BFMA(a0[i], x0, y[i]))));
+  }
+  for (; j < n; j++)
+    axpyRange(r0, r1, alpha * x[j], A + j * lda, y);
+}
+
+void blasSdist(int m, int n, int d, const float *X, const float *Y, float *D, int sq, int nc)
+{
+  int r0, r1, i, j, k;
+
+  blasRows(m, nc, &r0, &r1);
+
+  for (i = r0; i < r1; i++)
+  {
+    const float *xi = X + i * d;
+    float *di = D + i * n;
+
+    // four rows of Y per pass, their sums independent
+    for (j = 0; j + 4 <= n; j += 4)
+    {
+      const float *y0 = Y + j * d;
+      float s0 = 0.0F, s1 = 0.0F, s2 = 0.0F, s3 = 0.0F;
+
+      for (k = 0; k < d; k++)
+      {
+        float xk = xi[k];
+        float e0 = xk - y0[k];
+        float e1 = xk - y0[k + d];
+        float e2 = xk - y0[k + 2 * d];
+        float e3 = xk - y0[k + 3 * d];
+        s0 = BFMA(e0, e0, s0);
+        s1 = BFMA(e1, e1, s1);
+        s2 = BFMA(e2, e2, s2);
+        s3 = BFMA(e3, e3, s3);
+      }
+
+      di[j]     = s0;
+      di[j + 1] = s1;
+      di[j + 2] = s2;
+      di[j + 3] = s3;
+    }
+
+    for (; j < n; j++)
+    {
+      float s = 0.0F;
+      for (k = 0; k < d; k++)
+      {
+        float e = xi[k] - Y[j * d + k];
+        s = BFMA(e, e, s);
+      }
+      di[j] = s;
+    }
+
+    if (!sq)
+      for (j = 0; j < n; j++)
+        di[j] = fSqrt(di[j]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+| L2 streaming: core 0 drives the DMA. tile t is in buffer t & 1; the load
+| of tile t+1 is issued once tile t has landed (and, for saxpy, once the
+| write back of tile t-1 from the same buffer is done), so that it runs
+| under the computation of tile t.
+*----------------------------------------------------------------------------*/
+
+static inline int blasLoad(const float *ext, float *loc, int n)
+{
+#ifndef LINUX
+  return plp_dma_memcpy((unsigned int) ext, (unsigned int) loc, n * sizeof(float), PLP_DMA_EXT2LOC);
+#else
+  memcpy(loc, ext, n * sizeof(float));
+  return 0;
+#endif
+}
+
+static inline int blasStore(float *ext, const float *loc, int n)
+{
+#ifndef LINUX
+  return plp_dma_memcpy((unsigned int) ext, (unsigned int) loc, n * sizeof(float), PLP_DMA_LOC2EXT);
+#else
+  memcpy(ext, loc, n * sizeof(float));
+  return 0;
+#endif
+}
+
+// rows x n floats with leading dimension lda, packed in L1
+static inline int blasLoadRows(const float *ext, int lda, float *loc, int rows, int n)
+{
+#ifndef LINUX
+  if (lda == n)
+    return blasLoad(ext, loc, rows * n);
+  return plp_dma_memcpy_2d((unsigned int) ext, (unsigned int) loc, rows * n * sizeof(float),
+                           lda * sizeof(float), n * sizeof(float), PLP_DMA_EXT2LOC);
+#else
+  int i;
+  for (i = 0; i < rows; i++)
+    memcpy(loc + i * n, ext + i * lda, n * sizeof(float));
+  return 0;
+#endif
+}
+
+static inline void blasWait(int id)
+{
+#ifndef LINUX
+  plp_dma_wait(id);
+#else
+  (void)id;
+#endif
+}
+
+void blasSaxpyL2(int n, float a, const float *x, float *y, int nc)
+{
+  int id = blasCore();
+  int nt = (n + BLAS_TILE - 1) / BLAS_TILE;
+  int inX = 0, inY = 0, out = 0;
+  int t, len, i0, i1;
+
+  if (id == 0 && nt > 0)
+  {
+    len = n < BLAS_TILE ? n : BLAS_TILE;
+    inX = blasLoad(x, blasBuf[0], len);
+    inY = blasLoad(y, blasBuf[2], len);
+  }
+
+  for (t = 0; t < nt; t++)
+  {
+    len = (n - t * BLAS_TILE) < BLAS_TILE ? n - t * BLAS_TILE : BLAS_TILE;
+
+    if (id == 0)
+    {
+      blasWait(inX);
+      blasWait(inY);
+      if (t > 0)
+        blasWait(out);
+      if (t + 1 < nt)
+      {
+        int next = (n - (t + 1) * BLAS_TILE) < BLAS_TILE ? n - (t + 1) * BLAS_TILE : BLAS_TILE;
+        inX = blasLoad(x + (t + 1) * BLAS_TILE, blasBuf[(t + 1) & 1], next);
+        inY = blasLoad(y + (t + 1) * BLAS_TILE, blasBuf[2 + ((t + 1) & 1)], next);
+      }
+    }
+
+    synch_barrier();
+
+    if (id < nc)
+    {
+      blasRange(len, nc, &i0, &i1);
+      axpyRange(i0, i1, a, blasBuf[t & 1], blasBuf[2 + (t & 1)]);
+    }
+
+    synch_barrier();
+
+    if (id == 0)
+      out = blasStore(y + t * BLAS_TILE, blasBuf[2 + (t & 1)], len);
+  }
+
+  if (id == 0 && nt > 0)
+    blasWait(out);
+}
+
+float blasSdotL2(int n, const float *x, const float *y, int nc)
+{
+  int id = blasCore();
+  int nt = (n + BLAS_TILE - 1) / BLAS_TILE;
+  int inX = 0, inY = 0;
+  float s = 0.0F;
+  int t, len, i0, i1;
+
+  if (id == 0 && nt > 0)
+  {
+    len = n < BLAS_TILE ? n : BLAS_TILE;
+    inX = blasLoad(x, blasBuf[0], len);
+    inY = blasLoad(y, blasBuf[2], len);
+  }
+
+  for (t = 0; t < nt; t++)
+  {
+    len = (n - t * BLAS_TILE) < BLAS_TILE ? n - t * BLAS_TILE : BLAS_TILE;
+
+    // the barrier closing tile t-1 released buffer (t+1) & 1
+    if (id == 0)
+    {
+      blasWait(inX);
+      blasWait(inY);
+      if (t + 1 < nt)
+      {
+        int next = (n - (t + 1) * BLAS_TILE) < BLAS_TILE ? n - (t + 1) * BLAS_TILE : BLAS_TILE;
+        inX = blasLoad(x + (t + 1) * BLAS_TILE, blasBuf[(t + 1) & 1], next);
+        inY = blasLoad(y + (t + 1) * BLAS_TILE, blasBuf[2 + ((t + 1) & 1)], next);
+      }
+    }
+
+    synch_barrier();
+
+    if (id < nc)
+    {
+      blasRange(len, nc, &i0, &i1);
+      s += dotRange(i0, i1, blasBuf[t & 1], blasBuf[2 + (t & 1)]);
+    }
+
+    synch_barrier();
+  }
+
+  return blasReduce(s, nc);
+}
+
+void blasSgemvL2(int m, int n, float alpha, const float *A, int lda,
+                 const float *x, float beta, float *y, int nc)
+{
+  int id = blasCore();
+  int rt = (2 * BLAS_TILE) / n;
+  int nt = (m + rt - 1) / rt;
+  int in = 0;
+  int t, rows, r0, r1;
+
+  // whole rows per tile, a tile takes the two buffers of an operand
+  if (id == 0 && nt > 0)
+    in = blasLoadRows(A, lda, blasBuf[0], m < rt ? m : rt, n);
+
+  for (t = 0; t < nt; t++)
+  {
+    rows = (m - t * rt) < rt ? m - t * rt : rt;
+
+    if (id == 0)
+    {
+      blasWait(in);
+      if (t + 1 < nt)
+      {
+        int next = (m - (t + 1) * rt) < rt ? m - (t + 1) * rt : rt;
+        in = blasLoadRows(A + (t + 1) * rt * lda, lda, blasBuf[2 * ((t + 1) & 1)], next, n);
+      }
+    }
+
+    synch_barrier();
+
+    if (id < nc)
+    {
+      blasRows(rows, nc, &r0, &r1);
+      gemvRows(r0, r1, n, alpha, blasBuf[2 * (t & 1)], n, x, beta, y + t * rt);
+    }
+
+    synch_barrier();
+  }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/*----------------------------------------------------------------------------
+| single precision blas level 1 and 2 for the cluster: the operations of
+| mlAxpy, mlDotp, mlWdotp, mlGemv and mlDist on any size.
+|
+| the work is split over the cores as the core ranges of mlShared.h, the
+| ranges are whole blocks of BLAS_UNROLL elements (fmadd unrolled,
+| independent sums), staggered over the BLAS_BANKS word-interleaved TCDM
+| banks so that the cores do not run on the same bank in lockstep.
+|
+| the dot products reduce the per-core sums over a binary tree of the nc
+| cores, without a barrier; the result is returned on core 0.
+|
+| the *L2 variants take their vectors (and the matrix) in L2 and stream them
+| through double buffered L1 tiles of BLAS_TILE floats with the cluster
+| DMA. they synchronize with barriers inside: every core of the cluster
+| calls them, the ones from nc on only take part in the barriers.
+*----------------------------------------------------------------------------*/
+#ifndef __BLAS_L12_H__
+#define __BLAS_L12_H__
+
+// elements per unrolled block, a power of 2
+#define BLAS_UNROLL 4
+
+// TCDM banks (32 bit words) of the cluster
+#ifndef BLAS_BANKS
+#define BLAS_BANKS 16
+#endif
+
+// cores taking part in the reductions, at most
+#define BLAS_MAX_CORES 16
+
+// floats per L1 tile of the L2 variants (4 tiles in L1)
+#ifndef BLAS_TILE
+#define BLAS_TILE 512
+#endif
+
+// storage of the matrix of sgemv
+#define BLAS_ROW_MAJOR 0
+#define BLAS_COL_MAJOR 1
+
+  // y = a*x + y
+  void blasSaxpy(int n, float a, const float *x, float *y, int nc);
+
+  // x'*y, on core 0
+  float blasSdot(int n, const float *x, const float *y, int nc);
+
+  // sum of w_i*x_i*y_i, on core 0
+  float blasSwdot(int n, const float *x, const float *w, const float *y, int nc);
+
+  // y = alpha*A*x + beta*y, A m x n with leading dimension lda, BLAS_ROW_MAJOR
+  // or BLAS_COL_MAJOR. the cores share the rows. y is not read when beta is 0
+  void blasSgemv(int order, int m, int n, float alpha, const float *A, int lda,
+                 const float *x, float beta, float *y, int nc);
+
+  // D[i*n + j] = |X_i - Y_j|, distances between the rows of X (m x d) and
+  // of Y (n x d), both row major, squared if sq is set. the cores share
+  // the rows of X
+  void blasSdist(int m, int n, int d, const float *X, const float *Y, float *D, int sq, int nc);
+
+  // blasSaxpy and blasSdot on vectors in L2, y written back to L2
+  void blasSaxpyL2(int n, float a, const float *x, float *y, int nc);
+  float blasSdotL2(int n, const float *x, const float *y, int nc);
+
+  // blasSgemv of a row major A in L2, n <= 2*BLAS_TILE, x and y in L1
+  void blasSgemvL2(int m, int n, float alpha, const float *A, int lda,
+                   const float *x, float beta, float *y, int nc);
+
+#endif
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+#ifndef __HALF_FMT_H__
+#define __HALF_FMT_H__
+
+/*
+ * Half precision formats. Storage is 16 bit in both modes.
+ *
+ * ML_HALF_SIMD (make halfSimd=1) needs a toolchain with the float16 and
+ * float16alt (bfloat16) types and packed two-lane vectors of them (Xf16,
+ * Xf16alt, Xfvec): the kernels then run on the FPU, two lanes per
+ * instruction. Without it every operation is computed in fp32 and rounded
+ * to the format (to nearest even), which gives the same results up to a
+ * rare double rounding, but the cycles are those of the emulation.
+ *
+ * The kernels (mlHalfKern.h, sos_cascade.c) only use the macros below: PFX_TO/PFX_FROM
+ * convert from/to float, PFX_ADD, _SUB, _MUL, _FMA (a*b+c) are scalar,
+ * PFX_VLD, _VST, _VSPLAT, _VLANE, _VADD, _VSUB, _VMUL, _VFMA work on pairs
+ * aligned to 4 bytes, PFX is F16 or BF16.
+ */
+#ifdef ML_HALF_SIMD
+
+typedef float16    mlF16;
+typedef float16alt mlBF16;
+typedef mlF16  v2F16  __attribute__((vector_size (4)));
+typedef mlBF16 v2BF16 __attribute__((vector_size (4)));
+
+#define H_NATIVE_OPS(PFX, T, V)                             \
+  static inline T    PFX##_TO(float x)   { return (T)x; }   \
+  static inline float PFX##_FROM(T x)    { return (float)x; } \
+  static inline T PFX##_ADD(T a, T b)      { return a + b; }  \
+  static inline T PFX##_SUB(T a, T b)      { return a - b; }  \
+  static inline T PFX##_MUL(T a, T b)      { return a * b; }  \
+  static inline T PFX##_FMA(T a, T b, T c) { return a * b + c; } \
+  static inline V PFX##_VLD(const T *p)    { return *(const V *)p; } \
+  static inline void PFX##_VST(T *p, V v)  { *(V *)p = v; }    \
+  static inline V PFX##_VSPLAT(T s)        { return (V){s, s}; } \
+  static inline T PFX##_VLANE(V v, int i)  { return v[i]; }    \
+  static inline V PFX##_VADD(V a, V b)     { return a + b; }   \
+  static inline V PFX##_VSUB(V a, V b)     { return a - b; }   \
+  static inline V PFX##_VMUL(V a, V b)     { return a * b; }   \
+  static inline V PFX##_VFMA(V a, V b, V c) { return a * b + c; }
+
+H_NATIVE_OPS(F16, mlF16, v2F16)
+H_NATIVE_OPS(BF16, mlBF16, v2BF16)
+
+#else
+
+typedef unsigned short mlF16;
+typedef unsigned short mlBF16;
+typedef struct { unsigned short l[2]; } v2F16;
+typedef v2F16 v2BF16;
+
+typedef union { float f; unsigned int u; } mlBits;
+
+// IEEE binary16, round to nearest even, subnormals, inf above 65519
+static inline mlF16 F16_TO(float x)
+{
+  mlBits b;
+  unsigned int s, a;
+
+  b.f = x;
+  s = (b.u >> 16) & 0x8000;
+  a = b.u & 0x7fffffff;
+
+  if (a > 0x7f800000)
+    return s | 0x7e00;
+  if (a >= 0x477ff000)
+    return s | 0x7c00;
+  if (a < 0x38800000) {
+    // multiple of 2^-24: the ulp of [0.5, 1)
+    b.u = a;
+    b.f += 0.5F;
+    return s | (b.u - 0x3f000000);
+  }
+  a += 0xfff + ((a >> 13) & 1);
+  return s | ((a >> 13) - (112 << 10));
+}
+
+static inline float F16_FROM(mlF16 h)
+{
+  mlBits b;
+  unsigned int s = (unsigned int)(h & 0x8000) << 16;
+  unsigned int e = (h >> 10) & 0x1f;
+  unsigned int m = h & 0x3ff;
+
+  if (e == 0x1f)
+    b.u = s | 0x7f800000 | (m << 13);
+  else if (e == 0) {
+    b.f = (float)m * 5.96046448e-8F;
+    b.u |= s;
+  }
+  else
+    b.u = s | ((e + 112) << 23) | (m << 13);
+  return b.f;
+}
+
+// upper half of the float, round to nearest even
+static inline mlBF16 BF16_TO(float x)
+{
+  mlBits b;
+
+  b.f = x;
+  if ((b.u & 0x7fffffff) > 0x7f800000)
+    return (b.u >> 16) | 0x40;
+  return (b.u + 0x7fff + ((b.u >> 16) & 1)) >> 16;
+}
+
+static inline float BF16_FROM(mlBF16 h)
+{
+  mlBits b;
+
+  b.u = (unsigned int)h << 16;
+  return b.f;
+}
+
+#define H_EMUL_OPS(PFX, T, V)                                             \
+  static inline T PFX##_ADD(T a, T b) { return PFX##_TO(PFX##_FROM(a) + PFX##_FROM(b)); } \
+  static inline T PFX##_SUB(T a, T b) { return PFX##_TO(PFX##_FROM(a) - PFX##_FROM(b)); } \
+  static inline T PFX##_MUL(T a, T b) { return PFX##_TO(PFX##_FROM(a) * PFX##_FROM(b)); } \
+  static inline T PFX##_FMA(T a, T b, T c)                                \
+  { return PFX##_TO(PFX##_FROM(a) * PFX##_FROM(b) + PFX##_FROM(c)); }    \
+  static inline V PFX##_VLD(const T *p)   { V v; v.l[0] = p[0]; v.l[1] = p[1]; return v; } \
+  static inline void PFX##_VST(T *p, V v) { p[0] = v.l[0]; p[1] = v.l[1]; } \
+  static inline V PFX##_VSPLAT(T s)       { V v; v.l[0] = s; v.l[1] = s; return v; } \
+  static inline T PFX##_VLANE(V v, int i) { return v.l[i]; }             \
+  static inline V PFX##_VADD(V a, V b)                                    \
+  { V v; v.l[0] = PFX##_ADD(a.l[0], b.l[0]); v.l[1] = PFX##_ADD(a.l[1], b.l[1]); return v; } \
+  static inline V PFX##_VSUB(V a, V b)                                    \
+  { V v; v.l[0] = PFX##_SUB(a.l[0], b.l[0]); v.l[1] = PFX##_SUB(a.l[1], b.l[1]); return v; } \
+  static inline V PFX##_VMUL(V a, V b)                                    \
+  { V v; v.l[0] = PFX##_MUL(a.l[0], b.l[0]); v.l[1] = PFX##_MUL(a.l[1], b.l[1]); return v; } \
+  static inline V PFX##_VFMA(V a, V b, V c)                               \
+  { V v; v.l[0] = PFX##_FMA(a.l[0], b.l[0], c.l[0]); v.l[1] = PFX##_FMA(a.l[1], b.l[1], c.l[1]); return v; }
+
+H_EMUL_OPS(F16, mlF16, v2F16)
+H_EMUL_OPS(BF16, mlBF16, v2BF16)
+
+#endif
+
+#endif
@@ -25,6 +25,9 @@
 #include "math_fns.h"
 
 #include "stdio.h"
+#ifndef LINUX
+#include "pulp.h"
+#endif
 
 
 /*----------------------------------------------------------------------------
@@ -255,8 +258,6 @@
 | shared function implementations. 
 *----------------------------------------------------------------------------*/
 
-#ifndef TRIG
-
 // this is the actual implementation of atan(x)
 // uses a polynomial approximation (nr. 4991)
 // which is precise up to about 7 digits over the range [0,1]
@@ -430,5 +431,280 @@ float fCos(float x)
   }
 
 }
+
+
+/*----------------------------------------------------------------------------
+| batch implementations. the single element kernels are inlined in a loop
+| over MATH_VEC_UNROLL elements, loaded before and stored after the
+| computation so that in place calls do not serialize the elements.
+| polynomials and the exp and log reduction constants are the cephes single
+| precision ones.
+*----------------------------------------------------------------------------*/
+
+#define VFMA(a, b, c) __builtin_fmaf((a), (b), (c))
+
+typedef union { float f; int i; } vBits;
+
+static inline int vToBits(float x)
+{
+  vBits u;
+  u.f = x;
+  return u.i;
+}
+
+static inline float vFromBits(int i)
+{
+  vBits u;
+  u.i = i;
+  return u.f;
+}
+
+// elements [*i0, *i1) of this core
+static inline void vRange(int n, int nc, int *i0, int *i1)
+{
+  int id = 0;
+  int chunk;
+
+#ifndef LINUX
+  if (nc > 1)
+    id = rt_core_id();
 #endif
 
+  if (id >= nc)
+  {
+    *i0 = *i1 = 0;
+    return;
+  }
+
+  chunk = (n + nc - 1) / nc;
+  *i0 = id * chunk;
+  *i1 = *i0 + chunk;
+  if (*i1 > n)
+    *i1 = n;
+  if (*i0 > n)
+    *i0 = n;
+}
+
+// round to nearest, |x| < 2^22
+static inline int vRound(float x)
+{
+  const float magic = 12582912.0f; // 1.5 * 2^23
+  return vToBits(x + magic) - vToBits(magic);
+}
+
+static inline float vExp1(float x)
+{
+  // clamped so that both scale factors stay normal, the product under-
+  // or overflows by itself outside [-87.3, 88.7]
+  x = __builtin_fmaxf(__builtin_fminf(x, 89.0f), -104.0f);
+
+  int   k  = vRound(x * MATH_LOG2_E);
+  float kf = (float) k;
+  float r  = VFMA(-kf, 0.693359375f, x);
+  r = VFMA(-kf, -2.12194440e-4f, r);
+
+  float z = r * r;
+  float p = 1.9875691500E-4f;
+  p = VFMA(p, r, 1.3981999507E-3f);
+  p = VFMA(p, r, 8.3334519073E-3f);
+  p = VFMA(p, r, 4.1665795894E-2f);
+  p = VFMA(p, r, 1.6666665459E-1f);
+  p = VFMA(p, r, 5.0000001201E-1f);
+  p = VFMA(p, z, r) + 1.0f;
+
+  // 2^k in two steps, k in [-150, 129]
+  int k1 = k >> 1;
+  int k2 = k - k1;
+  return p * vFromBits((k1 + 127) << 23) * vFromBits((k2 + 127) << 23);
+}
+
+static inline float vLog1(float x)
+{
+  int i = vToBits(x);
+  int m = i & 0x7fffff;
+
+  // 1 when the mantissa is >= sqrt(2), it is then halved
+  int c = (m + 0x4afb0d) >> 23;
+  float e = (float) (((i >> 23) & 0xff) - 127 + c);
+  float f = vFromBits(m | ((127 - c) << 23)) - 1.0f;
+  float z = f * f;
+
+  float p = 7.0376836292E-2f;
+  p = VFMA(p, f, -1.1514610310E-1f);
+  p = VFMA(p, f, 1.1676998740E-1f);
+  p = VFMA(p, f, -1.2420140846E-1f);
+  p = VFMA(p, f, 1.4249322787E-1f);
+  p = VFMA(p, f, -1.6668057665E-1f);
+  p = VFMA(p, f, 2.0000714765E-1f);
+  p = VFMA(p, f, -2.4999993993E-1f);
+  p = VFMA(p, f, 3.3333331174E-1f);
+
+  float y = p * f * z;
+  y = VFMA(e, -2.12194440e-4f, y);
+  y = VFMA(-0.5f, z, y);
+  y = VFMA(e, 0.693359375f, f + y);
+
+  if (!(x > 0.0f))
+    y = (x == 0.0f) ? vFromBits(0xff800000) : vFromBits(MATH_NAN);
+  if (i == 0x7f800000)
+    y = x;
+  return y;
+}
+
+static inline void vSinCos1(float x, float *s, float *c)
+{
+  float ax = fAbs(x);
+
+  // octant, rounded up to even: the reduced argument is in [-pi/4, pi/4]
+  int   j  = (int) (ax * 1.27323954473516f);
+  j = (j + 1) & ~1;
+  float yj = (float) j;
+
+  // pi/4 split in three floats (72 bits). yj*C1 is a multiple of 2^-23 and
+  // so is ax above 1: the first fmadd is exact below 2^23, the other two
+  // round once, so r keeps its relative precision next to the zeros
+  float r = VFMA(-yj, 7.853981853e-01f, ax);
+  r = VFMA(-yj, -2.185569414e-08f, r);
+  r = VFMA(-yj, -8.575622550e-16f, r);
+
+  float z = r * r;
+  float ps = -1.9515295891E-4f;
+  ps = VFMA(ps, z, 8.3321608736E-3f);
+  ps = VFMA(ps, z, -1.6666654611E-1f);
+  ps = VFMA(ps, z * r, r);
+
+  float pc = 2.443315711809948E-5f;
+  pc = VFMA(pc, z, -1.388731625493765E-3f);
+  pc = VFMA(pc, z, 4.166664568298827E-2f);
+  pc = VFMA(pc, z * z, VFMA(-0.5f, z, 1.0f));
+
+  // quadrant q = j/2: sin is ps, pc, -ps, -pc and cos pc, -ps, -pc, ps
+  int q    = (j >> 1) & 3;
+  int swap = q & 1;
+  int ssgn = ((q >> 1) ^ (vToBits(x) >> 31)) & 1;
+  int csgn = ((q + 1) >> 1) & 1;
+
+  float sv = swap ? pc : ps;
+  float cv = swap ? ps : pc;
+  *s = vFromBits(vToBits(sv) ^ (ssgn << 31));
+  *c = vFromBits(vToBits(cv) ^ (csgn << 31));
+}
+
+static inline float vAtan21(float y, float x)
+{
+  float ax = fAbs(x);
+  float ay = fAbs(y);
+  float mn = __builtin_fminf(ax, ay);
+  float mx = __builtin_fmaxf(ax, ay);
+
+  // above tan(pi/8), atan(t) = pi/4 + atan((t - 1) / (t + 1)), one division
+  int   big = mn > 0.414213562373095f * mx;
+  float num = big ? mn - mx : mn;
+  float den = big ? mn + mx : mx;
+  float t   = (den > 0.0f) ? fDiv(num, den) : 0.0f;
+
+  float z = t * t;
+  float p = 8.05374449538e-2f;
+  p = VFMA(p, z, -1.38776856032E-1f);
+  p = VFMA(p, z, 1.99777106478E-1f);
+  p = VFMA(p, z, -3.33329491539E-1f);
+  float a = VFMA(p, z * t, t);
+  a += big ? MATH_0_25PI : 0.0f;
+
+  if (ay > ax)
+    a = MATH_0_5PI - a;
+  if (vToBits(x) < 0)
+    a = MATH_PI - a;
+  return vFromBits(vToBits(a) ^ (vToBits(y) & 0x80000000));
+}
+
+void fExpv(const float *x, float *y, int n, int nc)
+{
+  float v[MATH_VEC_UNROLL];
+  int i, u, i0, i1;
+
+  vRange(n, nc, &i0, &i1);
+
+  for (i = i0; i + MATH_VEC_UNROLL <= i1; i += MATH_VEC_UNROLL)
+  {
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+      v[u] = x[i+u];
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+      v[u] = vExp1(v[u]);
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+      y[i+u] = v[u];
+  }
+  for ( ; i < i1; i++)
+    y[i] = vExp1(x[i]);
+}
+
+void fLogv(const float *x, float *y, int n, int nc)
+{
+  float v[MATH_VEC_UNROLL];
+  int i, u, i0, i1;
+
+  vRange(n, nc, &i0, &i1);
+
+  for (i = i0; i + MATH_VEC_UNROLL <= i1; i += MATH_VEC_UNROLL)
+  {
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+      v[u] = x[i+u];
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+      v[u] = vLog1(v[u]);
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+      y[i+u] = v[u];
+  }
+  for ( ; i < i1; i++)
+    y[i] = vLog1(x[i]);
+}
+
+void fSinCosv(const float *x, float *s, float *c, int n, int nc)
+{
+  float v[MATH_VEC_UNROLL], vs[MATH_VEC_UNROLL], vc[MATH_VEC_UNROLL];
+  int i, u, i0, i1;
+
+  vRange(n, nc, &i0, &i1);
+
+  for (i = i0; i + MATH_VEC_UNROLL <= i1; i += MATH_VEC_UNROLL)
+  {
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+      v[u] = x[i+u];
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+      vSinCos1(v[u], &vs[u], &vc[u]);
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+    {
+      s[i+u] = vs[u];
+      c[i+u] = vc[u];
+    }
+  }
+  for ( ; i < i1; i++)
+  {
+    float ts, tc;
+    vSinCos1(x[i], &ts, &tc);
+    s[i] = ts;
+    c[i] = tc;
+  }
+}
+
+void fAtan2v(const float *y, const float *x, float *z, int n, int nc)
+{
+  float vy[MATH_VEC_UNROLL], vx[MATH_VEC_UNROLL];
+  int i, u, i0, i1;
+
+  vRange(n, nc, &i0, &i1);
+
+  for (i = i0; i + MATH_VEC_UNROLL <= i1; i += MATH_VEC_UNROLL)
+  {
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+    {
+      vy[u] = y[i+u];
+      vx[u] = x[i+u];
+    }
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+      vy[u] = vAtan21(vy[u], vx[u]);
+    for (u = 0; u < MATH_VEC_UNROLL; u++)
+      z[i+u] = vy[u];
+  }
+  for ( ; i < i1; i++)
+    z[i] = vAtan21(y[i], x[i]);
+}
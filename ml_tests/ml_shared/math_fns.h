@@ -30,6 +30,7 @@
 #define MATH_PI          3.141592653589793F
 #define MATH_2PI         6.283185307179586F
 #define MATH_0_5PI       1.570796326794897F
+#define MATH_0_25PI      0.785398163397448F
 #define MATH_1_5PI       4.712388980384690F
 
 #define MATH_LOG2_10     3.321928094887362F
@@ -135,19 +136,10 @@
 
 /*----------------------------------------------------------------------------
 | these functions are the same for LNS and regular FP.
+| (the OpenRISC lf.sin/lf.cos/lf.atan intrinsics of the former TRIG option
+| do not exist on the RISC-V cores, the software versions are always used)
 *----------------------------------------------------------------------------*/
 
-// enable this for trigonometric intrinsics
-#ifdef TRIG
-  static inline float fCos(float x);
-  static inline float fAtan2(float y, float x);
-  static inline float fSin(float x);
-  static inline float fTan(float x);
-  static inline float fCot(float x);
-  static inline float fAtan(float x);
-  static inline float fAsin(float x);
-  static inline float fAcos(float x);
-#else
   // wrapper functions which determine 
   // the quadrant and call the actual implementation
   // precise to about 6.7 digits
@@ -163,11 +155,38 @@
   static inline float fAtan(float x);
   static inline float fAsin(float x);
   static inline float fAcos(float x);
-#endif
 
 // mask away the sign bit
 static inline float fAbs(float x);
 
+/*----------------------------------------------------------------------------
+| batch versions over arrays, y[i] = f(x[i]) for 0 <= i < n.
+| the range reduction is branch free and the polynomials are evaluated with
+| fused multiply-adds on MATH_VEC_UNROLL independent elements at a time, so
+| that the fmadd latencies overlap. exp and log are within 1 ulp of the
+| correctly rounded result, atan2 within 3 (measured by mlMathv); sin and
+| cos within 1.6 ulp of the exact result for |x| < 8192 (sampled against
+| double, densely next to the multiples of pi/2), 1.5 of it from the
+| polynomials.
+|
+| the elements are split over the cores as the core ranges of mlShared.h.
+| in and out arrays may be the same.
+*----------------------------------------------------------------------------*/
+
+#define MATH_VEC_UNROLL 4
+
+  // exp(x), x in [-87.3, 88.7], 0 below and +inf above
+  void fExpv(const float *x, float *y, int n, int nc);
+
+  // natural log, x > 0 normal (nan for x < 0, -inf for 0, +inf for +inf)
+  void fLogv(const float *x, float *y, int n, int nc);
+
+  // sin and cos at once, |x| < 8192
+  void fSinCosv(const float *x, float *s, float *c, int n, int nc);
+
+  // atan2(y, x) in [-pi, pi]
+  void fAtan2v(const float *y, const float *x, float *z, int n, int nc);
+
 static inline char fIsNan(float x);
 static inline char fIsInf(float x);
 
@@ -239,64 +258,18 @@ return a / b;
 
 static inline float fSin(float x)
 {
-#ifdef TRIG
-  float pi2 = MATH_0_5PI;
-  asm ("lf.sca.s %[c], %[a], %[b]": [c] "=r" (x): [a] "r"  (x), [b] "r" (pi2));
-  asm ("lf.sin.s %[c], %[a]"      : [c] "=r" (x): [a] "r"  (x));
-  return x;
-#else
   return fCos(MATH_0_5PI - x);
-#endif
 }
 
-#ifdef TRIG
-static inline float fCos(float x)
-{
-  float pi2 = MATH_0_5PI;
-  asm ("lf.sca.s %[c], %[a], %[b]": [c] "=r" (x): [a] "r"  (x), [b] "r" (pi2));
-  asm ("lf.cos.s %[c], %[a]"      : [c] "=r" (x): [a] "r"  (x));
-  return x;
-}
-#endif
-
-#ifdef TRIG
-static inline float fAtan2(float y, float x)
-{
-  float pi2 = MATH_0_5PI;
-  asm ("lf.ata.s  %[c], %[a], %[b]"     : [c] "=r" (x): [a] "r"  (y), [b] "r"(x));
-  asm ("lf.atan.s %[c], %[a], %[b]"     : [c] "=r" (x): [a] "r"  (x), [b] "r"(y));
-  asm ("lf.atl.s  %[c], %[a]"           : [c] "=r" (x): [a] "r"  (x));
-  return (x*pi2);
-}
-#endif
-
 // derived trig functions
 static inline float fTan(float x)
 {
-  #ifdef TRIG
-    float pi2 = MATH_0_5PI;
-    float y;
-    asm ("lf.sca.s %[c], %[a], %[b]": [c] "=r" (x): [a] "r"  (x), [b] "r" (pi2));
-    asm ("lf.sin.s %[c], %[a]"      : [c] "=r" (y): [a] "r"  (x));
-    asm ("lf.cos.s %[c], %[a]"      : [c] "=r" (x): [a] "r"  (x));
-    return y/x;
-  #else
-    return fDiv(fSin(x),fCos(x));
-  #endif
+  return fDiv(fSin(x),fCos(x));
 }
 
 static inline float fCot(float x)
 {
-  #ifdef TRIG  
-    float pi2 = MATH_0_5PI;
-    float y;
-    asm ("lf.sca.s %[c], %[a], %[b]": [c] "=r" (x): [a] "r"  (x), [b] "r" (pi2));
-    asm ("lf.sin.s %[c], %[a]"      : [c] "=r" (y): [a] "r"  (x));
-    asm ("lf.cos.s %[c], %[a]"      : [c] "=r" (x): [a] "r"  (x));
-    return x/y;
-  #else
-    return fDiv(fCos(x),fSin(x));
-  #endif  
+  return fDiv(fCos(x),fSin(x));
 }
 
 static inline float fAtan(float x)
@@ -40,6 +40,11 @@
 // number of cores in the cluster
 #define N_CORES 16
 
+// core ranges, for the kernels taking a core count nc: nc > 1 splits the
+// work in contiguous ranges over cores 0..nc-1, with no synchronization
+// inside. cores 0..nc-1 call the kernel with the same arguments and the
+// caller puts a barrier after it. nc = 1 is a plain call.
+
 
 
 // platform dependent includes
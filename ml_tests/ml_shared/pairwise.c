@@ -0,0 +1,359 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/*----------------------------------------------------------------------------
+| tiled pairwise distances and rbf kernel matrices, see pairwise.h.
+*----------------------------------------------------------------------------*/
+
+#include "pairwise.h"
+#include "math_fns.h"
+#ifndef LINUX
+#include "pulp.h"
+#else
+#include <string.h>
+#define synch_barrier()
+#define RT_LOCAL_DATA
+#endif
+
+#define PFMA(a, b, c) __builtin_fmaf((a), (b), (c))
+
+  // chunks of X and Y, tiles of K (accumulated in place) and the norms of
+  // the rows of the tile, double buffered but the norms
+  RT_LOCAL_DATA static float pwX[2][PW_BI * PW_KC];
+  RT_LOCAL_DATA static float pwY[2][PW_BJ * PW_KC];
+  RT_LOCAL_DATA static float pwK[2][PW_BI * PW_BJ];
+  RT_LOCAL_DATA static float pwXn[PW_BI];
+  RT_LOCAL_DATA static float pwYn[PW_BJ];
+
+// every core of the cluster runs the function, also with nc = 1
+static inline int pwCore(void)
+{
+#ifndef LINUX
+  return rt_core_id();
+#else
+  return 0;
+#endif
+}
+
+// rows [*r0, *r1) of n of this core
+static inline void pwRows(int n, int nc, int *r0, int *r1)
+{
+  int id = pwCore();
+  int chunk = (n + nc - 1) / nc;
+
+  *r0 = (id < nc) ? id * chunk : n;
+  *r1 = *r0 + chunk;
+  if (*r1 > n)
+    *r1 = n;
+  if (*r0 > n)
+    *r0 = n;
+}
+
+static inline int pwMin(int a, int b)
+{
+  return a < b ? a : b;
+}
+
+// rows x cols floats with leading dimension ld in L2, packed in L1
+static inline int pwLoadRows(const float *ext, int ld, float *loc, int rows, int cols)
+{
+#ifndef LINUX
+  if (ld == cols)
+    return plp_dma_memcpy((unsigned int) ext, (unsigned int) loc, rows * cols * sizeof(float),
+                          PLP_DMA_EXT2LOC);
+  return plp_dma_memcpy_2d((unsigned int) ext, (unsigned int) loc, rows * cols * sizeof(float),
+                           ld * sizeof(float), cols * sizeof(float), PLP_DMA_EXT2LOC);
+#else
+  int i;
+  for (i = 0; i < rows; i++)
+    memcpy(loc + i * cols, ext + i * ld, cols * sizeof(float));
+  return 0;
+#endif
+}
+
+static inline int pwStoreRows(float *ext, int ld, const float *loc, int rows, int cols)
+{
+#ifndef LINUX
+  if (ld == cols)
+    return plp_dma_memcpy((unsigned int) ext, (unsigned int) loc, rows * cols * sizeof(float),
+                          PLP_DMA_LOC2EXT);
+  return plp_dma_memcpy_2d((unsigned int) ext, (unsigned int) loc, rows * cols * sizeof(float),
+                           ld * sizeof(float), cols * sizeof(float), PLP_DMA_LOC2EXT);
+#else
+  int i;
+  for (i = 0; i < rows; i++)
+    memcpy(ext + i * ld, loc + i * cols, cols * sizeof(float));
+  return 0;
+#endif
+}
+
+static inline void pwWait(int id)
+{
+#ifndef LINUX
+  plp_dma_wait(id);
+#else
+  (void)id;
+#endif
+}
+
+// one term of the sums: the product, or the squared difference
+static inline float pwTerm(float a, float b, float s, int direct)
+{
+  float e = a - b;
+  return direct ? PFMA(e, e, s) : PFMA(a, b, s);
+}
+
+/*----------------------------------------------------------------------------
+| rows [r0, r1) of the tile acc (bi x bj) over a chunk of kc dimensions, xc
+| and yc packed rows of kc; first starts the sums. two rows by four columns
+| per pass, eight independent sums on six loads per dimension. inlined with
+| a constant direct.
+*----------------------------------------------------------------------------*/
+static inline void pwTile(const float *xc, const float *yc, float *acc, int r0, int r1,
+                          int bj, int kc, int first, int direct)
+{
+  int i, j, k;
+
+  for (i = r0; i + 2 <= r1; i += 2)
+  {
+    const float *x0 = xc + i * kc;
+    const float *x1 = x0 + kc;
+    float *a0 = acc + i * bj;
+    float *a1 = a0 + bj;
+
+    for (j = 0; j + 4 <= bj; j += 4)
+    {
+      const float *y0 = yc + j * kc;
+      const float *y1 = y0 + kc;
+      const float *y2 = y1 + kc;
+      const float *y3 = y2 + kc;
+      float s00 = 0.0F, s01 = 0.0F, s02 = 0.0F, s03 = 0.0F;
+      float s10 = 0.0F, s11 = 0.0F, s12 = 0.0F, s13 = 0.0F;
+
+      if (!first)
+      {
+        s00 = a0[j]; s01 = a0[j + 1]; s02 = a0[j + 2]; s03 = a0[j + 3];
+        s10 = a1[j]; s11 = a1[j + 1]; s12 = a1[j + 2]; s13 = a1[j + 3];
+      }
+
+      for (k = 0; k < kc; k++)
+      {
+        float u0 = x0[k], u1 = x1[k];
+        float v0 = y0[k], v1 = y1[k], v2 = y2[k], v3 = y3[k];
+        s00 = pwTerm(u0, v0, s00, direct);
+        s01 = pwTerm(u0, v1, s01, direct);
+        s02 = pwTerm(u0, v2, s02, direct);
+        s03 = pwTerm(u0, v3, s03, direct);
+        s10 = pwTerm(u1, v0, s10, direct);
+        s11 = pwTerm(u1, v1, s11, direct);
+        s12 = pwTerm(u1, v2, s12, direct);
+        s13 = pwTerm(u1, v3, s13, direct);
+      }
+
+      a0[j] = s00; a0[j + 1] = s01; a0[j + 2] = s02; a0[j + 3] = s03;
+      a1[j] = s10; a1[j + 1] = s11; a1[j + 2] = s12; a1[j + 3] = s13;
+    }
+
+    for (; j < bj; j++)
+    {
+      const float *y0 = yc + j * kc;
+      float s0 = first ? 0.0F : a0[j];
+      float s1 = first ? 0.0F : a1[j];
+
+      for (k = 0; k < kc; k++)
+      {
+        s0 = pwTerm(x0[k], y0[k], s0, direct);
+        s1 = pwTerm(x1[k], y0[k], s1, direct);
+      }
+      a0[j] = s0;
+      a1[j] = s1;
+    }
+  }
+
+  for (; i < r1; i++)
+  {
+    const float *x0 = xc + i * kc;
+    float *a0 = acc + i * bj;
+
+    for (j = 0; j < bj; j++)
+    {
+      const float *y0 = yc + j * kc;
+      float s0 = first ? 0.0F : a0[j];
+
+      for (k = 0; k < kc; k++)
+        s0 = pwTerm(x0[k], y0[k], s0, direct);
+      a0[j] = s0;
+    }
+  }
+}
+
+// squared norms of rows [r0, r1) of a chunk, added to nrm
+static void pwNorms(const float *c, float *nrm, int r0, int r1, int kc, int first)
+{
+  int i, k;
+
+  for (i = r0; i < r1; i++)
+  {
+    const float *ci = c + i * kc;
+    float s0 = first ? 0.0F : nrm[i];
+    float s1 = 0.0F;
+
+    for (k = 0; k + 2 <= kc; k += 2)
+    {
+      s0 = PFMA(ci[k], ci[k], s0);
+      s1 = PFMA(ci[k + 1], ci[k + 1], s1);
+    }
+    if (k < kc)
+      s0 = PFMA(ci[k], ci[k], s0);
+    nrm[i] = s0 + s1;
+  }
+}
+
+// rows [r0, r1) of the tile from the sums to the kernel
+static void pwFinish(int kind, float gamma, float *acc, int r0, int r1, int bj, int direct)
+{
+  int i, j;
+  float v;
+
+  for (i = r0; i < r1; i++)
+  {
+    float *ai = acc + i * bj;
+
+    for (j = 0; j < bj; j++)
+    {
+      v = ai[j];
+      if (!direct)
+      {
+        v = pwXn[i] + pwYn[j] - 2.0F * v;
+        v = v < 0.0F ? 0.0F : v;
+      }
+      if (kind == PW_DIST)
+        v = fSqrt(v);
+      else if (kind == PW_RBF)
+        v = -gamma * v;
+      ai[j] = v;
+    }
+  }
+
+  if (kind == PW_RBF && r1 > r0)
+    fExpv(acc + r0 * bj, acc + r0 * bj, (r1 - r0) * bj, 1);
+}
+
+/*----------------------------------------------------------------------------
+| step s is chunk s % nkb of tile s / nkb, the tiles go along the rows of K.
+| the chunks of step s are in buffer s & 1 and the load of step s+1 is
+| issued once they have landed: the barrier closing step s-1 released its
+| buffer. the tile t accumulates in pwK[t & 1], written back under the
+| computation of tile t+1; the write back of tile t-2 from the same buffer
+| is waited before tile t starts.
+*----------------------------------------------------------------------------*/
+
+// loads of the chunks of step s
+static void pwIssue(int s, int n, int m, int d, int njb, int nkb,
+                    const float *X, const float *Y, int *inX, int *inY)
+{
+  int t = s / nkb, kb = s % nkb;
+  int ib = t / njb, jb = t % njb;
+  int kc = pwMin(PW_KC, d - kb * PW_KC);
+
+  *inX = pwLoadRows(X + ib * PW_BI * d + kb * PW_KC, d, pwX[s & 1],
+                    pwMin(PW_BI, n - ib * PW_BI), kc);
+  *inY = pwLoadRows(Y + jb * PW_BJ * d + kb * PW_KC, d, pwY[s & 1],
+                    pwMin(PW_BJ, m - jb * PW_BJ), kc);
+}
+
+void pwPairwise(int kind, int n, int m, int d, float gamma,
+                const float *X, const float *Y, float *K, int nc)
+{
+  int id = pwCore();
+  int nib = (n + PW_BI - 1) / PW_BI;
+  int njb = (m + PW_BJ - 1) / PW_BJ;
+  int nkb = (d + PW_KC - 1) / PW_KC;
+  int nt = nib * njb;
+  int ns = nt * nkb;
+  int direct = d < PW_GEMM_D;
+  int inX = 0, inY = 0;
+  int out[2] = { 0, 0 };
+  int r0 = 0, r1 = 0;
+  int s, t, ib, jb, kb, bi, bj, kc, first, c0, c1;
+  float *acc;
+
+  if (id == 0 && ns > 0)
+    pwIssue(0, n, m, d, njb, nkb, X, Y, &inX, &inY);
+
+  for (s = 0; s < ns; s++)
+  {
+    t = s / nkb;
+    kb = s % nkb;
+    ib = t / njb;
+    jb = t % njb;
+    bi = pwMin(PW_BI, n - ib * PW_BI);
+    bj = pwMin(PW_BJ, m - jb * PW_BJ);
+    kc = pwMin(PW_KC, d - kb * PW_KC);
+    first = (kb == 0);
+    acc = pwK[t & 1];
+
+    if (id == 0)
+    {
+      pwWait(inX);
+      pwWait(inY);
+      if (first && t >= 2)
+        pwWait(out[t & 1]);
+      if (s + 1 < ns)
+        pwIssue(s + 1, n, m, d, njb, nkb, X, Y, &inX, &inY);
+    }
+
+    synch_barrier();
+
+    if (id < nc)
+    {
+      pwRows(bi, nc, &r0, &r1);
+      if (direct)
+        pwTile(pwX[s & 1], pwY[s & 1], acc, r0, r1, bj, kc, first, 1);
+      else
+      {
+        pwTile(pwX[s & 1], pwY[s & 1], acc, r0, r1, bj, kc, first, 0);
+        pwRows(bj, nc, &c0, &c1);
+        pwNorms(pwX[s & 1], pwXn, r0, r1, kc, first);
+        pwNorms(pwY[s & 1], pwYn, c0, c1, kc, first);
+      }
+    }
+
+    synch_barrier();
+
+    if (kb == nkb - 1)
+    {
+      if (id < nc)
+        pwFinish(kind, gamma, acc, r0, r1, bj, direct);
+
+      synch_barrier();
+
+      if (id == 0)
+        out[t & 1] = pwStoreRows(K + ib * PW_BI * m + jb * PW_BJ, m, acc, bi, bj);
+    }
+  }
+
+  if (id == 0)
+  {
+    if (nt > 1)
+      pwWait(out[nt & 1]);
+    if (nt > 0)
+      pwWait(out[(nt - 1) & 1]);
+  }
+}
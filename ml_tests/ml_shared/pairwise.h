@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/*----------------------------------------------------------------------------
+| tiled pairwise distances and rbf kernel matrices for the cluster, on point
+| sets in L2: K[i*m + j] = f(X_i, Y_j) for the n rows of X and the m rows of
+| Y (d dimensions, both row major), K n x m row major.
+|
+| K is computed in tiles of PW_BI x PW_BJ, each over chunks of PW_KC
+| dimensions: core 0 drives the cluster DMA, the rows of the tile and the
+| chunk of X and Y are double buffered in L1 so that the next chunk loads
+| (and the previous tile is written back) under the computation. the cores
+| share the rows of the tile; like the *L2 variants of blas_l12 every core
+| of the cluster calls the function, the ones from nc on only take part in
+| the barriers.
+|
+| from d = PW_GEMM_D on the squared distances come from the dot products,
+| |x|^2 + |y|^2 - 2 x'y, like a gemm (two rows by four columns in registers,
+| the norms on the side); below it the differences are squared directly,
+| the norms would cost as much as the products. the gemm form loses the
+| low bits of the distances of near points (relative to |x|^2 + |y|^2), it
+| is clamped at 0. the rbf kernels are exponentiated in batches with fExpv.
+*----------------------------------------------------------------------------*/
+#ifndef __PAIRWISE_H__
+#define __PAIRWISE_H__
+
+// rows of X and of Y per tile, dimensions per chunk, multiples of 4
+#ifndef PW_BI
+#define PW_BI 32
+#endif
+#ifndef PW_BJ
+#define PW_BJ 32
+#endif
+#ifndef PW_KC
+#define PW_KC 32
+#endif
+
+// dimensions from which the gemm form is used
+#ifndef PW_GEMM_D
+#define PW_GEMM_D 16
+#endif
+
+// kernels
+#define PW_DIST2 0      // |x - y|^2
+#define PW_DIST  1      // |x - y|
+#define PW_RBF   2      // exp(-gamma |x - y|^2)
+
+  // K = f(X, Y), kind PW_DIST2, PW_DIST or PW_RBF (gamma is only used by
+  // PW_RBF), X, Y and K in L2
+  void pwPairwise(int kind, int n, int m, int d, float gamma,
+                  const float *X, const float *Y, float *K, int nc);
+
+#endif
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/*----------------------------------------------------------------------------
+| multi-channel biquad cascades, see sos_cascade.h.
+*----------------------------------------------------------------------------*/
+
+#include "sos_cascade.h"
+#ifndef LINUX
+#include "pulp.h"
+#endif
+
+#define SFMA(a, b, c) __builtin_fmaf((a), (b), (c))
+
+static inline int sosId(int nc)
+{
+#ifndef LINUX
+  if (nc > 1)
+    return rt_core_id();
+#endif
+  (void)nc;
+  return 0;
+}
+
+// pairs of channels [*p0, *p1) of this core
+static inline void sosPairs(int nch, int nc, int *p0, int *p1)
+{
+  int np = nch >> 1;
+  int id = sosId(nc);
+  int chunk = (np + nc - 1) / nc;
+
+  *p0 = (id < nc) ? id * chunk : np;
+  *p1 = *p0 + chunk;
+  if (*p1 > np)
+    *p1 = np;
+  if (*p0 > np)
+    *p0 = np;
+}
+
+static inline float sosAbs(float v)
+{
+  return v < 0.0F ? -v : v;
+}
+
+// section s of sos, divided by a0: b0 b1 b2 a1 a2
+static void sosRow(const float *sos, int nsect, int s, float r[5])
+{
+  float a0 = sos[s + nsect * 3];
+
+  r[0] = sos[s] / a0;
+  r[1] = sos[s + nsect] / a0;
+  r[2] = sos[s + nsect * 2] / a0;
+  r[3] = sos[s + nsect * 4] / a0;
+  r[4] = sos[s + nsect * 5] / a0;
+}
+
+int sosInitF32(sosF32 *f, const float *sos, int nsect)
+{
+  int s;
+
+  if (nsect < 1 || nsect > SOS_MAX_SECT)
+    return -1;
+
+  f->nsect = nsect;
+  for (s = 0; s < nsect; s++)
+    sosRow(sos, nsect, s, f->c[s]);
+
+  return 0;
+}
+
+int sosInitF16(sosF16 *f, const float *sos, int nsect)
+{
+  float r[SOS_MAX_SECT][5];
+  float gain = 1.0F;
+  float num, den, g;
+  int s, k;
+
+  if (nsect < 1 || nsect > SOS_MAX_SECT)
+    return -1;
+
+  // dc gain of each section out of its numerator, unless it has a zero
+  // (or a pole) at dc
+  for (s = 0; s < nsect; s++)
+  {
+    sosRow(sos, nsect, s, r[s]);
+    num = r[s][0] + r[s][1] + r[s][2];
+    den = 1.0F + r[s][3] + r[s][4];
+    g = 1.0F;
+    if (sosAbs(num) > 1e-3F * (sosAbs(r[s][0]) + sosAbs(r[s][1]) + sosAbs(r[s][2])) &&
+        den != 0.0F)
+      g = num / den;
+    for (k = 0; k < 3; k++)
+      r[s][k] /= g;
+    gain *= g;
+  }
+
+  f->nsect = nsect;
+  for (s = 0; s < nsect; s++)
+  {
+    g = (s == nsect - 1) ? gain : 1.0F;
+    for (k = 0; k < 3; k++)
+      f->c[s][k] = F16_TO(r[s][k] * g);
+    f->c[s][3] = F16_TO(r[s][4]);
+    f->c[s][4] = F16_TO(-(1.0F + r[s][3] + r[s][4]));
+  }
+
+  return 0;
+}
+
+// one section on the block of a pair of channels, the two are independent
+// chains. z: z1 z2 of both
+static void sectF32(const float *c, float *z, float *x, int nch, int len)
+{
+  float b0 = c[0], b1 = c[1], b2 = c[2];
+  float na1 = -c[3], na2 = -c[4];
+  float za1 = z[0], za2 = z[1], zb1 = z[2], zb2 = z[3];
+  float xa, xb, ya, yb;
+  int t;
+
+  for (t = 0; t < len; t++, x += nch)
+  {
+    xa = x[0];
+    xb = x[1];
+    ya = SFMA(b0, xa, za1);
+    yb = SFMA(b0, xb, zb1);
+    za1 = SFMA(na1, ya, SFMA(b1, xa, za2));
+    zb1 = SFMA(na1, yb, SFMA(b1, xb, zb2));
+    za2 = SFMA(na2, ya, b2 * xa);
+    zb2 = SFMA(na2, yb, b2 * xb);
+    x[0] = ya;
+    x[1] = yb;
+  }
+
+  z[0] = za1;
+  z[1] = za2;
+  z[2] = zb1;
+  z[3] = zb2;
+}
+
+// one section in delta form on the block of a pair of channels, one lane
+// each. z: x1 x2 y1 d1, y1 enters the last multiply-add of d
+static void sectF16(const mlF16 *c, mlF16 *z, mlF16 *x, int nch, int len)
+{
+  v2F16 b0 = F16_VSPLAT(c[0]), b1 = F16_VSPLAT(c[1]), b2 = F16_VSPLAT(c[2]);
+  v2F16 c1 = F16_VSPLAT(c[3]), c2 = F16_VSPLAT(c[4]);
+  v2F16 x1 = F16_VLD(z), x2 = F16_VLD(z + 2);
+  v2F16 y1 = F16_VLD(z + 4), d1 = F16_VLD(z + 6);
+  v2F16 in, d;
+  int t;
+
+  for (t = 0; t < len; t++, x += nch)
+  {
+    in = F16_VLD(x);
+    d = F16_VMUL(b0, in);
+    d = F16_VFMA(b1, x1, d);
+    d = F16_VFMA(b2, x2, d);
+    d = F16_VFMA(c1, d1, d);
+    d = F16_VFMA(c2, y1, d);
+    x2 = x1;
+    x1 = in;
+    d1 = d;
+    y1 = F16_VADD(y1, d);
+    F16_VST(x, y1);
+  }
+
+  F16_VST(z, x1);
+  F16_VST(z + 2, x2);
+  F16_VST(z + 4, y1);
+  F16_VST(z + 6, d1);
+}
+
+void sosRunF32(const sosF32 *f, float *z, float *x, int nch, int len, int nc)
+{
+  int p0, p1, p, s;
+
+  sosPairs(nch, nc, &p0, &p1);
+
+  for (p = p0; p < p1; p++)
+    for (s = 0; s < f->nsect; s++)
+      sectF32(f->c[s], z + (p * f->nsect + s) * 4, x + 2 * p, nch, len);
+}
+
+void sosRunF16(const sosF16 *f, mlF16 *z, mlF16 *x, int nch, int len, int nc)
+{
+  int p0, p1, p, s;
+
+  sosPairs(nch, nc, &p0, &p1);
+
+  for (p = p0; p < p1; p++)
+    for (s = 0; s < f->nsect; s++)
+      sectF16(f->c[s], z + (p * f->nsect + s) * 8, x + 2 * p, nch, len);
+}
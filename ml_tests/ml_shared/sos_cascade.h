@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente luca.valente2@unibo.it
+ */
+/*----------------------------------------------------------------------------
+| multi-channel biquad cascades (second order sections) for the cluster, in
+| fp32 and in packed fp16 (half_fmt.h), in place on channel-interleaved
+| blocks: sample t of channel ch is x[t * nch + ch], nch even.
+|
+| The filters stream: the state of every channel is kept by the caller
+| between the blocks (zeroed before the first one, SOS_F32_STATE or
+| SOS_F16_STATE elements) and a block can have any length. Inside a block
+| a pair of channels runs through one section at a time, the coefficients
+| and the state of the section stay in registers for the whole block.
+|
+| The pairs of channels are split over the cores as the core ranges of
+| mlShared.h.
+|
+| The coefficients come from sos, nsect rows of [b0 b1 b2 a0 a1 a2] stored
+| column major (sos[s + nsect * j]), like the SOS matrix of mlButter.
+|
+| fp32 runs the transposed direct form II of mlButter. The fp16 sections
+| are scaled to unity gain at dc (the total gain goes to the last one) and
+| run in delta form, on the increment d of the output:
+|   d = b0 x + b1 x1 + b2 x2 + a2 d1 - (1 + a1 + a2) y1,  y = y1 + d
+| with the poles close to z = 1 (low cutoff, as the eeg filters) 1 + a1 + a2
+| is small and keeps its relative precision, rounding a1 and a2 to fp16
+| instead would move the poles. In fp16 the error is a few units of the
+| rounding of the output (0.3% of the range for mlButter), sections with a
+| zero at dc keep their gain.
+*----------------------------------------------------------------------------*/
+
+#ifndef __SOS_CASCADE_H__
+#define __SOS_CASCADE_H__
+
+#include "half_fmt.h"
+
+#define SOS_MAX_SECT  8
+
+// state elements of nch channels
+#define SOS_F32_STATE(nch, nsect) ((nch) * (nsect) * 2)
+#define SOS_F16_STATE(nch, nsect) ((nch) * (nsect) * 4)
+
+typedef struct
+{
+  int nsect;
+  float c[SOS_MAX_SECT][5];   // b0 b1 b2 a1 a2, divided by a0
+} sosF32;
+
+typedef struct
+{
+  int nsect;
+  mlF16 c[SOS_MAX_SECT][5];   // b0 b1 b2 a2 -(1 + a1 + a2), scaled
+} sosF16;
+
+// nsect <= SOS_MAX_SECT, returns 0, -1 otherwise
+int sosInitF32(sosF32 *f, const float *sos, int nsect);
+int sosInitF16(sosF16 *f, const float *sos, int nsect);
+
+void sosRunF32(const sosF32 *f, float *z, float *x, int nch, int len, int nc);
+void sosRunF16(const sosF16 *f, mlF16 *z, mlF16 *x, int nch, int len, int nc);
+
+#endif
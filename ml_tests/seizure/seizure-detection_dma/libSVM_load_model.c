@@ -8,6 +8,8 @@
 #include "init.h"
 //#include "modelSVM.h"
 #include "libSVM_predict.h"
+#include <omp.h>
+#include "math_fns.h"
 
 #include "pulp.h"
 
@@ -67,3 +69,72 @@ void svm_load_model()
 	printf("load model %d \n", (int) (1000.0F *model->param.gamma));
 #endif
         }
+
+extern float data_model_l2[315][37];
+
+// dense copy of the model in L1, quantized as selected by SVM_QUANT. The
+// SVs are read once from data_model_l2, split across the cores.
+svm_dense_model *svm_load_dense_model(const svm_model *src)
+{
+        int i, f;
+        int l = src->l;
+        float inv[SVM_DIM];
+        svm_dense_model *m;
+
+        m = (svm_dense_model *) plp_alloc_l1((int)(sizeof(svm_dense_model)));
+        m->coef = (float *) plp_alloc_l1((int)(sizeof(float)*l));
+        m->sv = (svm_feat *) plp_alloc_l1((int)(sizeof(svm_feat)*l*SVM_DIM));
+        m->l = l;
+        m->gamma = src->param.gamma;
+        m->rho = src->rho[0];
+        m->label[0] = src->label[0];
+        m->label[1] = src->label[1];
+
+        #pragma omp parallel default(none) private(i, f) shared(m, l, inv, data_model_l2) num_threads(CORE)
+        {
+                #if SVM_QUANT == 8
+                #pragma omp for
+                for (f = 0; f < SVM_DIM; f++) {
+                        float lo = data_model_l2[0][f+1];
+                        float hi = lo;
+                        for (i = 1; i < l; i++) {
+                                float v = data_model_l2[i][f+1];
+                                if (v < lo) lo = v;
+                                if (v > hi) hi = v;
+                        }
+                        m->lo[f] = lo;
+                        m->scale[f] = hi > lo ? fDiv(hi - lo, 255.0f*255.0f) : 1.0f;
+                        inv[f] = fDiv(1.0f, m->scale[f]);
+                }
+                #endif
+
+                #pragma omp for
+                for (i = 0; i < l; i++) {
+                        svm_feat *sv = m->sv + i*SVM_DIM;
+                        m->coef[i] = data_model_l2[i][0];
+                        for (f = 0; f < SVM_DIM; f++) {
+                                float v = data_model_l2[i][f+1];
+                                #if SVM_QUANT == 8
+                                int q = (int)(fSqrt((v - m->lo[f]) * inv[f]) + 0.5f);
+                                sv[f] = q > 255 ? 255 : q;
+                                #elif SVM_QUANT == 16
+                                union { float f; unsigned int u; } b;
+                                b.f = v;
+                                // round to nearest even
+                                sv[f] = (b.u + 0x7fff + ((b.u >> 16) & 1)) >> 16;
+                                #else
+                                sv[f] = v;
+                                #endif
+                        }
+                }
+        }//omp
+
+        return m;
+}
+
+void svm_free_dense_model(svm_dense_model *m)
+{
+        l1free(m->sv);
+        l1free(m->coef);
+        l1free(m);
+}
@@ -6,5 +6,7 @@
 svm_node *svm_load_sample();
 void svm_init_data();
 void svm_load_model();
+svm_dense_model *svm_load_dense_model(const svm_model *src);
+void svm_free_dense_model(svm_dense_model *m);
 
 #endif
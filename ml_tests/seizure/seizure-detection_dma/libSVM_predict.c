@@ -374,6 +374,179 @@ float svm_predict_values(const svm_node *x, float* dec_values)
 }
 
 
+#if SVM_QUANT == 8
+static inline float svm_u8(const svm_dense_model *m, const unsigned char *sv, int f)
+{
+        float q = (float)sv[f];
+        return m->lo[f] + m->scale[f] * q * q;
+}
+#define SVM_UNPACK(m, sv, f) svm_u8(m, sv, f)
+#elif SVM_QUANT == 16
+static inline float svm_bf16(unsigned short h)
+{
+        union { unsigned int u; float f; } b;
+        b.u = (unsigned int)h << 16;
+        return b.f;
+}
+#define SVM_UNPACK(m, sv, f) svm_bf16((sv)[f])
+#else
+#define SVM_UNPACK(m, sv, f) ((sv)[f])
+#endif
+
+// |x - sv|^2 over the contiguous features, 4 independent partial sums
+static inline float svm_dist2(const svm_dense_model *m, const float *x, const svm_feat *sv)
+{
+        float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+        int f;
+
+        for (f = 0; f < SVM_DIM; f += 4) {
+                float d0 = x[f]   - SVM_UNPACK(m, sv, f);
+                float d1 = x[f+1] - SVM_UNPACK(m, sv, f+1);
+                float d2 = x[f+2] - SVM_UNPACK(m, sv, f+2);
+                float d3 = x[f+3] - SVM_UNPACK(m, sv, f+3);
+                s0 += d0*d0;
+                s1 += d1*d1;
+                s2 += d2*d2;
+                s3 += d3*d3;
+        }
+        return (s0 + s1) + (s2 + s3);
+}
+
+float kernel_rbf_dense(const svm_dense_model *m, const float *x, const svm_feat *sv)
+{
+        return fExp(-m->gamma * svm_dist2(m, x, sv));
+}
+
+// Every core takes a contiguous range of SVs, computes the exponents for all
+// the windows while the SV row is at hand, exponentiates them in one batch
+// (fExpv) and accumulates its share of the decision values; the master sums
+// the shares.
+void svm_predict_dense(const svm_dense_model *m, const float *xb, int nb, float *dec_values, int *labels)
+{
+        int l = m->l;
+        int b;
+        float partial[CORE][SVM_MAX_BATCH];
+        float *kvalue = plp_alloc_l1((int)(sizeof(float)*l*nb));
+
+        #pragma omp parallel default(none) private(b) shared(m, xb, nb, l, kvalue, partial, dec_values, labels) num_threads(CORE)
+        {
+                int id = omp_get_thread_num();
+                int nt = omp_get_num_threads();
+                int chunk = (l + nt - 1) / nt;
+                int i0 = id*chunk;
+                int i1 = i0 + chunk < l ? i0 + chunk : l;
+                int i;
+                float sum;
+
+                for (i = i0; i < i1; i++) {
+                        const svm_feat *sv = m->sv + i*SVM_DIM;
+                        for (b = 0; b < nb; b++)
+                                kvalue[b*l+i] = -m->gamma * svm_dist2(m, xb + b*SVM_DIM, sv);
+                }
+
+                for (b = 0; b < nb; b++) {
+                        fExpv(kvalue + b*l + i0, kvalue + b*l + i0, i1 - i0, 1);
+                        sum = 0.0f;
+                        for (i = i0; i < i1; i++)
+                                sum += m->coef[i] * kvalue[b*l+i];
+                        partial[id][b] = sum;
+                }
+
+                #pragma omp barrier
+
+                #pragma omp master
+                {
+                        for (b = 0; b < nb; b++) {
+                                sum = -m->rho;
+                                for (i = 0; i < nt; i++)
+                                        sum += partial[i][b];
+                                dec_values[b] = sum;
+                                labels[b] = sum > 0.0f ? m->label[0] : m->label[1];
+                        }
+                }
+        }//omp
+
+        l1free(kvalue);
+}
+
+// decision value of the float path (svm_node, kernel_function), serial
+static float svm_float_ref(const float *x)
+{
+        svm_node xn[SVM_DIM + 1];
+        svm_node SV[SVM_DIM + 1];
+        float sum = -model->rho[0];
+        int i, f;
+
+        for (f = 0; f < SVM_DIM; f++) {
+                xn[f].index = f + 1;
+                xn[f].value = x[f];
+        }
+        xn[SVM_DIM].index = -1;
+
+        for (i = 0; i < model->l; i++) {
+                for (f = 0; f < SVM_DIM; f++) {
+                        SV[f].index = f + 1;
+                        SV[f].value = data_model_l2[i][f+1];
+                }
+                SV[SVM_DIM].index = -1;
+                sum += data_model_l2[i][0] * kernel_function(xn, SV, model->param);
+        }
+        return sum;
+}
+
+// x and SVM_MAX_BATCH - 1 feature vectors of the training set (SVs spread
+// over both classes) as a batch of windows
+void svm_dense_bench(const svm_node *x)
+{
+        float xb[SVM_MAX_BATCH*SVM_DIM];
+        float dec[SVM_MAX_BATCH];
+        int lab[SVM_MAX_BATCH];
+        int b, f, nb, cycles, agree = 0;
+        float err = 0.0f;
+        svm_dense_model *m;
+
+        for (f = 0; f < SVM_DIM; f++)
+                xb[f] = x[f].value;
+        for (b = 1; b < SVM_MAX_BATCH; b++)
+                for (f = 0; f < SVM_DIM; f++)
+                        xb[b*SVM_DIM+f] = data_model_l2[(b*315)/SVM_MAX_BATCH][f+1];
+
+        svm_load_model();
+
+        reset_timer();
+        start_timer();
+        m = svm_load_dense_model(model);
+        stop_timer();
+        cycles = get_time();
+        printf("dense svm, %d bit, load: %d cycles, %d bytes\n", SVM_QUANT, cycles, (int)(sizeof(svm_feat)*m->l*SVM_DIM));
+
+        for (nb = 1; nb <= SVM_MAX_BATCH; nb *= SVM_MAX_BATCH) {
+                reset_timer();
+                start_timer();
+                svm_predict_dense(m, xb, nb, dec, lab);
+                stop_timer();
+                cycles = get_time();
+                printf("dense svm, %d bit, batch %d: %d cycles, %d cycles/prediction\n", SVM_QUANT, nb, cycles, cycles/nb);
+        }
+
+        for (b = 0; b < SVM_MAX_BATCH; b++) {
+                float ref = svm_float_ref(xb + b*SVM_DIM);
+                if (fAbs(dec[b] - ref) > err)
+                        err = fAbs(dec[b] - ref);
+                if (lab[b] == (ref > 0.0f ? m->label[0] : m->label[1]))
+                        agree++;
+        }
+        printf("dense svm, %d bit vs float: max |dec diff| x1e6 %d, labels %d/%d\n", SVM_QUANT, (int)(1000000.0f*err), agree, SVM_MAX_BATCH);
+
+        svm_free_dense_model(m);
+        l1free(model->SV);
+        l1free(model->sv_coef);
+        l1free(model->nSV);
+        l1free(model->label);
+        l1free(model->rho);
+        l1free(model);
+}
+
 /*
 //float svm_predict_values(const svm_model *model, const svm_node *x, float* dec_values)
 float svm_predict_values(const svm_node *x, float* dec_values)
@@ -71,6 +71,45 @@ typedef struct svm_model
 				/* 0 if svm_model is created by svm_train */
 } svm_model;
 
+//
+// dense model, resident in L1
+//
+// The support vectors as rows of SVM_DIM contiguous features, the storage is
+// selected with SVM_QUANT:
+//   32  float, 45 KB for the 315 SVs of modelSVM.h: does not fit next to
+//       the rest of the application in a 64 KB L1, no test runs it
+//   16  upper half of the float (bfloat16), unpacked with a shift
+//   8   uint8 on a square root scale, feature = lo[f] + scale[f] * q^2, lo
+//       and scale per feature (the energies are heavy tailed)
+// Only the two class RBF model of this application (svm_load_model).
+//
+#define SVM_DIM 36
+#define SVM_MAX_BATCH 8
+
+#ifndef SVM_QUANT
+#define SVM_QUANT 16
+#endif
+
+#if SVM_QUANT == 8
+typedef unsigned char svm_feat;
+#elif SVM_QUANT == 16
+typedef unsigned short svm_feat;
+#else
+typedef float svm_feat;
+#endif
+
+typedef struct svm_dense_model
+{
+	int l;			/* total #SV */
+	float gamma;
+	float rho;
+	int label[2];
+	float *coef;		/* sv_coef (coef[l]) */
+	svm_feat *sv;		/* SVs (sv[l*SVM_DIM]) */
+	float lo[SVM_DIM];	/* SVM_QUANT == 8 only */
+	float scale[SVM_DIM];
+} svm_dense_model;
+
 /* functions */
 //static char* readline(FILE *input);
 void exit_input_error(int line_num);
@@ -82,6 +121,13 @@ float kernel_function(const svm_node *x, const svm_node *y, const svm_parameter
 
 //float svm_predict_values(const svm_model *model, const svm_node *x, float* dec_values);
 float svm_predict_values( const svm_node *x, float* dec_values);
+
+/* exp(-gamma |x - sv|^2), x dense */
+float kernel_rbf_dense(const svm_dense_model *m, const float *x, const svm_feat *sv);
+/* nb <= SVM_MAX_BATCH windows xb[nb*SVM_DIM], the SVs split across the cores */
+void svm_predict_dense(const svm_dense_model *m, const float *xb, int nb, float *dec_values, int *labels);
+/* dense vs float path on a batch of windows starting with x, cycles per prediction */
+void svm_dense_bench(const svm_node *x);
 //struct svm_model *svm_load_model(const char *model_file_name);
 //struct svm_model *svm_load_model();
 
@@ -26,7 +26,7 @@ PULP_L1_DATA int j=0;
 
 PULP_L1_DATA float energy_matrix[4][channels];
 PULP_L1_DATA float energy_vector[4];
-PULP_L1_DATA float dwt[window];
+PULP_L1_DATA float dwt[window/2];
 
 PULP_L1_DATA extern struct svm_node *x;
 PULP_L1_DATA extern struct svm_model *model;
@@ -66,37 +66,10 @@ int main()
 #pragma omp parallel private(dwt, i, energy_vector) shared(energy_matrix) num_threads(CORE)//shared(energy_matrix)
                 {
 		  
-		  gsl_wavelet_workspace *ptr_workspace;
-#if HWPERFMALLOC
-		  perf_start();
-#endif
-		  ptr_workspace          = plp_alloc_l1((int)sizeof(gsl_wavelet_workspace));
-		  ptr_workspace->scratch = plp_alloc_l1((int)(window*sizeof(float)));
-		  //printf("malloc %x %x \n",ptr_workspace,ptr_workspace->scratch);
-		  ptr_workspace->n       = window;
-#if HWPERFMALLOC
-		  perf_stop();
-		  printf("STOP alloc\n"); perf_print_all();
-#endif
-
-
                         #pragma omp for
                         for (j=0; j<components; j++){
-                                int indx=0;
-                                
-                                for(indx=0; indx<window; indx++){
-                                        
-                                        dwt[indx]=datiOutput[j][indx]; //printf("%d:iter %d, dwt[%d]=%d\n", omp_get_thread_num(), j, indx, (int)dwt[indx]);     
-                                        
-                                }
-                                //printf("start wavelet transform\n");
-                                gsl_wavelet_transform (dwt, 1, window, ptr_workspace);
-                                //printf("finish wavelet transform\n");
-                                //printf("start energy computation\n");
-                                calcolo_energia(dwt, energy_vector);
-                                //printf("finish energy computation\n");
-                                
-                                
+                                //lifting DWT and energy of the bands, straight from the component
+                                wavelet_energia(datiOutput[j], dwt, energy_vector);
                                 
                                 for(i=0;i<4;i++){
                                         
@@ -108,17 +81,6 @@ int main()
                                 
                         }
                         #pragma omp barrier
-#if HWPERFFREE
-			perf_start();
-#endif
-			l1free(ptr_workspace->scratch);
-			l1free(ptr_workspace);
-			ptr_workspace->scratch = NULL;
-			ptr_workspace = NULL;
-#if HWPERFFREE
-			perf_stop();
-			printf("FREE\n"); perf_print_all();
-#endif
                 
 		}//omp
 		
@@ -198,6 +160,10 @@ int main()
 		#if HWPERF
 		perf_end();
                 #endif  
+
+#if SVM_DENSE
+		svm_dense_bench(x1);
+#endif
         
         return 0;
 }
@@ -33,6 +33,8 @@
          #endif
 	 float *a = plp_alloc_l1((int)(channels*channels*sizeof(float)));
          float *v = plp_alloc_l1((int)(channels*channels*sizeof(float)));
+	 // the window stays in L1 from mean_covariance() to PC()
+	 float *datainput = plp_alloc_l1((int)(window*channels*sizeof(float)));
 	 //printf("malloc %x %x \n",a,v);
 	 #if HWPERFMALLOC
 	 perf_stop();
@@ -40,6 +42,7 @@
          #endif
          float w[channels]; //eigenvalues
          float explained[channels];
+         float mean[channels];
          float anorm;
          int i, k; 
          rv1=p;
@@ -50,7 +53,7 @@
 	 perf_start();
          #endif
 
-         mean_covariance(datiInput2, a);  //compute mean value for all channels and substract mean value from datas 
+         mean_covariance(datiInput2, datainput, a, mean);  //compute mean value for all channels and covariance of the mean free datas
  
          #if HWPERF_FUNC
 	 perf_stop();
@@ -131,7 +134,7 @@
          //k_comp=k;
          int k_comp=9;
       
-         PC(datiInput2, output, v);
+         PC(datainput, output, v, mean);
 
          #if HWPERF_FUNC
 	 perf_stop();
@@ -144,8 +147,10 @@
          #endif
 
 	 // free L1 memory
+	 l1free(datainput);
 	 l1free(v);
 	 l1free(a);
+	 datainput = NULL;
 	 v = NULL;
 	 a = NULL;
 
@@ -158,74 +163,91 @@
          
  }
 
-/*compute mean value for al channels and substract mean value from datas*/
-void mean_covariance(float datiInput[][256], float a[channels*channels]){
-        
-        float *datainput;
-	#if HWPERFMALLOC
-	perf_start();
-        #endif
-	datainput = plp_alloc_l1((int)(window*channels*sizeof(float)));
-	//printf("malloc %x \n",datainput);
-        #if HWPERFMALLOC
-	perf_stop();
-	printf("STOP alloc\n"); perf_print_all();
-        #endif
-	int dma_id0 = memcpy_async(datainput, datiInput, window*channels*4);
-	memcpy_wait(dma_id0);
-        int i, j, k;
-        #pragma omp parallel default(none) private( i, k, j) shared(a, datainput) num_threads(CORE)
+/*compute mean value for al channels and covariance of the mean free datas.
+  The window is streamed into datainput (L1) in blocks of PCA_BLOCK samples,
+  block major (datainput[b][channel][PCA_BLOCK]): the DMA of block b+1 runs
+  while the cores work on block b, and the window stays there for PC().
+  Each core owns a contiguous range of the upper triangular entries of a and
+  accumulates the sums of products over the blocks, together with the channel
+  sums; the mean is folded in at the end,
+  a_ij = sum(x_i x_j) - sum(x_i) sum(x_j) / window,
+  so the data are read once and never written back.*/
+void mean_covariance(float datiInput[][256], float *datainput, float a[channels*channels], float mean[channels]){
+
+        uint32_t dma_id[window/PCA_BLOCK];
+        int i, j, k, p, b;
+        #pragma omp parallel default(none) private(i, j, k, p, b) shared(datiInput, datainput, a, mean, dma_id) num_threads(CORE)
         {
-                
-                float temp=0.0f;
-                #pragma omp for 
-                
-                for (j = 0; j < channels; j++){ 
-                        
-                        
-                        float mean = 0.0f;
-                        
-                        for (i = 0; i < window; i++){
-                                mean = mean + datainput[j*window+i];
+                int id = omp_get_thread_num();
+                int nt = omp_get_num_threads();
+                int npairs = channels*(channels+1)/2;
+                int chunk = (npairs + nt - 1) / nt;
+                int p0 = id*chunk;
+                int p1 = p0 + chunk < npairs ? p0 + chunk : npairs;
+                int i0 = 0;
+                float temp;
+
+                /*first pair (i0, j0) of this core*/
+                for (p = p0; p >= channels - i0; i0++)
+                        p -= channels - i0;
+                int j0 = i0 + p;
+
+                for (i = i0, j = j0, p = p0; p < p1; p++) {
+                        a[i*channels+j] = 0.0f;
+                        if (++j == channels) { i++; j = i; }
+                }
+                for (j = id; j < channels; j += nt)
+                        mean[j] = 0.0f;
+
+                #pragma omp master
+                {
+                        dma_id[0] = memcpy_async2D(datainput, &datiInput[0][0], channels*PCA_BLOCK*4, window*4, PCA_BLOCK*4);
+                }
+
+                for (b = 0; b < window/PCA_BLOCK; b++) {
+
+                        #pragma omp master
+                        {
+                                if (b + 1 < window/PCA_BLOCK)
+                                        dma_id[b+1] = memcpy_async2D(datainput + (b+1)*channels*PCA_BLOCK, &datiInput[0][(b+1)*PCA_BLOCK],
+                                                                     channels*PCA_BLOCK*4, window*4, PCA_BLOCK*4);
+                                memcpy_wait(dma_id[b]);
+                        }
+                        #pragma omp barrier
+
+                        float *blk = datainput + b*channels*PCA_BLOCK;
+
+                        for (j = id; j < channels; j += nt) {
+                                temp = 0.0f;
+                                for (k = 0; k < PCA_BLOCK; k++)
+                                        temp += blk[j*PCA_BLOCK+k];
+                                mean[j] += temp;
                         }
-                        mean = fDiv(mean,window);
-                        for (i = 0; i < window; i++){
-                                datainput[j*window+i] -= mean;
+
+                        /*compute covariance matrix*/
+                        for (i = i0, j = j0, p = p0; p < p1; p++) {
+                                temp = 0.0f;
+                                for (k = 0; k < PCA_BLOCK; k++)
+                                        temp += blk[i*PCA_BLOCK+k]*blk[j*PCA_BLOCK+k];
+                                a[i*channels+j] += temp;
+                                if (++j == channels) { i++; j = i; }
                         }
                 }
-               
+
                 #pragma omp barrier
 
-                /*compute covariance matrix*/   
-                #pragma omp for collapse(2)
-                for(i=0; i < channels; i++){
-                        for(j=0; j < channels; j++){
-                                
-                                
-                                for(k=0; k < window; k++){
-                                        temp+=datainput[i*window+k]*datainput[j*window+k];
-                                }
-                                a[i*channels+j]=temp; 
-                                temp=0.0f; 
-                        }
+                for (i = i0, j = j0, p = p0; p < p1; p++) {
+                        a[i*channels+j] -= fDiv(mean[i]*mean[j], window);
+                        a[j*channels+i] = a[i*channels+j];
+                        if (++j == channels) { i++; j = i; }
                 }
-                
-        }//omp
 
-	// copy data back..
-	int dma_id1 = memcpy_async(datiInput,datainput, window*channels*4);
-	memcpy_wait(dma_id1);
-        
+                #pragma omp barrier
+
+                for (j = id; j < channels; j += nt)
+                        mean[j] = fDiv(mean[j], window);
 
-#if HWPERFFREE
-	perf_start();
-#endif
-	l1free(datainput);
-	datainput = NULL;
-#if HWPERFFREE
-	perf_stop();
-	printf("FREE\n"); perf_print_all();
-#endif
+        }//omp
 
 }
 
@@ -562,53 +584,38 @@ void diagonalize(float w[channels], float rv1[channels], float v[channels*channe
 }
 
 //CALCOLO K PC
-void PC(float datiInput[][256], float datioutput[][256], float v[channels*channels]){
-        
+/*project the mean free window on the first k_comp vectors of v. datainput is
+  the raw window left in L1 by mean_covariance(), the mean is subtracted
+  through its own projection, once per component.*/
+void PC(float *datainput, float datioutput[][256], float v[channels*channels], float mean[channels]){
+
         int i, k, k2;
         int k_comp=9;
         float temp;
-	
-	float *datainput;
-	#if HWPERFMALLOC
-	perf_start();
-        #endif
-	datainput = plp_alloc_l1((int)(window*channels*sizeof(float)));
-	//printf("malloc %x \n",datainput);
-        #if HWPERFMALLOC
-	perf_stop();
-	printf("STOP alloc\n"); perf_print_all();
-	#endif
-	int dma_id0 = memcpy_async(datainput, datiInput, window*channels*4);
-	memcpy_wait(dma_id0);
-        
-        #pragma omp parallel default(none) private(k,k2, temp) shared(datainput, v, datioutput, k_comp) num_threads(CORE) 
+        float offset[channels];
+
+        #pragma omp parallel default(none) private(i, k, k2, temp) shared(datainput, v, mean, offset, datioutput, k_comp) num_threads(CORE)
         {
-                temp=0.0f;
-                #pragma omp barrier
-                #pragma omp for 
+                #pragma omp for
+                for (k = 0; k < k_comp; k++) {
+                        temp = 0.0f;
+                        for (k2 = 0; k2 < channels; k2++)
+                                temp += mean[k2] * v[k2*channels+k];
+                        offset[k] = temp;
+                }
+
+                #pragma omp for
                 for (i = 0; i < window; i++) {
-                        
+
+                        float *x = datainput + (i/PCA_BLOCK)*channels*PCA_BLOCK + i%PCA_BLOCK;
+
                         for(k=0; k < k_comp; k++) {
-                                
-                                for (k2 = 0; k2 < channels; k2++) 
-                                {                                                                                                                                                               
-                                        
-                                        temp+= datainput[k2*window+i] * v[k2*channels+k];
-                                        
-                                }
-                                datioutput[k][i]=temp; 
-                                temp=0.0f;                      
-                        } 
+                                temp = 0.0f;
+                                for (k2 = 0; k2 < channels; k2++)
+                                        temp += x[k2*PCA_BLOCK] * v[k2*channels+k];
+                                datioutput[k][i] = temp - offset[k];
+                        }
                 }
-                
+
         }//omp
-#if HWPERFFREE
-	perf_start();
-#endif
-        l1free(datainput);
-	datainput = NULL;
-#if HWPERFFREE
-	perf_stop();
-	printf("FREE\n"); perf_print_all();
-#endif
 }
@@ -3,8 +3,11 @@
 #include <stdint.h>
 #include "init.h"
 
+/* samples per DMA block of the window in mean_covariance(), divides window */
+#define PCA_BLOCK 32
+
 int PCA(int lunghezza_finestra, int numero_canali, float output[][window]); 
-void mean_covariance(float datiInput[][window], float a[channels*channels]);
+void mean_covariance(float datiInput[][window], float *datainput, float a[channels*channels], float mean[channels]);
 
 float householder(float a[channels*channels], float rv1[channels], float w[channels]);
 
@@ -13,7 +16,7 @@ void accumulate(float v[channels*channels], float a[channels*channels], float rv
 void diagonalize(float w[channels], float rv1[channels], float v[channels*channels], float anorm);
 static float PYTHAG(float a, float b);
 
-void PC(float datiInput[][window], float datioutput[][window], float v[channels*channels]);
+void PC(float *datainput, float datioutput[][window], float v[channels*channels], float mean[channels]);
 
 
 #endif /* PCA__H_ */
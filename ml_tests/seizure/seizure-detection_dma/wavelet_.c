@@ -162,3 +162,46 @@ void calcolo_energia(float *datiInput, float *Output){
 
 }
 
+/*
+  Haar DWT by lifting, fused with calcolo_energia: Output[0..3] are the
+  energies of the detail bands of the first four levels, the same as
+  calcolo_energia() on the gsl_wavelet_transform() output.
+  Level l pairs the averages of 2^(l-1) samples, d = b - a and a += d/2, in
+  place and without scratch; the normalized detail is 2^(l/2-1) d, so the
+  scaling only shows up in the energies. The coarser levels do not reach the
+  four bands and are skipped.
+  data (window) is read once, avg (window/2) takes the averages of the first
+  level and is updated in place by the next ones; avg may be data. Two pairs
+  per iteration, with independent sums.
+*/
+void wavelet_energia(const float *data, float *avg, float *Output){
+
+  int i, l, s;
+  float d0, d1, e0, e1;
+
+  e0 = 0.0f;
+  e1 = 0.0f;
+  for(i=0;i<(window/2);i+=2){
+    d0 = data[2*i+1] - data[2*i];
+    d1 = data[2*i+3] - data[2*i+2];
+    avg[i]   = data[2*i]   + 0.5f*d0;
+    avg[i+1] = data[2*i+2] + 0.5f*d1;
+    e0 += d0*d0;
+    e1 += d1*d1;
+  }
+  Output[0]=0.5f*(e0+e1);
+
+  for(l=1, s=1; l<4; l++, s<<=1){
+    e0 = 0.0f;
+    e1 = 0.0f;
+    for(i=0;i<(window/2);i+=4*s){
+      d0 = avg[i+s]   - avg[i];
+      d1 = avg[i+3*s] - avg[i+2*s];
+      avg[i]     += 0.5f*d0;
+      avg[i+2*s] += 0.5f*d1;
+      e0 += d0*d0;
+      e1 += d1*d1;
+    }
+    Output[l]=(float)(1<<(l-1))*(e0+e1);
+  }
+}
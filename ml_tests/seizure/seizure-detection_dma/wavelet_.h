@@ -67,3 +67,4 @@ int workspace_alloc(gsl_wavelet_workspace *ptr_workspace);
 //int wavelet_alloc();
 //int workspace_alloc();
 void calcolo_energia(float *datiInput, float *Output);
+void wavelet_energia(const float *data, float *avg, float *Output);
@@ -0,0 +1,448 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/******************************************************************************
+ *                                                                            *
+ * Project:        CConvNet                                                   *
+ * File:           convLayer16.c                                              *
+ * Description:    16-bit fixed point multi-channel convolution layer test    *
+ *                                                                            *
+ * Full CNN layer (nif input maps, nof output maps, stride, zero padding,     *
+ * ReLU and Q-format requantization) built on the W/x/y layout and the        *
+ * nif/a/b indexing of conv16_gold. Input and output feature maps live in L2  *
+ * and are tiled by output rows through L1 with double-buffered DMA; each     *
+ * tile is split across the cores by (output map, output row).                *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <pulp.h>
+#include <stdint.h>
+#include "convLayer16.h"
+
+// feature maps and weights in L2
+int16_t g_W_l2[W_L2_SIZE];
+int16_t g_x_l2[X_L2_SIZE];
+int16_t g_y_l2[Y_L2_SIZE];
+int16_t g_y_gold[Y_L2_SIZE];
+
+// rearranged weights and double-buffered tiles in L1
+PLP_L1_DATA int16_t g_W[W_L1_SIZE] __attribute__((aligned(4)));
+PLP_L1_DATA int16_t g_x[2][X_TILE_SIZE + X_TILE_SLACK] __attribute__((aligned(4)));
+PLP_L1_DATA int16_t g_y[2][Y_TILE_SIZE] __attribute__((aligned(4)));
+
+// typical small-CNN layer shapes; the last one is the conv16 plane
+layer_t layers[] = {
+   { "conv3x3 3->16 32x32 pad1",         3, 16, 32, 32, 3, 3, 1, 1, 1, QF },
+   { "conv3x3 8->16 32x32 stride2 pad1", 8, 16, 32, 32, 3, 3, 2, 1, 1, QF },
+   { "conv3x3 16->16 16x16 pad1",       16, 16, 16, 16, 3, 3, 1, 1, 1, QF },
+   { "conv1x1 32->32 16x16",            32, 32, 16, 16, 1, 1, 1, 0, 1, QF },
+   { "conv5x5 1->1 32x32",               1,  1, 32, 32, 5, 5, 1, 0, 0, QF },
+   { 0 }
+};
+
+int main() {
+
+   if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+   int errors = 0;
+   layer_t *l;
+
+   // the layer reference must agree with conv16_gold on the conv16 plane
+   errors += test_conv16_compat();
+
+   for (l = layers; l->name != 0; l++)
+      errors += test_layer(l);
+
+   synch_barrier();
+
+   return errors;
+}
+
+static inline int16_t requant(int32_t acc, int qf, int relu) {
+   acc = acc >> qf;
+   #ifdef __riscv__
+   return relu ? __CLIPU(acc, 15) : __CLIP(acc, 15);
+   #else
+   if (acc > 32767)
+      acc = 32767;
+   if (acc < (relu ? 0 : -32768))
+      acc = relu ? 0 : -32768;
+   return acc;
+   #endif
+}
+
+int test_conv16_compat() {
+   layer_t *l = &layers[4];
+   int errors = 0;
+   int oh = LAYER_OH(l);
+   int ow = LAYER_OW(l);
+   int i;
+
+   if(rt_core_id() == 0) {
+      load(l);
+      for(i=0; i<oh*ow; i++)
+         g_y_gold[i] = 0;
+      conv16_gold(g_W_l2, g_x_l2, g_y_gold, l->ih, l->iw, l->fh, l->fw, oh, ow, 1, 0, 0);
+   }
+
+   synch_barrier();
+
+   conv_layer_gold(l, g_W_l2, g_x_l2, g_y_l2);
+
+   if(rt_core_id() == 0) {
+      errors = check(l, g_y_l2, g_y_gold);
+      #ifndef PULP_SPI
+      printf("layer reference vs conv16_gold, errors=%d\n", errors);
+      #endif
+   }
+
+   return errors;
+}
+
+int test_layer(layer_t *l) {
+   int errors = 0;
+   int macs;
+
+   if(rt_core_id() == 0) {
+      load(l);
+   }
+
+   synch_barrier();
+
+   conv_layer_gold(l, g_W_l2, g_x_l2, g_y_gold);
+
+   if(rt_core_id() == 0) {
+      reset_timer();
+      start_timer();
+   }
+   if (conv_layer_dma(l, g_W_l2, g_x_l2, g_y_l2) < 0) {
+      #ifndef PULP_SPI
+      if(rt_core_id() == 0)
+         printf("%s, does not fit the L1 tiles\n", l->name);
+      #endif
+      return rt_core_id() == 0;
+   }
+   if(rt_core_id() == 0) {
+      stop_timer();
+
+      errors = check(l, g_y_l2, g_y_gold);
+      macs = l->nof * LAYER_OH(l) * LAYER_OW(l) * l->nif * l->fh * l->fw;
+
+      #ifndef PULP_SPI
+      printf("%s, errors=%d, time=%d, MACs=%d, MAC/cycle x100=%d\n", l->name, errors, get_time(), macs, (macs*100) / get_time());
+      #endif
+   }
+
+   return errors;
+}
+
+// same as parallel_bare_tests/conv16 (IMPRECISE_ASM5 flavour): accumulates
+// input map b convolved with filter (a,b) into output map a
+void conv16_gold(int16_t *__restrict__ W, int16_t *__restrict__ x, int16_t *__restrict__ y, int h, int w, int fh, int fw, int oh, int ow, int nif, int a, int b) {
+   int i;
+   for (i=0; i<oh; i++) {
+      int j;
+      for (j=0; j<ow; j++) {
+         int32_t conv = 0;
+         int ui;
+         for (ui=0; ui<fh; ui++) {
+            int uj;
+            for (uj=0; uj<fw; uj++) {
+               int m;
+               int n;
+               m = i-ui+fh-1;
+               n = j-uj+fw-1;
+               conv += W[((((a*nif)+b)*fh)+ui)*fw+uj] * x[(((b*h)+m)*w)+n];
+            }
+         }
+         y[(a*oh+i)*ow+j] = (y[(a*oh+i)*ow+j] + (conv >> QF));
+      }
+   }
+}
+
+// by-the-book layer: 32-bit accumulation over all input maps, one
+// requantization per output pixel; output maps are split across cores
+void conv_layer_gold(layer_t *l, int16_t *W, int16_t *x, int16_t *y) {
+   register int myid      = rt_core_id();
+   register int num_cores = get_core_num();
+   int oh = LAYER_OH(l);
+   int ow = LAYER_OW(l);
+   int a;
+
+   for (a=myid; a<l->nof; a+=num_cores) {
+      int i;
+      for (i=0; i<oh; i++) {
+         int j;
+         for (j=0; j<ow; j++) {
+            int32_t conv = 0;
+            int b;
+            for (b=0; b<l->nif; b++) {
+               int ui;
+               for (ui=0; ui<l->fh; ui++) {
+                  int uj;
+                  for (uj=0; uj<l->fw; uj++) {
+                     int m = i*l->stride - l->pad + l->fh-1-ui;
+                     int n = j*l->stride - l->pad + l->fw-1-uj;
+                     if (m < 0 || m >= l->ih || n < 0 || n >= l->iw)
+                        continue;
+                     conv += W[((((a*l->nif)+b)*l->fh)+ui)*l->fw+uj] * x[(((b*l->ih)+m)*l->iw)+n];
+                  }
+               }
+            }
+            y[(a*oh+i)*ow+j] = requant(conv, l->qf, l->relu);
+         }
+      }
+   }
+   synch_barrier();
+}
+
+// largest number of output rows whose input and output tiles fit in L1,
+// 0 if not even one row fits
+static int tile_rows(layer_t *l) {
+   int oh = LAYER_OH(l);
+   int ow = LAYER_OW(l);
+   int tr;
+
+   for (tr=oh; tr>=1; tr--) {
+      int in_rows = (tr-1)*l->stride + l->fh;
+      if (in_rows > l->ih)
+         in_rows = l->ih;
+      if (l->nif*in_rows*l->iw <= X_TILE_SIZE && l->nof*tr*ow <= Y_TILE_SIZE)
+         break;
+   }
+   return tr;
+}
+
+// first input row and number of input rows needed by output rows [r0, r0+nr)
+static inline int tile_x_row0(layer_t *l, int r0) {
+   int m = r0*l->stride - l->pad;
+   return m < 0 ? 0 : m;
+}
+
+static inline int tile_x_rows(layer_t *l, int r0, int nr) {
+   int m = (r0+nr-1)*l->stride - l->pad + l->fh;
+   if (m > l->ih)
+      m = l->ih;
+   return m - tile_x_row0(l, r0);
+}
+
+static int tile_load(layer_t *l, int16_t *x, int r0, int nr, int16_t *x_tile) {
+   int row0 = tile_x_row0(l, r0);
+   int rows = tile_x_rows(l, r0, nr);
+   return plp_dma_memcpy_2d((unsigned int) (x + row0*l->iw), (unsigned int) x_tile,
+                            l->nif*rows*l->iw*sizeof(int16_t),
+                            l->ih*l->iw*sizeof(int16_t), rows*l->iw*sizeof(int16_t), 1);
+}
+
+static int tile_store(layer_t *l, int16_t *y, int r0, int nr, int16_t *y_tile) {
+   int oh = LAYER_OH(l);
+   int ow = LAYER_OW(l);
+   return plp_dma_memcpy_2d((unsigned int) (y + r0*ow), (unsigned int) y_tile,
+                            l->nof*nr*ow*sizeof(int16_t),
+                            oh*ow*sizeof(int16_t), nr*ow*sizeof(int16_t), 0);
+}
+
+// output pixel whose window touches the zero padding (or the odd pixel left
+// over by the 2-pixel loop)
+static inline int32_t conv_pixel_border(layer_t *l, int16_t *W_a, int16_t *x, int x_row0, int x_rows, int m0, int n0) {
+   int fwp = LAYER_FWP(l);
+   int32_t conv = 0;
+   int b;
+
+   for (b=0; b<l->nif; b++) {
+      int p;
+      for (p=0; p<l->fh; p++) {
+         int m = m0 + p;
+         int q;
+         if (m < 0 || m >= l->ih)
+            continue;
+         for (q=0; q<l->fw; q++) {
+            int n = n0 + q;
+            if (n < 0 || n >= l->iw)
+               continue;
+            conv += W_a[((b*l->fh)+p)*fwp+q] * x[((b*x_rows)+m-x_row0)*l->iw+n];
+         }
+      }
+   }
+   return conv;
+}
+
+// computes output rows [r0, r0+nr) of all output maps; work items are
+// (output map, output row) pairs, each core takes a contiguous chunk so that
+// consecutive items share the same filters
+static void conv_layer_tile(layer_t *l, int16_t *W, int16_t *x, int x_row0, int x_rows, int16_t *y, int r0, int nr) {
+   register int myid      = rt_core_id();
+   register int num_cores = get_core_num();
+   int ow     = LAYER_OW(l);
+   int fwp    = LAYER_FWP(l);
+   int s      = l->stride;
+   int iw     = l->iw;
+   int items  = l->nof*nr;
+   int chunk  = (items + num_cores - 1) / num_cores;
+   int lb     = myid*chunk;
+   int ub     = lb + chunk < items ? lb + chunk : items;
+   // columns whose window is entirely inside the input map
+   int j_lo   = (l->pad + s - 1) / s;
+   int j_hi   = (iw + l->pad - l->fw) / s + 1;
+   int k;
+
+   if (j_hi > ow)
+      j_hi = ow;
+
+   for (k=lb; k<ub; k++) {
+      int a        = k / nr;
+      int i        = r0 + k % nr;
+      int m0       = i*s - l->pad;
+      int16_t *W_a = W + a*l->nif*l->fh*fwp;
+      int16_t *y_i = y + (a*nr + i-r0)*ow;
+      int row_in   = (m0 >= 0 && m0 + l->fh <= l->ih);
+      int j        = 0;
+
+      if (row_in) {
+         for (; j<j_lo; j++)
+            y_i[j] = requant(conv_pixel_border(l, W_a, x, x_row0, x_rows, m0, j*s - l->pad), l->qf, l->relu);
+
+         // two output pixels per iteration share every filter load
+         for (; j+1<j_hi; j+=2) {
+            int32_t conv0 = 0;
+            int32_t conv1 = 0;
+            v2s *W_ptr = (v2s *) W_a;
+            int16_t *x_ptr = x + (m0-x_row0)*iw + j*s - l->pad;
+            int b;
+            for (b=0; b<l->nif; b++) {
+               int p;
+               for (p=0; p<l->fh; p++) {
+                  int16_t *x0 = x_ptr + p*iw;
+                  int16_t *x1 = x0 + s;
+                  int q;
+                  for (q=0; q<fwp; q+=2) {
+                     v2s w = *W_ptr++;
+                     conv0 = __SUMDOTP2(*(v2s *) (x0+q), w, conv0);
+                     conv1 = __SUMDOTP2(*(v2s *) (x1+q), w, conv1);
+                  }
+               }
+               x_ptr += x_rows*iw;
+            }
+            y_i[j]   = requant(conv0, l->qf, l->relu);
+            y_i[j+1] = requant(conv1, l->qf, l->relu);
+         }
+      }
+
+      for (; j<ow; j++)
+         y_i[j] = requant(conv_pixel_border(l, W_a, x, x_row0, x_rows, m0, j*s - l->pad), l->qf, l->relu);
+   }
+}
+
+int conv_layer_dma(layer_t *l, int16_t *W, int16_t *x, int16_t *y) {
+   register int myid      = rt_core_id();
+   register int num_cores = get_core_num();
+   int oh     = LAYER_OH(l);
+   int fwp    = LAYER_FWP(l);
+   int tr     = tile_rows(l);
+   int ntiles;
+   int in_id  = 0;
+   int out_id[2];
+   int e;
+   int t;
+
+   // same decision on every core, before any barrier
+   if (tr == 0 || l->nof*l->nif*l->fh*fwp > W_L1_SIZE)
+      return -1;
+
+   ntiles = (oh + tr - 1) / tr;
+
+   // flip the filters once (conv16 convention) and pad their rows to an even
+   // number of taps, so that the inner loop walks W and x forward in pairs
+   for (e=myid; e<l->nof*l->nif*l->fh*fwp; e+=num_cores) {
+      int q  = e % fwp;
+      int p  = (e / fwp) % l->fh;
+      int ab = e / (fwp*l->fh);
+      g_W[e] = (q < l->fw) ? W[(ab*l->fh + l->fh-1-p)*l->fw + l->fw-1-q] : 0;
+   }
+
+   if (myid == 0) {
+      in_id = tile_load(l, x, 0, tr < oh ? tr : oh, g_x[0]);
+      plp_dma_wait(in_id);
+   }
+
+   synch_barrier();
+
+   for (t=0; t<ntiles; t++) {
+      int r0 = t*tr;
+      int nr = (oh - r0) < tr ? (oh - r0) : tr;
+
+      // prefetch the next input tile while this one is processed
+      if (myid == 0 && t+1 < ntiles) {
+         int nr_next = (oh - r0 - tr) < tr ? (oh - r0 - tr) : tr;
+         in_id = tile_load(l, x, r0+tr, nr_next, g_x[(t+1)&1]);
+      }
+
+      conv_layer_tile(l, g_W, g_x[t&1], tile_x_row0(l, r0), tile_x_rows(l, r0, nr), g_y[t&1], r0, nr);
+
+      if (myid == 0) {
+         if (t+1 < ntiles)
+            plp_dma_wait(in_id);
+         // the next tile writes into the buffer stored at t-1
+         if (t >= 1)
+            plp_dma_wait(out_id[(t-1)&1]);
+      }
+
+      synch_barrier();
+
+      if (myid == 0)
+         out_id[t&1] = tile_store(l, y, r0, nr, g_y[t&1]);
+   }
+
+   if (myid == 0)
+      plp_dma_wait(out_id[(ntiles-1)&1]);
+
+   synch_barrier();
+
+   return 0;
+}
+
+void load(layer_t *l) {
+   int i;
+   for(i=0; i<l->nof*l->nif*l->fh*l->fw; i++) {
+      g_W_l2[i] = (int16_t) (((i*104729) % 2048) - 1024);
+   }
+   for(i=0; i<l->nif*l->ih*l->iw; i++) {
+      g_x_l2[i] = (int16_t) (((i*7919) % 512) - 256);
+   }
+   for(i=0; i<l->nof*LAYER_OH(l)*LAYER_OW(l); i++) {
+      g_y_l2[i] = (int16_t) 0x5555;
+   }
+}
+
+int check(layer_t *l, int16_t *y, int16_t *y_gold) {
+   int i;
+   int errors = 0;
+   for(i=0; i<l->nof*LAYER_OH(l)*LAYER_OW(l); i++) {
+      int err = ((y[i]!=y_gold[i]) ? 1 : 0);
+      errors += err;
+      #ifdef CHECK_ERROR
+      #ifndef PULP_SPI
+      if(err)
+         printf("error at %d: y_out=%04x instead of %04x!\n", i, y[i], y_gold[i]);
+      #endif
+      #endif
+   }
+   return errors;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/******************************************************************************
+ *                                                                            *
+ * Project:        CConvNet                                                   *
+ * File:           convLayer16.h                                              *
+ * Description:    16-bit fixed point multi-channel convolution layer test    *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef _CONVLAYER16_H
+#define _CONVLAYER16_H
+
+// uncomment if doing test with SPI (disables printf's)
+// #define PULP_SPI
+
+// fractionary bits (same Q-format as conv16)
+#define QF 13
+
+// uncomment to print every wrong output pixel
+// #define CHECK_ERROR
+
+// L2 buffers, sized for the largest layer of the benchmark
+#define X_L2_SIZE  8192
+#define Y_L2_SIZE 16384
+#define W_L2_SIZE  2304
+
+// L1 buffers: weights are rearranged once per layer, input and output
+// tiles are double buffered so that the DMA overlaps the computation
+#define W_L1_SIZE    4096
+#define X_TILE_SIZE  4096
+#define Y_TILE_SIZE  2048
+
+// one extra pixel is read past the last row by the packed 2-tap loads,
+// it is always multiplied by a zero weight
+#define X_TILE_SLACK 2
+
+typedef struct {
+   const char *name;
+   int nif;      // input feature maps
+   int nof;      // output feature maps
+   int ih;       // input height
+   int iw;       // input width
+   int fh;       // filter height
+   int fw;       // filter width
+   int stride;
+   int pad;
+   int relu;
+   int qf;       // right shift applied to the 32-bit accumulator
+} layer_t;
+
+#define LAYER_OH(l) (((l)->ih + 2*(l)->pad - (l)->fh) / (l)->stride + 1)
+#define LAYER_OW(l) (((l)->iw + 2*(l)->pad - (l)->fw) / (l)->stride + 1)
+// filter rows are zero-padded to an even number of taps for the packed loop
+#define LAYER_FWP(l) (((l)->fw + 1) & ~1)
+
+void conv16_gold(int16_t *__restrict__ W, int16_t *__restrict__ x, int16_t *__restrict__ y, int h, int w, int fh, int fw, int oh, int ow, int nif, int a, int b);
+void conv_layer_gold(layer_t *l, int16_t *W, int16_t *x, int16_t *y);
+// -1 if the filters or a tile of one output row do not fit in L1
+int conv_layer_dma(layer_t *l, int16_t *W, int16_t *x, int16_t *y);
+
+int test_conv16_compat();
+int test_layer(layer_t *l);
+void load(layer_t *l);
+int check(layer_t *l, int16_t *y, int16_t *y_gold);
+
+#endif
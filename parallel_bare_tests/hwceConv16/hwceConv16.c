@@ -0,0 +1,337 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/******************************************************************************
+ *                                                                            *
+ * Project:        CConvNet                                                   *
+ * File:           hwceConv16.c                                               *
+ * Description:    HWCE 5x5 convolution offload vs software conv16            *
+ *                                                                            *
+ * The conv16 plane is accumulated over NIF input maps, exactly as repeated   *
+ * conv16_gold(..., nif, a, b) calls would do. The HWCE path runs one job per *
+ * input map with y_in = y_out; while the engine processes job b, the cores   *
+ * repack the filter of job b+1 and core 0 acquires and programs it, so that  *
+ * the engine never waits for the software. On targets without HWCE v5 only  *
+ * the software variants are run.                                             *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <pulp.h>
+#include <stdint.h>
+#include "hwceConv16.h"
+
+int16_t g_W_l2[NIF*FH*FW];
+int16_t g_x_l2[NIF*IH*IW];
+
+PLP_L1_DATA int16_t g_W[NIF*FH*FW];
+// one more word: the last packed load of conv16_simd_5x5_coarsest takes
+// the element after the last row (against the zero weight of FWP)
+PLP_L1_DATA int16_t g_x[NIF*IH*IW + 2] __attribute__((aligned(4)));
+PLP_L1_DATA int16_t g_y[OH*OW];
+PLP_L1_DATA int16_t g_y_in[OH*OW];
+PLP_L1_DATA int16_t g_y_gold[OH*OW];
+PLP_L1_DATA int16_t g_W_hwce[3][HWCE_WSTRIDE] __attribute__((aligned(4)));
+
+int main() {
+
+   if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+   int errors = 0;
+
+   if(rt_core_id() == 0) {
+      load();
+      // golden output, used by every variant below
+      int b;
+      for(b=0; b<NIF; b++)
+         conv16_gold(g_W, g_x, g_y_gold, IH, IW, FH, FW, OH, OW, NIF, 0, b);
+   }
+
+   // single-threaded "golden" by-the-book convolution
+   errors += test_sw(&conv16_gold, 0, "sequential convolution");
+
+   // best software variant: packed SIMD, 1 thread per output row
+   errors += test_sw(&conv16_simd_5x5_coarsest, 1, "multi-threaded SIMD convolution (1 thread per output row)");
+
+   // hardware convolution engine, one job per input feature map
+   errors += test_hwce("HWCE convolution (1 job per input feature map)");
+
+   synch_barrier();
+
+   return errors;
+}
+
+static void restore_y() {
+   int i;
+   for(i=0; i<OH*OW; i++)
+      g_y[i] = g_y_in[i];
+}
+
+int test_sw(void (*test)(int16_t *, int16_t *, int16_t *, int, int, int, int, int, int, int, int, int), int parallel, char *str) {
+   int errors = 0;
+   int b;
+
+   if(rt_core_id() == 0)
+      restore_y();
+
+   synch_barrier();
+
+   if(rt_core_id() == 0) {
+      reset_timer();
+      start_timer();
+   }
+   if(parallel || rt_core_id() == 0) {
+      for(b=0; b<NIF; b++)
+         test(g_W, g_x, g_y, IH, IW, FH, FW, OH, OW, NIF, 0, b);
+   }
+   if(rt_core_id() == 0) {
+      stop_timer();
+
+      errors = check(g_y);
+
+      #ifndef PULP_SPI
+      printf("%s, errors=%d, time=%d, MAC/cycle x100=%d\n", str, errors, get_time(), (NIF*OH*OW*FH*FW*100) / get_time());
+      #endif
+   }
+
+   synch_barrier();
+
+   return errors;
+}
+
+int test_hwce(char *str) {
+   int errors = 0;
+
+#ifdef HAS_HWCE_V5
+   if(rt_core_id() == 0)
+      restore_y();
+
+   synch_barrier();
+
+   if(rt_core_id() == 0) {
+      reset_timer();
+      start_timer();
+   }
+   conv16_hwce_5x5(g_W, g_x, g_y, IH, IW, OH, OW, NIF, 0);
+   if(rt_core_id() == 0) {
+      stop_timer();
+
+      errors = check(g_y);
+
+      #ifndef PULP_SPI
+      printf("%s, errors=%d, time=%d, MAC/cycle x100=%d\n", str, errors, get_time(), (NIF*OH*OW*FH*FW*100) / get_time());
+      #endif
+   }
+#else
+   #ifndef PULP_SPI
+   if(rt_core_id() == 0)
+      printf("%s, skipped: no HWCE v5 on this target\n", str);
+   #endif
+#endif
+
+   synch_barrier();
+
+   return errors;
+}
+
+// same as parallel_bare_tests/conv16 (IMPRECISE_ASM5 flavour)
+void conv16_gold(int16_t *__restrict__ W, int16_t *__restrict__ x, int16_t *__restrict__ y, int h, int w, int fh, int fw, int oh, int ow, int nif, int a, int b) {
+   int i;
+   for (i=0; i<oh; i++) {
+      int j;
+      for (j=0; j<ow; j++) {
+         int32_t conv = 0;
+         int ui;
+         for (ui=0; ui<fh; ui++) {
+            int uj;
+            for (uj=0; uj<fw; uj++) {
+               int m;
+               int n;
+               m = i-ui+fh-1;
+               n = j-uj+fw-1;
+               conv += W[((((a*nif)+b)*fh)+ui)*fw+uj] * x[(((b*h)+m)*w)+n];
+            }
+         }
+         y[(a*oh+i)*ow+j] = (y[(a*oh+i)*ow+j] + (conv >> QF));
+      }
+   }
+}
+
+void conv16_simd_5x5_coarsest(int16_t *__restrict__ W, int16_t *__restrict__ x, int16_t *__restrict__ y, int h, int w, int fh, int fw, int oh, int ow, int nif, int a, int b) {
+   register int myid      = rt_core_id();
+   register int num_cores = get_core_num();
+   int16_t Wf[FH*FWP] __attribute__((aligned(4)));
+   int16_t *W_base = &W[((a*nif)+b)*fh*fw];
+   int16_t *x_base = x + b*h*w;
+   int16_t *y_ptr  = y + a*oh*ow;
+   int i;
+   int k;
+
+   // flipped and padded copy of the filter, so that the packed loads walk
+   // both W and x forward
+   for (k=0; k<FH*FWP; k++) {
+      int q = k % FWP;
+      int p = k / FWP;
+      Wf[k] = (q < FW) ? W_base[(FH-1-p)*FW + FW-1-q] : 0;
+   }
+
+   for (i=myid; i<oh; i+=num_cores) {
+      int j;
+      for (j=0; j+1<ow; j+=2) {
+         int32_t conv0 = 0;
+         int32_t conv1 = 0;
+         v2s *W_ptr = (v2s *) Wf;
+         int16_t *x_ptr = x_base + i*w + j;
+         int p;
+         for (p=0; p<FH; p++) {
+            v2s w0 = *W_ptr++;
+            v2s w1 = *W_ptr++;
+            v2s w2 = *W_ptr++;
+            conv0 = __SUMDOTP2(*(v2s *) (x_ptr+0), w0, conv0);
+            conv1 = __SUMDOTP2(*(v2s *) (x_ptr+1), w0, conv1);
+            conv0 = __SUMDOTP2(*(v2s *) (x_ptr+2), w1, conv0);
+            conv1 = __SUMDOTP2(*(v2s *) (x_ptr+3), w1, conv1);
+            conv0 = __SUMDOTP2(*(v2s *) (x_ptr+4), w2, conv0);
+            conv1 = __SUMDOTP2(*(v2s *) (x_ptr+5), w2, conv1);
+            x_ptr += w;
+         }
+         y_ptr[i*ow+j]   += conv0 >> QF;
+         y_ptr[i*ow+j+1] += conv1 >> QF;
+      }
+      for (; j<ow; j++) {
+         int32_t conv = 0;
+         int p;
+         int q;
+         for (p=0; p<FH; p++)
+            for (q=0; q<FW; q++)
+               conv += Wf[p*FWP+q] * x_base[(i+p)*w + j+q];
+         y_ptr[i*ow+j] += conv >> QF;
+      }
+   }
+
+   synch_barrier();
+}
+
+#ifdef HAS_HWCE_V5
+// copies filter (a,b) into a word-aligned HWCE weight slot; the engine is
+// configured in convolution weight order, so no flipping is needed
+static inline void hwce_prepare_weights(int16_t *W, int16_t *W_hwce, int nif, int a, int b) {
+   register int myid      = rt_core_id();
+   register int num_cores = get_core_num();
+   int16_t *W_base = &W[((a*nif)+b)*FH*FW];
+   int k;
+
+   for (k=myid; k<HWCE_WSTRIDE; k+=num_cores)
+      W_hwce[k] = (k < FH*FW) ? W_base[k] : 0;
+}
+
+static inline void hwce_push_job(int16_t *W_hwce, int16_t *x, int16_t *y, int h, int w, int oh, int ow) {
+   // the job queue holds one job besides the running one: wait for a slot
+   while (hwce_acquire_job() < 0)
+      hwce_wait_event();
+
+   hwce_y_trans_size_set(oh*ow);
+   hwce_y_line_stride_length_set(hwce_stride_length_value(ow*sizeof(int16_t), ow));
+   hwce_y_feat_stride_length_set(hwce_stride_length_value(oh*ow*sizeof(int16_t), oh));
+   hwce_y_out_0_base_addr_set((unsigned int) y);
+   hwce_y_in_0_base_addr_set((unsigned int) y);
+   hwce_x_trans_size_set(h*w);
+   hwce_x_line_stride_length_set(hwce_stride_length_value(w*sizeof(int16_t), w));
+   hwce_x_feat_stride_length_set(hwce_stride_length_value(h*w*sizeof(int16_t), h));
+   hwce_x_in_base_addr_set((unsigned int) x);
+   hwce_w_base_addr_set((unsigned int) W_hwce);
+   hwce_job_config0_set(hwce_job_config0_value(0, w, 0, 0));
+   hwce_job_config1_set(hwce_job_config1_value(HWCE_LOOP_ORDER_OF_IF, 1, 1, HWCE_VECT_DISABLE(0, 1, 1, 1), 0, 1));
+   hwce_job_config2_set(hwce_job_config2_value(1, 0, 0, 0, 0, 0, oh));
+
+   hwce_trigger_job();
+}
+
+void conv16_hwce_5x5(int16_t *__restrict__ W, int16_t *__restrict__ x, int16_t *__restrict__ y, int h, int w, int oh, int ow, int nif, int a) {
+   int b;
+
+   if (rt_core_id() == 0) {
+      hwce_soft_clear();
+      // 5x5 signed 16-bit convolution, y_out = y_in + (conv >> QF)
+      hwce_gen_config0_set(hwce_gen_config0_value(HWCE_WSTRIDE*sizeof(int16_t), HWCE_JOBCOPY_OFF, HWCE_CONVMODE_5x5, HWCE_VECTMODE_1,
+                                                  HWCE_SIGNMODE_SIGNED, HWCE_Y_IN_MODE_ON, HWCE_WEIGHTORDER_CONV, QF, 0));
+      hwce_gen_config1_set(hwce_gen_config1_value(HWCE_QMODE_16BIT, 0, HWCE_QMODE_16BIT, 0, 0));
+      hwce_gen_config2_set(hwce_gen_config2_value(HWCE_QMODE_16BIT, 0, 0));
+   }
+
+   hwce_prepare_weights(W, g_W_hwce[0], nif, a, 0);
+
+   synch_barrier();
+
+   // the weights are not copied at job start (HWCE_JOBCOPY_OFF): a slot is
+   // read until its job ends. once job b is acquired, job b-1 may still be
+   // running but job b-2 is done, so slot (b+1)%3 (the one of job b-2) is
+   // refilled after the barrier that follows the acquire
+   for (b=0; b<nif; b++) {
+      if (rt_core_id() == 0)
+         hwce_push_job(g_W_hwce[b%3], x + b*h*w, y + a*oh*ow, h, w, oh, ow);
+
+      synch_barrier();
+
+      if (b+1 < nif)
+         hwce_prepare_weights(W, g_W_hwce[(b+1)%3], nif, a, b+1);
+
+      synch_barrier();
+   }
+
+   if (rt_core_id() == 0) {
+      while (HWCE_READ(HWCE_STATUS) != 0)
+         hwce_wait_event();
+   }
+
+   synch_barrier();
+}
+#endif
+
+void load() {
+   int i;
+   for(i=0; i<NIF*FH*FW; i++) {
+      g_W_l2[i] = (int16_t) (((i*104729) % 2048) - 1024);
+   }
+   for(i=0; i<NIF*IH*IW; i++) {
+      g_x_l2[i] = (int16_t) (((i*7919) % 512) - 256);
+   }
+   plp_dma_wait(plp_dma_memcpy((unsigned int) g_W_l2, (unsigned int) g_W, NIF*FH*FW*sizeof(int16_t), 1));
+   plp_dma_wait(plp_dma_memcpy((unsigned int) g_x_l2, (unsigned int) g_x, NIF*IH*IW*sizeof(int16_t), 1));
+   for(i=0; i<OH*OW; i++) {
+      g_y_in[i] = (int16_t) ((i % 0x200) - 0x100);
+      g_y_gold[i] = g_y_in[i];
+   }
+}
+
+int check(int16_t *y) {
+   int i;
+   int errors = 0;
+   for(i=0; i<OH*OW; i++) {
+      int err = ((y[i]!=g_y_gold[i]) ? 1 : 0);
+      errors += err;
+      #ifdef CHECK_ERROR
+      #ifndef PULP_SPI
+      if(err)
+         printf("error: y_out=%04x instead of %04x! y_in=%04x\n", y[i], g_y_gold[i], g_y_in[i]);
+      #endif
+      #endif
+   }
+   return errors;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/******************************************************************************
+ *                                                                            *
+ * Project:        CConvNet                                                   *
+ * File:           hwceConv16.h                                               *
+ * Description:    HWCE 5x5 convolution offload vs software conv16            *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef _HWCECONV16_H
+#define _HWCECONV16_H
+
+// uncomment if doing test with SPI (disables printf's)
+// #define PULP_SPI
+
+// fractionary bits (same Q-format as conv16)
+#define QF 13
+
+// uncomment to print every wrong output pixel
+// #define CHECK_ERROR
+
+// conv16 plane, accumulated over NIF input maps (one HWCE job per map)
+#define NIF 4
+#define IH 32
+#define IW 32
+#define FH 5
+#define FW 5
+#define OH (IH-FH+1)
+#define OW (IW-FW+1)
+
+// filter rows padded to an even number of taps for the packed SW loop
+#define FWP 6
+
+// each 5x5 filter is stored in its own HWCE weight slot, padded to keep
+// the slots word aligned
+#define HWCE_WSTRIDE 26
+
+#if defined(HWCE_VERSION) && HWCE_VERSION == 5
+#define HAS_HWCE_V5
+#endif
+
+void conv16_gold(int16_t *__restrict__ W, int16_t *__restrict__ x, int16_t *__restrict__ y, int h, int w, int fh, int fw, int oh, int ow, int nif, int a, int b);
+void conv16_simd_5x5_coarsest(int16_t *__restrict__ W, int16_t *__restrict__ x, int16_t *__restrict__ y, int h, int w, int fh, int fw, int oh, int ow, int nif, int a, int b);
+void conv16_hwce_5x5(int16_t *__restrict__ W, int16_t *__restrict__ x, int16_t *__restrict__ y, int h, int w, int oh, int ow, int nif, int a);
+
+int test_sw(void (*test)(int16_t *, int16_t *, int16_t *, int, int, int, int, int, int, int, int, int), int parallel, char *str);
+int test_hwce(char *str);
+void load();
+int check(int16_t *y);
+
+#endif
@@ -0,0 +1,336 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/******************************************************************************
+ *                                                                            *
+ * Fixed-point 8x8 and 16x16 DCT/IDCT                                         *
+ *                                                                            *
+ * Separable row/column transforms on packed int16. Each 1D transform is      *
+ * split Loeffler style into the sums and differences of x[n] and x[N-1-n]:   *
+ * the even outputs are the half length transform of the sums (again split    *
+ * for the 8-point core), the odd outputs a matrix on the differences. All    *
+ * rotations and odd matrices are pv.dotsp on packed pairs against Q15        *
+ * basis pairs, so every multiply does two taps. The row pass keeps           *
+ * PASS1_BITS fractional bits and writes its result transposed, so the        *
+ * column pass reads rows again and writes the output in natural order.       *
+ *                                                                            *
+ * Images stay in L2 and are cut in tiles of n rows, streamed through L1 by   *
+ * DMA with double buffering; tiles are distributed over the cores.           *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <pulp.h>
+#include "parDct.h"
+#include "parDct_coef.h"
+
+#define PASS1_SHIFT   (15 - PASS1_BITS)
+#define PASS2_SHIFT   (15 + PASS1_BITS)
+
+PLP_L1_DATA short g_pool[POOL] __attribute__((aligned(4)));
+
+// y[m] = sum a(m,n) x[n] of the 8-point core, unscaled Q15 products
+static inline void dct8_core(v2s x01, v2s x23, v2s x45, v2s x67, const v2s *K, int *y)
+{
+  v2s r76 = __builtin_shuffle(x67, (v2s) {1, 0});
+  v2s r54 = __builtin_shuffle(x45, (v2s) {1, 0});
+  v2s s01 = x01 + r76;                        // {t0, t1}
+  v2s d01 = x01 - r76;                        // {d0, d1}
+  v2s s23 = x23 + r54;                        // {t2, t3}
+  v2s d23 = x23 - r54;                        // {d2, d3}
+  v2s s32 = __builtin_shuffle(s23, (v2s) {1, 0});
+  v2s e = s01 + s32;                          // {t0+t3, t1+t2}
+  v2s f = s01 - s32;                          // {t0-t3, t1-t2}
+
+  y[0] = __DOTP2(e, K[0]);
+  y[4] = __DOTP2(e, K[1]);
+  y[2] = __DOTP2(f, K[2]);
+  y[6] = __DOTP2(f, K[3]);
+  y[1] = __SUMDOTP2(d23, K[5],  __DOTP2(d01, K[4]));
+  y[3] = __SUMDOTP2(d23, K[7],  __DOTP2(d01, K[6]));
+  y[5] = __SUMDOTP2(d23, K[9],  __DOTP2(d01, K[8]));
+  y[7] = __SUMDOTP2(d23, K[11], __DOTP2(d01, K[10]));
+}
+
+// x[n] = sum a(m,n) X[m] of the 8-point core, from {X0, X1} .. {X6, X7}
+static inline void idct8_core(v2s c01, v2s c23, v2s c45, v2s c67, const v2s *K, int *x)
+{
+  v2s ea = __builtin_shuffle(c01, c45, (v2s) {0, 2});    // {X0, X4}
+  v2s eb = __builtin_shuffle(c23, c67, (v2s) {0, 2});    // {X2, X6}
+  v2s oa = __builtin_shuffle(c01, c23, (v2s) {1, 3});    // {X1, X3}
+  v2s ob = __builtin_shuffle(c45, c67, (v2s) {1, 3});    // {X5, X7}
+  int n;
+
+  for (n = 0; n < 4; n++) {
+    int e = __SUMDOTP2(eb, K[4*n+1], __DOTP2(ea, K[4*n]));
+    int o = __SUMDOTP2(ob, K[4*n+3], __DOTP2(oa, K[4*n+2]));
+    x[n]   = e + o;
+    x[7-n] = e - o;
+  }
+}
+
+static inline void fdct8_row(const short *in, short *out, int ostride, int sh)
+{
+  const v2s *x = (const v2s *) in;
+  int y[8];
+  int k;
+
+  dct8_core(x[0], x[1], x[2], x[3], g_fdct8_k, y);
+
+  for (k = 0; k < 8; k++)
+    out[k*ostride] = (y[k] + (1 << (sh-1))) >> sh;
+}
+
+static inline void idct8_row(const short *in, short *out, int ostride, int sh)
+{
+  const v2s *c = (const v2s *) in;
+  int x[8];
+  int n;
+
+  idct8_core(c[0], c[1], c[2], c[3], g_idct8_k, x);
+
+  for (n = 0; n < 8; n++)
+    out[n*ostride] = (x[n] + (1 << (sh-1))) >> sh;
+}
+
+static inline void fdct16_row(const short *in, short *out, int ostride, int sh)
+{
+  const v2s *x = (const v2s *) in;
+  v2s s[4], d[4];
+  int ye[8];
+  int j, k;
+
+  for (j = 0; j < 4; j++) {
+    v2s r = __builtin_shuffle(x[7-j], (v2s) {1, 0});
+    s[j] = x[j] + r;
+    d[j] = x[j] - r;
+  }
+
+  dct8_core(s[0], s[1], s[2], s[3], g_fdct16_even_k, ye);
+
+  for (k = 0; k < 8; k++) {
+    const v2s *K = g_fdct16_odd_k + 4*k;
+    int yo = __DOTP2(d[0], K[0]);
+    yo = __SUMDOTP2(d[1], K[1], yo);
+    yo = __SUMDOTP2(d[2], K[2], yo);
+    yo = __SUMDOTP2(d[3], K[3], yo);
+    out[(2*k)*ostride]   = (ye[k] + (1 << (sh-1))) >> sh;
+    out[(2*k+1)*ostride] = (yo + (1 << (sh-1))) >> sh;
+  }
+}
+
+static inline void idct16_row(const short *in, short *out, int ostride, int sh)
+{
+  const v2s *c = (const v2s *) in;
+  v2s p[4], q[4];
+  int e[8];
+  int i, n;
+
+  for (i = 0; i < 4; i++) {
+    p[i] = __builtin_shuffle(c[2*i], c[2*i+1], (v2s) {0, 2});   // {X4i, X4i+2}
+    q[i] = __builtin_shuffle(c[2*i], c[2*i+1], (v2s) {1, 3});   // {X4i+1, X4i+3}
+  }
+
+  idct8_core(p[0], p[1], p[2], p[3], g_idct16_even_k, e);
+
+  for (n = 0; n < 8; n++) {
+    const v2s *K = g_idct16_odd_k + 4*n;
+    int o = __DOTP2(q[0], K[0]);
+    o = __SUMDOTP2(q[1], K[1], o);
+    o = __SUMDOTP2(q[2], K[2], o);
+    o = __SUMDOTP2(q[3], K[3], o);
+    out[n*ostride]      = (e[n] + o + (1 << (sh-1))) >> sh;
+    out[(15-n)*ostride] = (e[n] - o + (1 << (sh-1))) >> sh;
+  }
+}
+
+void dct8x8(const short *in, int istride, short *out, int ostride, short *tmp)
+{
+  int i;
+
+  for (i = 0; i < 8; i++)
+    fdct8_row(in + i*istride, tmp + i, 8, PASS1_SHIFT);
+  for (i = 0; i < 8; i++)
+    fdct8_row(tmp + i*8, out + i, ostride, PASS2_SHIFT);
+}
+
+void idct8x8(const short *in, int istride, short *out, int ostride, short *tmp)
+{
+  int i;
+
+  for (i = 0; i < 8; i++)
+    idct8_row(in + i*istride, tmp + i, 8, PASS1_SHIFT);
+  for (i = 0; i < 8; i++)
+    idct8_row(tmp + i*8, out + i, ostride, PASS2_SHIFT);
+}
+
+void dct16x16(const short *in, int istride, short *out, int ostride, short *tmp)
+{
+  int i;
+
+  for (i = 0; i < 16; i++)
+    fdct16_row(in + i*istride, tmp + i, 16, PASS1_SHIFT);
+  for (i = 0; i < 16; i++)
+    fdct16_row(tmp + i*16, out + i, ostride, PASS2_SHIFT);
+}
+
+void idct16x16(const short *in, int istride, short *out, int ostride, short *tmp)
+{
+  int i;
+
+  for (i = 0; i < 16; i++)
+    idct16_row(in + i*istride, tmp + i, 16, PASS1_SHIFT);
+  for (i = 0; i < 16; i++)
+    idct16_row(tmp + i*16, out + i, ostride, PASS2_SHIFT);
+}
+
+void dct_blocks(const short *img, int stride, short *coef, int nblk, int n, short *tmp)
+{
+  int b;
+
+  if (n == 8) {
+    for (b = 0; b < nblk; b++)
+      dct8x8(img + b*8, stride, coef + b*64, 8, tmp);
+  } else {
+    for (b = 0; b < nblk; b++)
+      dct16x16(img + b*16, stride, coef + b*256, 16, tmp);
+  }
+}
+
+void idct_blocks(const short *coef, short *img, int stride, int nblk, int n, short *tmp)
+{
+  int b;
+
+  if (n == 8) {
+    for (b = 0; b < nblk; b++)
+      idct8x8(coef + b*64, 8, img + b*8, stride, tmp);
+  } else {
+    for (b = 0; b < nblk; b++)
+      idct16x16(coef + b*256, 16, img + b*16, stride, tmp);
+  }
+}
+
+// Tile t of n rows by tw columns: n*tw shorts at img_off in the image
+// (2D DMA, lines of tw) and at coef_off in the coefficients (1D DMA, the
+// blocks of a tile are consecutive)
+static int tile_fetch(const short *src, short *buf, int t, int w, int n, int tw, int inverse)
+{
+  int tpb = w / tw;
+  int img_off = (t / tpb)*n*w + (t % tpb)*tw;
+  int coef_off = (t / tpb)*n*w + (t % tpb)*tw*n;
+
+  if (inverse)
+    return plp_dma_memcpy((unsigned int) (src + coef_off), (unsigned int) buf, n*tw*sizeof(short), PLP_DMA_EXT2LOC);
+  else
+    return plp_dma_memcpy_2d((unsigned int) (src + img_off), (unsigned int) buf, n*tw*sizeof(short),
+                             w*sizeof(short), tw*sizeof(short), PLP_DMA_EXT2LOC);
+}
+
+static int tile_store(short *dst, short *buf, int t, int w, int n, int tw, int inverse)
+{
+  int tpb = w / tw;
+  int img_off = (t / tpb)*n*w + (t % tpb)*tw;
+  int coef_off = (t / tpb)*n*w + (t % tpb)*tw*n;
+
+  if (inverse)
+    return plp_dma_memcpy_2d((unsigned int) (dst + img_off), (unsigned int) buf, n*tw*sizeof(short),
+                             w*sizeof(short), tw*sizeof(short), PLP_DMA_LOC2EXT);
+  else
+    return plp_dma_memcpy((unsigned int) (dst + coef_off), (unsigned int) buf, n*tw*sizeof(short), PLP_DMA_LOC2EXT);
+}
+
+// tw is the largest power of two <= w for which the 4 tile buffers and
+// the transpose buffer fit the core's share of the pool. a share must hold
+// the smallest tile (tw = n), 5*n*n shorts: with more cores than shares
+// (n = 16 on 16 cores) the extra cores only take part in the barrier
+int dct_cores(int n, int nc)
+{
+  if (nc > POOL / (5*n*n))
+    nc = POOL / (5*n*n);
+  return nc;
+}
+
+static void image_tiles(const short *src, short *dst, int w, int h, int n, int nc, int inverse)
+{
+  int id = rt_core_id();
+  int share;
+
+  nc = dct_cores(n, nc);
+  // even, so that every share (and the tiles in it) stays 4-byte aligned
+  share = (POOL / nc) & ~1;
+
+  if (id < nc) {
+    short *base = g_pool + id*share;
+    int tw = n;
+    int tile, ntiles;
+    short *in[2], *out[2], *tmp;
+    int din[2], dout[2];
+    int pending[2] = { 0, 0 };
+    int cur = 0;
+    int t;
+
+    while (2*tw <= w && 4*n*(2*tw) + n*n <= share)
+      tw *= 2;
+    tile = n*tw;
+    ntiles = (h / n) * (w / tw);
+
+    in[0]  = base;
+    in[1]  = base + tile;
+    out[0] = base + 2*tile;
+    out[1] = base + 3*tile;
+    tmp    = base + 4*tile;
+
+    if (id < ntiles)
+      din[0] = tile_fetch(src, in[0], id, w, n, tw, inverse);
+
+    for (t = id; t < ntiles; t += nc) {
+      plp_dma_wait(din[cur]);
+      if (t + nc < ntiles)
+        din[cur^1] = tile_fetch(src, in[cur^1], t + nc, w, n, tw, inverse);
+
+      if (pending[cur]) {
+        plp_dma_wait(dout[cur]);
+        pending[cur] = 0;
+      }
+
+      if (inverse)
+        idct_blocks(in[cur], out[cur], tw, tw/n, n, tmp);
+      else
+        dct_blocks(in[cur], tw, out[cur], tw/n, n, tmp);
+
+      dout[cur] = tile_store(dst, out[cur], t, w, n, tw, inverse);
+      pending[cur] = 1;
+      cur ^= 1;
+    }
+
+    if (pending[0]) plp_dma_wait(dout[0]);
+    if (pending[1]) plp_dma_wait(dout[1]);
+  }
+
+  synch_barrier();
+}
+
+void dct_image(const short *img, short *coef, int w, int h, int n, int nc)
+{
+  image_tiles(img, coef, w, h, n, nc, 0);
+}
+
+void idct_image(const short *coef, short *img, int w, int h, int n, int nc)
+{
+  image_tiles(coef, img, w, h, n, nc, 1);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#ifndef _PARDCT_H
+#define _PARDCT_H
+
+#include <pulp.h>
+
+// uncomment if doing test with SPI (disables printf's)
+// #define PULP_SPI
+
+// test image in L2, level shifted 8 bit pixels
+#define W             128
+#define H             128
+
+// L1 shared by the cores for the DMA tiles, in shorts
+#define POOL          16384
+
+// fractional bits kept between the row and the column pass
+#define PASS1_BITS    2
+
+// allowed errors: coefficients vs the float transform, and
+// reconstruction vs the original pixels
+#define TOL_REF       2
+#define TOL_REC       2
+
+// Orthonormal 2D DCT-II of one n x n block (n = 8 or 16), rows of in at
+// in + i*istride, rows of out at out + i*ostride; tmp holds n*n shorts.
+// Inputs up to 9 bits signed, in must be 4-byte aligned and istride even.
+void dct8x8(const short *in, int istride, short *out, int ostride, short *tmp);
+void idct8x8(const short *in, int istride, short *out, int ostride, short *tmp);
+void dct16x16(const short *in, int istride, short *out, int ostride, short *tmp);
+void idct16x16(const short *in, int istride, short *out, int ostride, short *tmp);
+
+// nblk blocks side by side in a band of n image rows (row stride stride)
+// to / from nblk consecutive blocks of n*n coefficients
+void dct_blocks(const short *img, int stride, short *coef, int nblk, int n, short *tmp);
+void idct_blocks(const short *coef, short *img, int stride, int nblk, int n, short *tmp);
+
+// Whole w x h image in L2 (multiples of n) to / from block-major
+// coefficients in L2, block (by, bx) at coef + (by*(w/n) + bx)*n*n.
+// Tiles of n rows are streamed by DMA, double buffered, and distributed
+// over nc cores, at most POOL / (5*n*n) (the shares of the pool holding a
+// tile of n x n), as returned by dct_cores. Called by all cores.
+int dct_cores(int n, int nc);
+void dct_image(const short *img, short *coef, int w, int h, int n, int nc);
+void idct_image(const short *coef, short *img, int w, int h, int n, int nc);
+
+#endif
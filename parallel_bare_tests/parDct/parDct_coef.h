@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+
+/* DCT-II basis a(k,n) = s(k)*cos((2n+1)*k*pi/2N), s(0) = sqrt(1/N),
+   s(k) = sqrt(2/N), as packed Q15 pairs: round(32768*x). */
+
+/* 8-point core: forward y[m] from the sums t and differences d of x[n]
+   and x[7-n]; inverse x[n], x[7-n] from {X0, X4}, {X2, X6}, {X1, X3},
+   {X5, X7} */
+PLP_L1_DATA v2s g_fdct8_k[12] = {
+  { 11585,  11585},  // y0, on {t0+t3, t1+t2}
+  { 11585, -11585},  // y4
+  { 15137,   6270},  // y2, on {t0-t3, t1-t2}
+  {  6270, -15137},  // y6
+  { 16069,  13623}, {  9102,   3196},  // y1, on {d0, d1}, {d2, d3}
+  { 13623,  -3196}, {-16069,  -9102},  // y3, on {d0, d1}, {d2, d3}
+  {  9102, -16069}, {  3196,  13623},  // y5, on {d0, d1}, {d2, d3}
+  {  3196,  -9102}, { 13623, -16069},  // y7, on {d0, d1}, {d2, d3}
+};
+
+PLP_L1_DATA v2s g_idct8_k[16] = {
+  { 11585,  11585}, { 15137,   6270}, { 16069,  13623}, {  9102,   3196},  // x0
+  { 11585, -11585}, {  6270, -15137}, { 13623,  -3196}, {-16069,  -9102},  // x1
+  { 11585, -11585}, { -6270,  15137}, {  9102, -16069}, {  3196,  13623},  // x2
+  { 11585,  11585}, {-15137,  -6270}, {  3196,  -9102}, { 13623, -16069},  // x3
+};
+
+/* even half of the 16-point transforms, the 8-point core on a(2m,n) */
+PLP_L1_DATA v2s g_fdct16_even_k[12] = {
+  {  8192,   8192},  // y0, on {t0+t3, t1+t2}
+  {  8192,  -8192},  // y4
+  { 10703,   4433},  // y2, on {t0-t3, t1-t2}
+  {  4433, -10703},  // y6
+  { 11363,   9633}, {  6436,   2260},  // y1, on {d0, d1}, {d2, d3}
+  {  9633,  -2260}, {-11363,  -6436},  // y3, on {d0, d1}, {d2, d3}
+  {  6436, -11363}, {  2260,   9633},  // y5, on {d0, d1}, {d2, d3}
+  {  2260,  -6436}, {  9633, -11363},  // y7, on {d0, d1}, {d2, d3}
+};
+
+PLP_L1_DATA v2s g_idct16_even_k[16] = {
+  {  8192,   8192}, { 10703,   4433}, { 11363,   9633}, {  6436,   2260},  // x0
+  {  8192,  -8192}, {  4433, -10703}, {  9633,  -2260}, {-11363,  -6436},  // x1
+  {  8192,  -8192}, { -4433,  10703}, {  6436, -11363}, {  2260,   9633},  // x2
+  {  8192,   8192}, {-10703,  -4433}, {  2260,  -6436}, {  9633, -11363},  // x3
+};
+
+/* odd half of the 16-point transforms: forward y[k] from the differences
+   {d0, d1} .. {d6, d7}, inverse x[n] from {X1, X3} .. {X13, X15} */
+PLP_L1_DATA v2s g_fdct16_odd_k[32] = {
+  { 11529,  11086}, { 10217,   8956}, {  7350,   5461}, {  3363,   1136},  // y1
+  { 11086,   7350}, {  1136,  -5461}, {-10217, -11529}, { -8956,  -3363},  // y3
+  { 10217,   1136}, { -8956, -11086}, { -3363,   7350}, { 11529,   5461},  // y5
+  {  8956,  -5461}, {-11086,   1136}, { 11529,   3363}, {-10217,  -7350},  // y7
+  {  7350, -10217}, { -3363,  11529}, { -1136, -11086}, {  5461,   8956},  // y9
+  {  5461, -11529}, {  7350,   3363}, {-11086,   8956}, {  1136, -10217},  // y11
+  {  3363,  -8956}, { 11529, -10217}, {  5461,   1136}, { -7350,  11086},  // y13
+  {  1136,  -3363}, {  5461,  -7350}, {  8956, -10217}, { 11086, -11529},  // y15
+};
+
+PLP_L1_DATA v2s g_idct16_odd_k[32] = {
+  { 11529,  11086}, { 10217,   8956}, {  7350,   5461}, {  3363,   1136},  // x0
+  { 11086,   7350}, {  1136,  -5461}, {-10217, -11529}, { -8956,  -3363},  // x1
+  { 10217,   1136}, { -8956, -11086}, { -3363,   7350}, { 11529,   5461},  // x2
+  {  8956,  -5461}, {-11086,   1136}, { 11529,   3363}, {-10217,  -7350},  // x3
+  {  7350, -10217}, { -3363,  11529}, { -1136, -11086}, {  5461,   8956},  // x4
+  {  5461, -11529}, {  7350,   3363}, {-11086,   8956}, {  1136, -10217},  // x5
+  {  3363,  -8956}, { 11529, -10217}, {  5461,   1136}, { -7350,  11086},  // x6
+  {  1136,  -3363}, {  5461,  -7350}, {  8956, -10217}, { 11086, -11529},  // x7
+};
+
+/* float basis of the reference transform */
+const float g_dct8_ref[8][8] = {
+  {0.353553391F, 0.353553391F, 0.353553391F, 0.353553391F, 0.353553391F, 0.353553391F, 0.353553391F, 0.353553391F},
+  {0.490392640F, 0.415734806F, 0.277785117F, 0.097545161F, -0.097545161F, -0.277785117F, -0.415734806F, -0.490392640F},
+  {0.461939766F, 0.191341716F, -0.191341716F, -0.461939766F, -0.461939766F, -0.191341716F, 0.191341716F, 0.461939766F},
+  {0.415734806F, -0.097545161F, -0.490392640F, -0.277785117F, 0.277785117F, 0.490392640F, 0.097545161F, -0.415734806F},
+  {0.353553391F, -0.353553391F, -0.353553391F, 0.353553391F, 0.353553391F, -0.353553391F, -0.353553391F, 0.353553391F},
+  {0.277785117F, -0.490392640F, 0.097545161F, 0.415734806F, -0.415734806F, -0.097545161F, 0.490392640F, -0.277785117F},
+  {0.191341716F, -0.461939766F, 0.461939766F, -0.191341716F, -0.191341716F, 0.461939766F, -0.461939766F, 0.191341716F},
+  {0.097545161F, -0.277785117F, 0.415734806F, -0.490392640F, 0.490392640F, -0.415734806F, 0.277785117F, -0.097545161F}
+};
+
+const float g_dct16_ref[16][16] = {
+  {0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F, 0.250000000F},
+  {0.351850934F, 0.338329500F, 0.311806253F, 0.273300467F, 0.224291897F, 0.166663915F, 0.102631132F, 0.034654292F, -0.034654292F, -0.102631132F, -0.166663915F, -0.224291897F, -0.273300467F, -0.311806253F, -0.338329500F, -0.351850934F},
+  {0.346759961F, 0.293968901F, 0.196423740F, 0.068974845F, -0.068974845F, -0.196423740F, -0.293968901F, -0.346759961F, -0.346759961F, -0.293968901F, -0.196423740F, -0.068974845F, 0.068974845F, 0.196423740F, 0.293968901F, 0.346759961F},
+  {0.338329500F, 0.224291897F, 0.034654292F, -0.166663915F, -0.311806253F, -0.351850934F, -0.273300467F, -0.102631132F, 0.102631132F, 0.273300467F, 0.351850934F, 0.311806253F, 0.166663915F, -0.034654292F, -0.224291897F, -0.338329500F},
+  {0.326640741F, 0.135299025F, -0.135299025F, -0.326640741F, -0.326640741F, -0.135299025F, 0.135299025F, 0.326640741F, 0.326640741F, 0.135299025F, -0.135299025F, -0.326640741F, -0.326640741F, -0.135299025F, 0.135299025F, 0.326640741F},
+  {0.311806253F, 0.034654292F, -0.273300467F, -0.338329500F, -0.102631132F, 0.224291897F, 0.351850934F, 0.166663915F, -0.166663915F, -0.351850934F, -0.224291897F, 0.102631132F, 0.338329500F, 0.273300467F, -0.034654292F, -0.311806253F},
+  {0.293968901F, -0.068974845F, -0.346759961F, -0.196423740F, 0.196423740F, 0.346759961F, 0.068974845F, -0.293968901F, -0.293968901F, 0.068974845F, 0.346759961F, 0.196423740F, -0.196423740F, -0.346759961F, -0.068974845F, 0.293968901F},
+  {0.273300467F, -0.166663915F, -0.338329500F, 0.034654292F, 0.351850934F, 0.102631132F, -0.311806253F, -0.224291897F, 0.224291897F, 0.311806253F, -0.102631132F, -0.351850934F, -0.034654292F, 0.338329500F, 0.166663915F, -0.273300467F},
+  {0.250000000F, -0.250000000F, -0.250000000F, 0.250000000F, 0.250000000F, -0.250000000F, -0.250000000F, 0.250000000F, 0.250000000F, -0.250000000F, -0.250000000F, 0.250000000F, 0.250000000F, -0.250000000F, -0.250000000F, 0.250000000F},
+  {0.224291897F, -0.311806253F, -0.102631132F, 0.351850934F, -0.034654292F, -0.338329500F, 0.166663915F, 0.273300467F, -0.273300467F, -0.166663915F, 0.338329500F, 0.034654292F, -0.351850934F, 0.102631132F, 0.311806253F, -0.224291897F},
+  {0.196423740F, -0.346759961F, 0.068974845F, 0.293968901F, -0.293968901F, -0.068974845F, 0.346759961F, -0.196423740F, -0.196423740F, 0.346759961F, -0.068974845F, -0.293968901F, 0.293968901F, 0.068974845F, -0.346759961F, 0.196423740F},
+  {0.166663915F, -0.351850934F, 0.224291897F, 0.102631132F, -0.338329500F, 0.273300467F, 0.034654292F, -0.311806253F, 0.311806253F, -0.034654292F, -0.273300467F, 0.338329500F, -0.102631132F, -0.224291897F, 0.351850934F, -0.166663915F},
+  {0.135299025F, -0.326640741F, 0.326640741F, -0.135299025F, -0.135299025F, 0.326640741F, -0.326640741F, 0.135299025F, 0.135299025F, -0.326640741F, 0.326640741F, -0.135299025F, -0.135299025F, 0.326640741F, -0.326640741F, 0.135299025F},
+  {0.102631132F, -0.273300467F, 0.351850934F, -0.311806253F, 0.166663915F, 0.034654292F, -0.224291897F, 0.338329500F, -0.338329500F, 0.224291897F, -0.034654292F, -0.166663915F, 0.311806253F, -0.351850934F, 0.273300467F, -0.102631132F},
+  {0.068974845F, -0.196423740F, 0.293968901F, -0.346759961F, 0.346759961F, -0.293968901F, 0.196423740F, -0.068974845F, -0.068974845F, 0.196423740F, -0.293968901F, 0.346759961F, -0.346759961F, 0.293968901F, -0.196423740F, 0.068974845F},
+  {0.034654292F, -0.102631132F, 0.166663915F, -0.224291897F, 0.273300467F, -0.311806253F, 0.338329500F, -0.351850934F, 0.351850934F, -0.338329500F, 0.311806253F, -0.273300467F, 0.224291897F, -0.166663915F, 0.102631132F, -0.034654292F}
+};
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <pulp.h>
+#include "parDct.h"
+
+// blocks checked against the float transform, spread over the image
+#define NCHECK  8
+
+extern const float g_dct8_ref[8][8];
+extern const float g_dct16_ref[16][16];
+
+// L2: image, coefficients, reconstruction
+short g_img[W*H];
+short g_coef[W*H];
+short g_rec[W*H];
+
+// single-core cycles of the forward and inverse runs, for the speedup column
+static int g_cycles_1core[2];
+
+// row pass of the float reference
+static float g_ref_temp[16][16];
+
+int test_dct(int n, int nc);
+void load();
+int check_ref(int n);
+int check_rec();
+
+int main()
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  int errors = 0;
+  int n, nc;
+
+  if (rt_core_id() == 0)
+    load();
+
+  synch_barrier();
+
+  for (n = 8; n <= 16; n <<= 1) {
+    for (nc = 1; nc <= get_core_num(); nc <<= 1)
+      errors += test_dct(n, nc);
+  }
+
+  #ifndef PULP_SPI
+  if (rt_core_id() == 0)
+    printf("errors=%d\n", errors);
+  #endif
+
+  synch_barrier();
+
+  return errors;
+}
+
+// forward transform of the image, then back; the coefficients are checked
+// against the float transform with one core, the reconstruction always
+int test_dct(int n, int nc)
+{
+  int errors = 0;
+  int cycles[2];
+  int inverse;
+
+  for (inverse = 0; inverse <= 1; inverse++) {
+    synch_barrier();
+
+    if (rt_core_id() == 0) {
+      reset_timer();
+      start_timer();
+    }
+
+    if (inverse)
+      idct_image(g_coef, g_rec, W, H, n, nc);
+    else
+      dct_image(g_img, g_coef, W, H, n, nc);
+
+    if (rt_core_id() == 0) {
+      stop_timer();
+      cycles[inverse] = get_time();
+      if (nc == 1)
+        g_cycles_1core[inverse] = cycles[inverse];
+    }
+  }
+
+  if (rt_core_id() == 0) {
+    int nblk = (W/n) * (H/n);
+
+    if (nc == 1)
+      errors += check_ref(n);
+    errors += check_rec();
+
+    #ifndef PULP_SPI
+    for (inverse = 0; inverse <= 1; inverse++)
+      printf("N=%dx%d, %s, cores=%d, errors=%d, time=%d, blocks/Mcycle=%d, speedup x100=%d\n", n, n,
+             inverse ? "idct" : "dct", dct_cores(n, nc), errors, cycles[inverse], (nblk * 1000000) / cycles[inverse],
+             (g_cycles_1core[inverse] * 100) / cycles[inverse]);
+    #endif
+  }
+
+  synch_barrier();
+
+  return errors;
+}
+
+// smooth gradients, a periodic texture and some noise, level shifted
+void load()
+{
+  unsigned seed = 0x3c6ef372;
+  int x, y;
+
+  for (y = 0; y < H; y++) {
+    for (x = 0; x < W; x++) {
+      int v = (x + 2*y) / 3 + ((((x >> 2) ^ (y >> 3)) & 3) << 5);
+      seed = seed * 1103515245 + 12345;
+      v += (seed >> 28) - 8;
+      if (v < 0)   v = 0;
+      if (v > 255) v = 255;
+      g_img[y*W + x] = v - 128;
+    }
+  }
+}
+
+// same separable product as sequential_bare_tests/dct, in float with the
+// orthonormal basis: temp = block * C^T, ref = C * temp
+int check_ref(int n)
+{
+  const float *C = n == 8 ? &g_dct8_ref[0][0] : &g_dct16_ref[0][0];
+  int nblk = (W/n) * (H/n);
+  int errors = 0;
+  int maxerr = 0;
+  int c, i, j, k;
+
+  for (c = 0; c < NCHECK; c++) {
+    int b = (c * (nblk - 1)) / (NCHECK - 1);
+    const short *blk = g_img + (b / (W/n))*n*W + (b % (W/n))*n;
+    const short *coef = g_coef + b*n*n;
+
+    for (i = 0; i < n; i++)
+      for (j = 0; j < n; j++) {
+        g_ref_temp[i][j] = 0.0f;
+        for (k = 0; k < n; k++)
+          g_ref_temp[i][j] += blk[i*W + k] * C[j*n + k];
+      }
+
+    for (i = 0; i < n; i++)
+      for (j = 0; j < n; j++) {
+        float ref = 0.0f;
+        int r, err;
+        for (k = 0; k < n; k++)
+          ref += C[i*n + k] * g_ref_temp[k][j];
+        r = ref < 0.0f ? (int) (ref - 0.5f) : (int) (ref + 0.5f);
+        err = coef[i*n + j] - r;
+        if (err < 0)
+          err = -err;
+        if (err > maxerr)
+          maxerr = err;
+        if (err > TOL_REF)
+          errors++;
+      }
+  }
+
+  #ifndef PULP_SPI
+  printf("N=%dx%d, max error vs float reference %d\n", n, n, maxerr);
+  #endif
+
+  return errors;
+}
+
+int check_rec()
+{
+  int errors = 0;
+  int i;
+
+  for (i = 0; i < W*H; i++) {
+    int err = g_rec[i] - g_img[i];
+    if (err > TOL_REC || err < -TOL_REC)
+      errors++;
+  }
+
+  return errors;
+}
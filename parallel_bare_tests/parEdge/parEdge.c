@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/******************************************************************************
+ *                                                                            *
+ * Fused edge pipeline: Gaussian blur, Sobel, magnitude, direction            *
+ *                                                                            *
+ * Each core runs its band of rows through a ring of EDGE_RING line buffers.  *
+ * The smoothed row b overwrites input row b-1, which nothing reads after it, *
+ * and the magnitude of row r overwrites smoothed row r-1 the same way, then  *
+ * goes back to L2 in place of input row r. While a row is computed the DMA   *
+ * fetches input row r+3 into the slot written back one row before. The      *
+ * rows of the neighbouring bands are loaded before a barrier, ahead of any   *
+ * write back: the two above into the ring, the two below into the halo.      *
+ * The direction uses the sign and ratio of the gradient components against  *
+ * tan(22.5 deg) instead of an arctangent.                                    *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <pulp.h>
+#include "parEdge.h"
+
+PLP_L1_DATA unsigned char g_ring[EDGE_NC_MAX][EDGE_RING][EDGE_W_MAX] __attribute__((aligned(4)));
+PLP_L1_DATA unsigned char g_halo[EDGE_NC_MAX][2][EDGE_W_MAX] __attribute__((aligned(4)));
+PLP_L1_DATA unsigned char g_dirbuf[EDGE_NC_MAX][EDGE_W_MAX/4] __attribute__((aligned(4)));
+
+// smoothed row from input rows p, q, s; o may be p. The vertical [1 2 1]
+// sums slide through v0..v2
+static void blur_row(const unsigned char *p, const unsigned char *q, const unsigned char *s,
+                     unsigned char *o, int w)
+{
+  int v0, v1, v2, x;
+
+  v1 = p[0] + 2*q[0] + s[0];
+  v0 = v1;
+
+  for (x = 0; x < w-1; x++) {
+    v2 = p[x+1] + 2*q[x+1] + s[x+1];
+    o[x] = (v0 + 2*v1 + v2 + 8) >> 4;
+    v0 = v1;
+    v1 = v2;
+  }
+
+  o[w-1] = (v0 + 3*v1 + 8) >> 4;
+}
+
+// one output pixel: gx = s[x+1] - s[x-1] of the column sums s = a + 2b + c,
+// gy = d[x-1] + 2d[x] + d[x+1] of the differences d = c - a
+#define SOBEL_PIXEL(k)                                          \
+  do {                                                          \
+    int gx = s2 - s0;                                           \
+    int gy = d0 + 2*d1 + d2;                                    \
+    int ax = gx < 0 ? -gx : gx;                                 \
+    int ay = gy < 0 ? -gy : gy;                                 \
+    code |= edge_dir(gx, gy) << (2*(k));                        \
+    a[x+(k)] = (ax + ay) >> 3;                                  \
+  } while (0)
+
+#define SOBEL_SLIDE(x1)                                         \
+  do {                                                          \
+    s0 = s1; s1 = s2;                                           \
+    d0 = d1; d1 = d2;                                           \
+    s2 = a[x1] + 2*b[x1] + c[x1];                               \
+    d2 = c[x1] - a[x1];                                         \
+  } while (0)
+
+// Sobel of smoothed rows a, b, c; the magnitude overwrites a (column x is
+// written once x+1 has been read), the directions go to d4
+static void sobel_row(unsigned char *a, const unsigned char *b, const unsigned char *c,
+                      unsigned char *d4, int w)
+{
+  int s0, s1, s2, d0, d1, d2, x, code;
+
+  s1 = a[0] + 2*b[0] + c[0];
+  d1 = c[0] - a[0];
+  s0 = s1;
+  d0 = d1;
+  s2 = a[1] + 2*b[1] + c[1];
+  d2 = c[1] - a[1];
+
+  for (x = 0; x < w-4; x += 4) {
+    code = 0;
+    SOBEL_PIXEL(0);
+    SOBEL_SLIDE(x+2);
+    SOBEL_PIXEL(1);
+    SOBEL_SLIDE(x+3);
+    SOBEL_PIXEL(2);
+    SOBEL_SLIDE(x+4);
+    SOBEL_PIXEL(3);
+    SOBEL_SLIDE(x+5);
+    d4[x >> 2] = code;
+  }
+
+  // last 4 pixels, the right border replicated
+  code = 0;
+  SOBEL_PIXEL(0);
+  SOBEL_SLIDE(x+2);
+  SOBEL_PIXEL(1);
+  SOBEL_SLIDE(x+3);
+  SOBEL_PIXEL(2);
+  s0 = s1; s1 = s2;
+  d0 = d1; d1 = d2;
+  SOBEL_PIXEL(3);
+  d4[x >> 2] = code;
+}
+
+// input row i (clamped to the image) into slot; the rows of the next band
+// come from the halo. Returns the DMA id, -1 for a copy
+static int fetch_row(const unsigned char *img, int w, int h, int r1, unsigned char halo[][EDGE_W_MAX],
+                     int i, unsigned char *slot)
+{
+  int src = i < 0 ? 0 : (i >= h ? h-1 : i);
+
+  if (src >= r1) {
+    memcpy(slot, halo[src - r1], w);
+    return -1;
+  }
+
+  return plp_dma_memcpy((unsigned int) (img + src*w), (unsigned int) slot, w, PLP_DMA_EXT2LOC);
+}
+
+static inline void dma_done(int id)
+{
+  if (id >= 0)
+    plp_dma_wait(id);
+}
+
+void edge_fused(unsigned char *img, unsigned char *dir, int w, int h, int nc)
+{
+  int id = rt_core_id();
+  int chunk = (h + nc - 1) / nc;
+  int r0 = id*chunk;
+  int r1 = r0 + chunk < h ? r0 + chunk : h;
+  unsigned char (*ring)[EDGE_W_MAX];
+  unsigned char (*halo)[EDGE_W_MAX];
+  unsigned char *d4;
+  int din = -1, dmag = -1, ddir = -1;
+  int last, r, k, id0, id1, id2, id3;
+
+  if (id >= nc || r0 >= h) {
+    synch_barrier();
+    synch_barrier();
+    return;
+  }
+
+  // last input row needed
+  last = r1 < h ? r1 + 1 : h;
+
+  ring = g_ring[id];
+  halo = g_halo[id];
+  d4 = g_dirbuf[id];
+
+  // slot of row i is (i - r0 + 2) % EDGE_RING: rows r0-2 .. r0+1 and the
+  // two rows below the band, before anyone writes back
+  id0 = fetch_row(img, w, h, h, halo, r0-2, ring[0]);
+  id1 = fetch_row(img, w, h, h, halo, r0-1, ring[1]);
+  id2 = fetch_row(img, w, h, h, halo, r0,   ring[2]);
+  id3 = fetch_row(img, w, h, h, halo, r0+1, ring[3]);
+  dma_done(id0);
+  dma_done(id1);
+  dma_done(id2);
+  dma_done(id3);
+  if (r1 < h) {
+    dma_done(fetch_row(img, w, h, h, halo, r1,   halo[0]));
+    dma_done(fetch_row(img, w, h, h, halo, r1+1, halo[1]));
+  }
+
+  synch_barrier();
+
+  // smoothed rows r0-1 and r0, then row r0+2 on its way. Outside the
+  // image the smoothed rows replicate the border ones
+  if (r0 == 0) {
+    blur_row(ring[1], ring[2], ring[3], ring[1], w);
+    memcpy(ring[0], ring[1], w);
+  } else {
+    blur_row(ring[0], ring[1], ring[2], ring[0], w);
+    blur_row(ring[1], ring[2], ring[3], ring[1], w);
+  }
+  din = fetch_row(img, w, h, r1, halo, r0+2, ring[4]);
+
+  for (r = r0, k = 0; r < r1; r++) {
+    // k is the slot of row r-2 (smoothed r-1)
+    int k1 = k + 1 < EDGE_RING ? k + 1 : 0;
+    int k2 = k1 + 1 < EDGE_RING ? k1 + 1 : 0;
+    int k3 = k2 + 1 < EDGE_RING ? k2 + 1 : 0;
+    int k4 = k3 + 1 < EDGE_RING ? k3 + 1 : 0;
+    int k5 = k4 + 1 < EDGE_RING ? k4 + 1 : 0;
+
+    // row r+2 in; row r+3 goes where the magnitude of row r-1 was
+    dma_done(din);
+    dma_done(dmag);
+    din = -1;
+    if (r + 3 <= last)
+      din = fetch_row(img, w, h, r1, halo, r+3, ring[k5]);
+
+    if (r + 1 < h)
+      blur_row(ring[k2], ring[k3], ring[k4], ring[k2], w);
+    else
+      memcpy(ring[k2], ring[k1], w);
+
+    dma_done(ddir);
+    sobel_row(ring[k], ring[k1], ring[k2], d4, w);
+
+    dmag = plp_dma_memcpy((unsigned int) (img + r*w), (unsigned int) ring[k], w, PLP_DMA_LOC2EXT);
+    ddir = plp_dma_memcpy((unsigned int) (dir + r*(w/4)), (unsigned int) d4, w/4, PLP_DMA_LOC2EXT);
+
+    k = k1;
+  }
+
+  dma_done(din);
+  dma_done(dmag);
+  dma_done(ddir);
+
+  synch_barrier();
+}
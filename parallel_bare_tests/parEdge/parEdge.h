@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#ifndef _PAREDGE_H
+#define _PAREDGE_H
+
+#include <pulp.h>
+
+// uncomment if doing test with SPI (disables printf's)
+// #define PULP_SPI
+
+// test image, 8 bit gray (VGA)
+#define IMG_W         640
+#define IMG_H         480
+
+// widest row, cores with line buffers
+#define EDGE_W_MAX    640
+#define EDGE_NC_MAX   8
+
+// line buffers per core: 2 input rows ahead, 3 smoothed rows and the one
+// being fetched share a ring, a smoothed row becoming an input one's slot
+#define EDGE_RING     6
+
+// gradient directions, modulo 180 degrees, y down
+#define DIR_0         0
+#define DIR_45        1
+#define DIR_90        2
+#define DIR_135       3
+
+// tan(22.5 deg) in Q16, the bin boundaries
+#define TAN22_Q16     27146
+
+// direction of pixel x of a row of packed directions
+#define EDGE_DIR(d, x) (((d)[(x) >> 2] >> (2*((x) & 3))) & 3)
+
+// Gaussian 3x3 ([1 2 1]' * [1 2 1] / 16, rounded) -> Sobel -> magnitude
+// (|gx| + |gy|) / 8 -> direction quantized to 4 bins, in one pass with the
+// borders replicated. img (w x h, 8 bit, L2) is overwritten with the
+// magnitude, dir (L2) gets the directions, 2 bits each, 4 per byte (pixel
+// x in bits 2*(x%4) of byte x/4 of the row). w is a multiple of 4, at most
+// EDGE_W_MAX. The cores take bands of rows, streamed through a few line
+// buffers in L1; nc <= EDGE_NC_MAX. Called by all cores.
+void edge_fused(unsigned char *img, unsigned char *dir, int w, int h, int nc);
+
+// the direction bin of a gradient
+static inline int edge_dir(int gx, int gy)
+{
+  int ax = gx < 0 ? -gx : gx;
+  int ay = gy < 0 ? -gy : gy;
+
+  if ((ay << 16) <= ax * TAN22_Q16)
+    return DIR_0;
+  if ((ax << 16) <= ay * TAN22_Q16)
+    return DIR_90;
+  return (gx ^ gy) >= 0 ? DIR_45 : DIR_135;
+}
+
+#endif
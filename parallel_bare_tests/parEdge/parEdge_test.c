@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <pulp.h>
+#include "parEdge.h"
+
+// L2 image, overwritten by the magnitude, and the packed directions
+unsigned char g_img[IMG_W*IMG_H];
+unsigned char g_dir[IMG_W*IMG_H/4];
+
+// smoothed rows of the reference, row r at r % 3
+static unsigned char g_ref_blur[3][IMG_W];
+
+// single-core cycles, for the speedup column
+static int g_cycles_1core;
+
+int test_edge(int nc);
+void load();
+int check();
+
+int main()
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  int errors = 0;
+  int nc;
+
+  for (nc = 1; nc <= get_core_num() && nc <= EDGE_NC_MAX; nc <<= 1)
+    errors += test_edge(nc);
+
+  #ifndef PULP_SPI
+  if (rt_core_id() == 0)
+    printf("errors=%d\n", errors);
+  #endif
+
+  synch_barrier();
+
+  return errors;
+}
+
+int test_edge(int nc)
+{
+  int errors = 0;
+
+  if (rt_core_id() == 0)
+    load();
+
+  synch_barrier();
+
+  if (rt_core_id() == 0) {
+    reset_timer();
+    start_timer();
+  }
+
+  edge_fused(g_img, g_dir, IMG_W, IMG_H, nc);
+
+  if (rt_core_id() == 0) {
+    int cycles;
+
+    stop_timer();
+    cycles = get_time();
+    if (nc == 1)
+      g_cycles_1core = cycles;
+
+    errors = check();
+
+    #ifndef PULP_SPI
+    printf("edges %dx%d, cores=%d, errors=%d, time=%d, cycles/pixel x100=%d, speedup x100=%d\n",
+           IMG_W, IMG_H, nc, errors, cycles, (int) ((cycles * 100LL) / (IMG_W * IMG_H)),
+           (g_cycles_1core * 100) / cycles);
+    #endif
+  }
+
+  synch_barrier();
+
+  return errors;
+}
+
+// concentric rings, diagonal stripes and noise: edges in every direction
+static int pixel(int x, int y)
+{
+  int dx = x - IMG_W/2;
+  int dy = y - IMG_H/2;
+  unsigned int n = (unsigned int) x * 73856093u ^ (unsigned int) y * 19349663u;
+
+  n ^= n >> 13;
+  n *= 0x5bd1e995u;
+  return 40 + 120*(((dx*dx + dy*dy) >> 10) & 1) + 60*(((x + 2*y) >> 5) & 1) + (n >> 28);
+}
+
+void load()
+{
+  int x, y;
+
+  for (y = 0; y < IMG_H; y++)
+    for (x = 0; x < IMG_W; x++)
+      g_img[y*IMG_W + x] = pixel(x, y);
+}
+
+static int clampi(int v, int lo, int hi)
+{
+  return v < lo ? lo : (v > hi ? hi : v);
+}
+
+// smoothed row y of the original image, straight from the 3x3 kernel
+static void ref_blur_row(int y, unsigned char *o)
+{
+  static const int g[3] = { 1, 2, 1 };
+  int x, i, j;
+
+  for (x = 0; x < IMG_W; x++) {
+    int acc = 8;
+    for (i = -1; i <= 1; i++)
+      for (j = -1; j <= 1; j++)
+        acc += g[i+1]*g[j+1]*pixel(clampi(x+j, 0, IMG_W-1), clampi(y+i, 0, IMG_H-1));
+    o[x] = acc >> 4;
+  }
+}
+
+// Sobel on the reference smoothed rows, against g_img and g_dir
+int check()
+{
+  int errors = 0;
+  int x, y;
+
+  ref_blur_row(0, g_ref_blur[0]);
+  ref_blur_row(1, g_ref_blur[1]);
+
+  for (y = 0; y < IMG_H; y++) {
+    const unsigned char *a = g_ref_blur[(y == 0 ? 0 : y-1) % 3];
+    const unsigned char *b = g_ref_blur[y % 3];
+    const unsigned char *c;
+
+    if (y+1 < IMG_H)
+      ref_blur_row(y+1, g_ref_blur[(y+1) % 3]);
+    c = g_ref_blur[(y+1 < IMG_H ? y+1 : y) % 3];
+
+    for (x = 0; x < IMG_W; x++) {
+      int xl = x > 0 ? x-1 : 0;
+      int xr = x < IMG_W-1 ? x+1 : x;
+      int gx = (a[xr] + 2*b[xr] + c[xr]) - (a[xl] + 2*b[xl] + c[xl]);
+      int gy = (c[xl] + 2*c[x] + c[xr]) - (a[xl] + 2*a[x] + a[xr]);
+      int mag = ((gx < 0 ? -gx : gx) + (gy < 0 ? -gy : gy)) >> 3;
+
+      if (g_img[y*IMG_W + x] != mag || EDGE_DIR(g_dir + y*(IMG_W/4), x) != edge_dir(gx, gy))
+        errors++;
+    }
+  }
+
+  return errors;
+}
@@ -0,0 +1,513 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/******************************************************************************
+ *                                                                            *
+ * Multi-core fixed-point FFT                                                 *
+ *                                                                            *
+ * Radix-4 decimation in frequency on packed {re, im} Q15 samples, with a     *
+ * radix-2 last stage when log2(N) is odd; every stage scales by its radix,   *
+ * so the result is DFT/N. The middle butterfly outputs are stored swapped    *
+ * so that the result is in plain bit-reversed order.                         *
+ *                                                                            *
+ * N <= NMAX_L1: the transform is copied to L1, the N/4 butterflies of each   *
+ *   stage are split evenly across the cores, one barrier per stage.          *
+ * N >  NMAX_L1: four-step, N = N1*N2. Each core streams blocks of columns    *
+ *   from L2 (2D DMA), runs N2 FFTs of length N1 and applies W_N^(n2*k1),     *
+ *   then blocks of rows for the N1 FFTs of length N2, written back           *
+ *   transposed to get the natural output order. The column blocks are        *
+ *   double buffered per core; a row block needs both tiles (input and        *
+ *   transpose), so its load only overlaps the output of the previous one.    *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <pulp.h>
+#include "parFFT.h"
+#include "parFFT_cos.h"
+
+#ifndef ARCHI_CORE_HAS_CPLX
+// cores without the complex extension, same results as the instructions
+#define __CPLXMULS(x, y)      ((v2s) {(signed short) ((((int) (x)[0]*(int) (y)[0]) - ((int) (x)[1]*(int) (y)[1])) >> 15), \
+                                      (signed short) ((((int) (x)[0]*(int) (y)[1]) + ((int) (x)[1]*(int) (y)[0])) >> 15)})
+#define __CPLXMULSDIV4(x, y)  (__CPLXMULS(x, y) >> (v2s) {2, 2})
+#define __SUB2ROTMJ(x, y)     ((v2s) {(x)[1]-(y)[1], (y)[0]-(x)[0]})
+#define __ADD2DIV2(x, y)      (((x)+(y)) >> (v2s) {1, 1})
+#define __ADD2DIV4(x, y)      (((x)+(y)) >> (v2s) {2, 2})
+#define __SUB2DIV2(x, y)      (((x)-(y)) >> (v2s) {1, 1})
+#endif
+
+// L2: input, four-step intermediate, output
+v2s g_x_l2[NMAX];
+v2s g_t_l2[NMAX];
+v2s g_y_l2[NMAX];
+
+// L1: whole transform for N <= NMAX_L1, per-core DMA tiles otherwise
+PLP_L1_DATA v2s g_data[NMAX_L1];
+// W^k = exp(-2*pi*i*k/NMAX_L1), k < 3*NMAX_L1/4
+PLP_L1_DATA v2s g_tw[3*NMAX_L1/4];
+PLP_L1_DATA unsigned short g_bitrev[NMAX_L1];
+PLP_L1_DATA short g_cos[NMAX/4+2];
+
+// single-core cycles per length, for the speedup column
+static int g_cycles_1core[LOG2_NMAX+1];
+
+int main()
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  int errors = 0;
+  int n, nc;
+
+  fft_init();
+
+  for (n = NMIN; n <= NMAX; n <<= 1) {
+    for (nc = 1; nc <= get_core_num(); nc <<= 1)
+      errors += test_fft(n, nc);
+  }
+
+  #ifndef PULP_SPI
+  if (rt_core_id() == 0)
+    printf("errors=%d\n", errors);
+  #endif
+
+  synch_barrier();
+
+  return errors;
+}
+
+// cos and sin of 2*pi*k/NMAX in Q15, any k
+static inline void cossin(int k, short *c, short *s)
+{
+  const int q = NMAX/4;
+
+  k &= NMAX-1;
+  if (k <= q) {
+    *c = g_cos[k];
+    *s = g_cos[q-k];
+  } else if (k <= 2*q) {
+    *c = -g_cos[2*q-k];
+    *s = g_cos[k-q];
+  } else if (k <= 3*q) {
+    *c = -g_cos[k-2*q];
+    *s = -g_cos[3*q-k];
+  } else {
+    *c = g_cos[4*q-k];
+    *s = -g_cos[k-3*q];
+  }
+}
+
+void fft_init()
+{
+  int id = rt_core_id();
+  int nc = get_core_num();
+  int k;
+
+  if (id == 0)
+    plp_dma_wait(plp_dma_memcpy((unsigned int) cos_q15_l2, (unsigned int) g_cos, (NMAX/4+1)*sizeof(short), PLP_DMA_EXT2LOC));
+
+  synch_barrier();
+
+  for (k = id; k < 3*NMAX_L1/4; k += nc) {
+    short c, s;
+    cossin(k*(NMAX/NMAX_L1), &c, &s);
+    g_tw[k] = __PACK2(c, -s);
+  }
+
+  for (k = id; k < NMAX_L1; k += nc) {
+    unsigned int r = 0;
+    int b;
+    for (b = 0; b < LOG2_NMAX_L1; b++)
+      r |= ((k >> b) & 1) << (LOG2_NMAX_L1-1-b);
+    g_bitrev[k] = r;
+  }
+
+  synch_barrier();
+}
+
+static inline void bfly4(v2s *p, int q, v2s w1, v2s w2, v2s w3)
+{
+  v2s a = p[0];
+  v2s b = p[q];
+  v2s c = p[2*q];
+  v2s d = p[3*q];
+
+  v2s u0 = a + c;
+  v2s u1 = a - c;
+  v2s u2 = b + d;
+  v2s u3 = __SUB2ROTMJ(b, d);   // -j*(b-d)
+
+  p[0]   = __ADD2DIV4(u0, u2);
+  p[q]   = __CPLXMULSDIV4(u0 - u2, w2);
+  p[2*q] = __CPLXMULSDIV4(u1 + u3, w1);
+  p[3*q] = __CPLXMULSDIV4(u1 - u3, w3);
+}
+
+static inline void bfly2(v2s *p, int q)
+{
+  v2s a = p[0];
+  v2s b = p[q];
+  p[0] = __ADD2DIV2(a, b);
+  p[q] = __SUB2DIV2(a, b);
+}
+
+// single core, n <= NMAX_L1 points spaced by stride, used by the four-step
+void fft_seq(v2s *data, int n, int stride)
+{
+  int log2n = 31 - __builtin_clz(n);
+  int len = n;
+  int tstep = NMAX_L1 / n;
+  int i, k, g;
+
+  while (len >= 4) {
+    int q = len >> 2;
+    int ngroups = n / len;
+    v2s *tw1 = g_tw;
+    v2s *tw2 = g_tw;
+    v2s *tw3 = g_tw;
+
+    for (k = 0; k < q; k++) {
+      v2s w1 = *tw1;
+      v2s w2 = *tw2;
+      v2s w3 = *tw3;
+      v2s *p = data + k*stride;
+
+      tw1 += tstep;
+      tw2 += 2*tstep;
+      tw3 += 3*tstep;
+
+      for (g = 0; g < ngroups; g++) {
+        bfly4(p, q*stride, w1, w2, w3);
+        p += len*stride;
+      }
+    }
+
+    len >>= 2;
+    tstep <<= 2;
+  }
+
+  if (len == 2) {
+    v2s *p = data;
+    for (g = 0; g < n/2; g++) {
+      bfly2(p, stride);
+      p += 2*stride;
+    }
+  }
+
+  {
+    int shift = LOG2_NMAX_L1 - log2n;
+    for (i = 0; i < n; i++) {
+      int j = g_bitrev[i] >> shift;
+      if (i < j) {
+        v2s tmp = data[i*stride];
+        data[i*stride] = data[j*stride];
+        data[j*stride] = tmp;
+      }
+    }
+  }
+}
+
+// in place in L1, n <= NMAX_L1, butterflies of each stage split over nc cores
+void fft_par(v2s *data, int n, int nc)
+{
+  int id = rt_core_id();
+  int log2n = 31 - __builtin_clz(n);
+  int len = n;
+  int tstep = NMAX_L1 / n;
+  int chunk, first, last, b;
+
+  // butterfly b of a stage is (group b/q, index b%q), the cores take
+  // contiguous ranges of b so that the load is even at every stage
+  chunk = ((n >> 2) + nc - 1) / nc;
+  first = id * chunk;
+  last  = first + chunk;
+  if (last > (n >> 2))
+    last = n >> 2;
+
+  while (len >= 4) {
+    int q = len >> 2;
+
+    if (id < nc && first < last) {
+      int g = first / q;
+      int k = first - g*q;
+      v2s *p = data + g*len + k;
+      v2s *tw1 = g_tw + k*tstep;
+      v2s *tw2 = g_tw + 2*k*tstep;
+      v2s *tw3 = g_tw + 3*k*tstep;
+
+      for (b = first; b < last; b++) {
+        bfly4(p, q, *tw1, *tw2, *tw3);
+        p++;
+        tw1 += tstep;
+        tw2 += 2*tstep;
+        tw3 += 3*tstep;
+        if (++k == q) {
+          k = 0;
+          p += len - q;
+          tw1 = tw2 = tw3 = g_tw;
+        }
+      }
+    }
+
+    len >>= 2;
+    tstep <<= 2;
+
+    synch_barrier();
+  }
+
+  if (len == 2) {
+    int half = n >> 1;
+    int c2 = (half + nc - 1) / nc;
+    int f2 = id * c2;
+    int l2 = (f2 + c2 > half) ? half : f2 + c2;
+
+    if (id < nc) {
+      for (b = f2; b < l2; b++)
+        bfly2(data + 2*b, 1);
+    }
+
+    synch_barrier();
+  }
+
+  // each pair (i, j) is swapped by the owner of its smaller index only
+  {
+    int shift = LOG2_NMAX_L1 - log2n;
+    int c3 = (n + nc - 1) / nc;
+    int f3 = id * c3;
+    int l3 = (f3 + c3 > n) ? n : f3 + c3;
+    int i;
+
+    if (id < nc) {
+      for (i = f3; i < l3; i++) {
+        int j = g_bitrev[i] >> shift;
+        if (i < j) {
+          v2s tmp = data[i];
+          data[i] = data[j];
+          data[j] = tmp;
+        }
+      }
+    }
+
+    synch_barrier();
+  }
+}
+
+// L2 to L2 through L1, n <= NMAX_L1
+void fft_l1(v2s *x, v2s *y, int n, int nc)
+{
+  if (rt_core_id() == 0)
+    plp_dma_wait(plp_dma_memcpy((unsigned int) x, (unsigned int) g_data, n*sizeof(v2s), PLP_DMA_EXT2LOC));
+
+  synch_barrier();
+
+  fft_par(g_data, n, nc);
+
+  if (rt_core_id() == 0)
+    plp_dma_wait(plp_dma_memcpy((unsigned int) y, (unsigned int) g_data, n*sizeof(v2s), PLP_DMA_LOC2EXT));
+
+  synch_barrier();
+}
+
+// L2 to L2, n = n1*n2 with n1 <= n2 <= NMAX_L1
+void fft_4step(v2s *x, v2s *t, v2s *y, int n, int nc)
+{
+  int id = rt_core_id();
+  int log2n = 31 - __builtin_clz(n);
+  int n1 = 1 << (log2n / 2);
+  int n2 = n / n1;
+  int step = NMAX / n;
+  // two tiles per core out of g_data
+  int tile = 1 << (31 - __builtin_clz(NMAX_L1 / (2*get_core_num())));
+  v2s *buf[2];
+  int din[2], dout[2];
+  int pending[2];
+  int cur, blk;
+
+  buf[0] = g_data + (2*id) * tile;
+  buf[1] = g_data + (2*id+1) * tile;
+
+  // step 1: FFTs of length n1 along the columns x[n1*N2 + n2], ncols
+  // columns per block, then twiddle by W_N^(n2*k1)
+  if (id < nc) {
+    int ncols = tile / n1;
+    int nblk = n2 / ncols;
+
+    pending[0] = pending[1] = 0;
+    cur = 0;
+    if (id < nblk)
+      din[0] = plp_dma_memcpy_2d((unsigned int) (x + id*ncols), (unsigned int) buf[0], n1*ncols*sizeof(v2s),
+                                 n2*sizeof(v2s), ncols*sizeof(v2s), PLP_DMA_EXT2LOC);
+
+    for (blk = id; blk < nblk; blk += nc) {
+      int c;
+
+      plp_dma_wait(din[cur]);
+      if (blk + nc < nblk) {
+        if (pending[cur^1]) {
+          plp_dma_wait(dout[cur^1]);
+          pending[cur^1] = 0;
+        }
+        din[cur^1] = plp_dma_memcpy_2d((unsigned int) (x + (blk+nc)*ncols), (unsigned int) buf[cur^1], n1*ncols*sizeof(v2s),
+                                       n2*sizeof(v2s), ncols*sizeof(v2s), PLP_DMA_EXT2LOC);
+      }
+
+      for (c = 0; c < ncols; c++) {
+        v2s *col = buf[cur] + c;
+        int e = (blk*ncols + c) * step;
+        int idx = 0;
+        int k1;
+
+        fft_seq(col, n1, ncols);
+
+        for (k1 = 1; k1 < n1; k1++) {
+          short wr, wi;
+          idx += e;
+          cossin(idx, &wr, &wi);
+          col[k1*ncols] = __CPLXMULS(col[k1*ncols], __PACK2(wr, -wi));
+        }
+      }
+
+      dout[cur] = plp_dma_memcpy_2d((unsigned int) (t + blk*ncols), (unsigned int) buf[cur], n1*ncols*sizeof(v2s),
+                                    n2*sizeof(v2s), ncols*sizeof(v2s), PLP_DMA_LOC2EXT);
+      pending[cur] = 1;
+      cur ^= 1;
+    }
+
+    if (pending[0]) plp_dma_wait(dout[0]);
+    if (pending[1]) plp_dma_wait(dout[1]);
+  }
+
+  synch_barrier();
+
+  // step 2: FFTs of length n2 along the rows t[k1*N2 + n2], nrows rows
+  // per block, transposed into the second tile so that y[k1 + N1*k2]
+  // goes out as lines of nrows consecutive samples. Not double buffered:
+  // on 16 cores a tile (NMAX_L1/32) holds a single row of n2 = 128 for
+  // N = NMAX, so the next load is only issued once the input is free
+  if (id < nc) {
+    int nrows = tile / n2;
+    int nblk = n1 / nrows;
+    v2s *in = buf[0];
+    v2s *out = buf[1];
+
+    pending[1] = 0;
+    if (id < nblk)
+      din[0] = plp_dma_memcpy((unsigned int) (t + id*nrows*n2), (unsigned int) in, nrows*n2*sizeof(v2s), PLP_DMA_EXT2LOC);
+
+    for (blk = id; blk < nblk; blk += nc) {
+      int r, k2;
+
+      plp_dma_wait(din[0]);
+
+      for (r = 0; r < nrows; r++)
+        fft_seq(in + r*n2, n2, 1);
+
+      if (pending[1])
+        plp_dma_wait(dout[1]);
+
+      for (k2 = 0; k2 < n2; k2++)
+        for (r = 0; r < nrows; r++)
+          out[k2*nrows + r] = in[r*n2 + k2];
+
+      // the input tile is free again, the next load overlaps the output
+      // (but not the FFTs of the next block, which wait for it)
+      if (blk + nc < nblk)
+        din[0] = plp_dma_memcpy((unsigned int) (t + (blk+nc)*nrows*n2), (unsigned int) in, nrows*n2*sizeof(v2s), PLP_DMA_EXT2LOC);
+
+      dout[1] = plp_dma_memcpy_2d((unsigned int) (y + blk*nrows), (unsigned int) out, nrows*n2*sizeof(v2s),
+                                  n1*sizeof(v2s), nrows*sizeof(v2s), PLP_DMA_LOC2EXT);
+      pending[1] = 1;
+    }
+
+    if (pending[1])
+      plp_dma_wait(dout[1]);
+  }
+
+  synch_barrier();
+}
+
+int test_fft(int n, int nc)
+{
+  int errors = 0;
+  int log2n = 31 - __builtin_clz(n);
+
+  if (rt_core_id() == 0)
+    load(n);
+
+  synch_barrier();
+
+  if (rt_core_id() == 0) {
+    reset_timer();
+    start_timer();
+  }
+
+  if (n <= NMAX_L1)
+    fft_l1(g_x_l2, g_y_l2, n, nc);
+  else
+    fft_4step(g_x_l2, g_t_l2, g_y_l2, n, nc);
+
+  if (rt_core_id() == 0) {
+    int cycles;
+
+    stop_timer();
+    cycles = get_time();
+    if (nc == 1)
+      g_cycles_1core[log2n] = cycles;
+
+    errors = check(g_y_l2, n);
+
+    #ifndef PULP_SPI
+    printf("N=%d, %s, cores=%d, errors=%d, time=%d, speedup x100=%d\n", n, n <= NMAX_L1 ? "L1" : "four-step",
+           nc, errors, cycles, (g_cycles_1core[log2n] * 100) / cycles);
+    #endif
+  }
+
+  synch_barrier();
+
+  return errors;
+}
+
+void load(int n)
+{
+  int step = NMAX / n;
+  int i;
+
+  for (i = 0; i < n; i++) {
+    short c1, s1, c2, s2;
+    cossin(F1(n)*i*step, &c1, &s1);
+    cossin(F2(n)*i*step, &c2, &s2);
+    g_x_l2[i] = __PACK2((A1*c1 + A2*c2) >> 15, (A1*s1 + A2*s2) >> 15);
+  }
+}
+
+int check(v2s *y, int n)
+{
+  int errors = 0;
+  int k;
+
+  for (k = 0; k < n; k++) {
+    int re = (k == F1(n) ? A1 : 0) + (k == F2(n) ? A2 : 0);
+    int dr = y[k][0] - re;
+    int di = y[k][1];
+    if (dr > TOL || dr < -TOL || di > TOL || di < -TOL)
+      errors++;
+  }
+
+  return errors;
+}
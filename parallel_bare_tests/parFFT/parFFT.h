@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#ifndef _PARFFT_H
+#define _PARFFT_H
+
+// uncomment if doing test with SPI (disables printf's)
+// #define PULP_SPI
+
+// largest transform, held in L2
+#define NMAX          16384
+#define LOG2_NMAX     14
+
+// largest transform computed in place in L1, larger ones use the
+// four-step decomposition with DMA streaming from L2
+#define NMAX_L1       4096
+#define LOG2_NMAX_L1  12
+
+// smallest length of the benchmark
+#define NMIN          256
+
+// two tones: x[n] = A1*exp(2*pi*i*F1*n/N) + A2*exp(2*pi*i*F2*n/N), the
+// scaled transform is A1 at bin F1, A2 at bin F2 and 0 elsewhere
+#define A1            4096
+#define A2            (-2048)
+#define F1(n)         3
+#define F2(n)         ((n)/2 - 5)
+
+// allowed error per component, in LSB
+#define TOL           4
+
+void fft_init();
+void fft_seq(v2s *data, int n, int stride);
+void fft_par(v2s *data, int n, int nc);
+void fft_l1(v2s *x, v2s *y, int n, int nc);
+void fft_4step(v2s *x, v2s *t, v2s *y, int n, int nc);
+
+int test_fft(int n, int nc);
+void load(int n);
+int check(v2s *y, int n);
+
+#endif
@@ -0,0 +1,538 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+
+/* Quarter wave of cos(2*pi*k/NMAX), k = 0..NMAX/4, Q15: round(32768*x)
+   saturated to 32767. */
+
+short cos_q15_l2[NMAX/4+1] = {
+   32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+   32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+   32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+   32767,  32766,  32766,  32766,  32766,  32766,  32766,  32766,
+   32766,  32765,  32765,  32765,  32765,  32765,  32765,  32764,
+   32764,  32764,  32764,  32764,  32763,  32763,  32763,  32763,
+   32762,  32762,  32762,  32762,  32761,  32761,  32761,  32761,
+   32760,  32760,  32760,  32760,  32759,  32759,  32759,  32758,
+   32758,  32758,  32758,  32757,  32757,  32757,  32756,  32756,
+   32756,  32755,  32755,  32754,  32754,  32754,  32753,  32753,
+   32753,  32752,  32752,  32751,  32751,  32751,  32750,  32750,
+   32749,  32749,  32748,  32748,  32748,  32747,  32747,  32746,
+   32746,  32745,  32745,  32744,  32744,  32743,  32743,  32742,
+   32742,  32741,  32741,  32740,  32740,  32739,  32739,  32738,
+   32738,  32737,  32737,  32736,  32736,  32735,  32734,  32734,
+   32733,  32733,  32732,  32732,  32731,  32730,  32730,  32729,
+   32729,  32728,  32727,  32727,  32726,  32725,  32725,  32724,
+   32723,  32723,  32722,  32721,  32721,  32720,  32719,  32719,
+   32718,  32717,  32717,  32716,  32715,  32715,  32714,  32713,
+   32712,  32712,  32711,  32710,  32709,  32709,  32708,  32707,
+   32706,  32706,  32705,  32704,  32703,  32702,  32702,  32701,
+   32700,  32699,  32698,  32698,  32697,  32696,  32695,  32694,
+   32693,  32693,  32692,  32691,  32690,  32689,  32688,  32687,
+   32686,  32686,  32685,  32684,  32683,  32682,  32681,  32680,
+   32679,  32678,  32677,  32676,  32675,  32675,  32674,  32673,
+   32672,  32671,  32670,  32669,  32668,  32667,  32666,  32665,
+   32664,  32663,  32662,  32661,  32660,  32659,  32658,  32657,
+   32656,  32655,  32654,  32653,  32651,  32650,  32649,  32648,
+   32647,  32646,  32645,  32644,  32643,  32642,  32641,  32640,
+   32638,  32637,  32636,  32635,  32634,  32633,  32632,  32630,
+   32629,  32628,  32627,  32626,  32625,  32623,  32622,  32621,
+   32620,  32619,  32618,  32616,  32615,  32614,  32613,  32611,
+   32610,  32609,  32608,  32606,  32605,  32604,  32603,  32601,
+   32600,  32599,  32598,  32596,  32595,  32594,  32592,  32591,
+   32590,  32589,  32587,  32586,  32585,  32583,  32582,  32581,
+   32579,  32578,  32577,  32575,  32574,  32572,  32571,  32570,
+   32568,  32567,  32566,  32564,  32563,  32561,  32560,  32559,
+   32557,  32556,  32554,  32553,  32551,  32550,  32548,  32547,
+   32546,  32544,  32543,  32541,  32540,  32538,  32537,  32535,
+   32534,  32532,  32531,  32529,  32528,  32526,  32525,  32523,
+   32522,  32520,  32518,  32517,  32515,  32514,  32512,  32511,
+   32509,  32508,  32506,  32504,  32503,  32501,  32500,  32498,
+   32496,  32495,  32493,  32491,  32490,  32488,  32487,  32485,
+   32483,  32482,  32480,  32478,  32477,  32475,  32473,  32472,
+   32470,  32468,  32467,  32465,  32463,  32461,  32460,  32458,
+   32456,  32454,  32453,  32451,  32449,  32448,  32446,  32444,
+   32442,  32440,  32439,  32437,  32435,  32433,  32432,  32430,
+   32428,  32426,  32424,  32422,  32421,  32419,  32417,  32415,
+   32413,  32411,  32410,  32408,  32406,  32404,  32402,  32400,
+   32398,  32397,  32395,  32393,  32391,  32389,  32387,  32385,
+   32383,  32381,  32379,  32377,  32376,  32374,  32372,  32370,
+   32368,  32366,  32364,  32362,  32360,  32358,  32356,  32354,
+   32352,  32350,  32348,  32346,  32344,  32342,  32340,  32338,
+   32336,  32334,  32332,  32330,  32328,  32326,  32323,  32321,
+   32319,  32317,  32315,  32313,  32311,  32309,  32307,  32305,
+   32303,  32301,  32298,  32296,  32294,  32292,  32290,  32288,
+   32286,  32283,  32281,  32279,  32277,  32275,  32273,  32270,
+   32268,  32266,  32264,  32262,  32259,  32257,  32255,  32253,
+   32251,  32248,  32246,  32244,  32242,  32239,  32237,  32235,
+   32233,  32230,  32228,  32226,  32224,  32221,  32219,  32217,
+   32214,  32212,  32210,  32207,  32205,  32203,  32201,  32198,
+   32196,  32194,  32191,  32189,  32186,  32184,  32182,  32179,
+   32177,  32175,  32172,  32170,  32167,  32165,  32163,  32160,
+   32158,  32155,  32153,  32151,  32148,  32146,  32143,  32141,
+   32138,  32136,  32133,  32131,  32129,  32126,  32124,  32121,
+   32119,  32116,  32114,  32111,  32109,  32106,  32104,  32101,
+   32099,  32096,  32093,  32091,  32088,  32086,  32083,  32081,
+   32078,  32076,  32073,  32070,  32068,  32065,  32063,  32060,
+   32058,  32055,  32052,  32050,  32047,  32044,  32042,  32039,
+   32037,  32034,  32031,  32029,  32026,  32023,  32021,  32018,
+   32015,  32013,  32010,  32007,  32005,  32002,  31999,  31996,
+   31994,  31991,  31988,  31986,  31983,  31980,  31977,  31975,
+   31972,  31969,  31966,  31964,  31961,  31958,  31955,  31952,
+   31950,  31947,  31944,  31941,  31938,  31936,  31933,  31930,
+   31927,  31924,  31921,  31919,  31916,  31913,  31910,  31907,
+   31904,  31902,  31899,  31896,  31893,  31890,  31887,  31884,
+   31881,  31878,  31875,  31873,  31870,  31867,  31864,  31861,
+   31858,  31855,  31852,  31849,  31846,  31843,  31840,  31837,
+   31834,  31831,  31828,  31825,  31822,  31819,  31816,  31813,
+   31810,  31807,  31804,  31801,  31798,  31795,  31792,  31789,
+   31786,  31783,  31780,  31777,  31774,  31771,  31768,  31764,
+   31761,  31758,  31755,  31752,  31749,  31746,  31743,  31740,
+   31737,  31733,  31730,  31727,  31724,  31721,  31718,  31715,
+   31711,  31708,  31705,  31702,  31699,  31695,  31692,  31689,
+   31686,  31683,  31679,  31676,  31673,  31670,  31667,  31663,
+   31660,  31657,  31654,  31650,  31647,  31644,  31641,  31637,
+   31634,  31631,  31627,  31624,  31621,  31618,  31614,  31611,
+   31608,  31604,  31601,  31598,  31594,  31591,  31588,  31584,
+   31581,  31578,  31574,  31571,  31568,  31564,  31561,  31557,
+   31554,  31551,  31547,  31544,  31540,  31537,  31534,  31530,
+   31527,  31523,  31520,  31516,  31513,  31510,  31506,  31503,
+   31499,  31496,  31492,  31489,  31485,  31482,  31478,  31475,
+   31471,  31468,  31464,  31461,  31457,  31454,  31450,  31447,
+   31443,  31440,  31436,  31433,  31429,  31425,  31422,  31418,
+   31415,  31411,  31408,  31404,  31400,  31397,  31393,  31390,
+   31386,  31382,  31379,  31375,  31372,  31368,  31364,  31361,
+   31357,  31353,  31350,  31346,  31342,  31339,  31335,  31331,
+   31328,  31324,  31320,  31317,  31313,  31309,  31305,  31302,
+   31298,  31294,  31291,  31287,  31283,  31279,  31276,  31272,
+   31268,  31264,  31261,  31257,  31253,  31249,  31246,  31242,
+   31238,  31234,  31230,  31227,  31223,  31219,  31215,  31211,
+   31207,  31204,  31200,  31196,  31192,  31188,  31184,  31180,
+   31177,  31173,  31169,  31165,  31161,  31157,  31153,  31149,
+   31146,  31142,  31138,  31134,  31130,  31126,  31122,  31118,
+   31114,  31110,  31106,  31102,  31098,  31094,  31090,  31086,
+   31082,  31078,  31074,  31071,  31067,  31063,  31059,  31054,
+   31050,  31046,  31042,  31038,  31034,  31030,  31026,  31022,
+   31018,  31014,  31010,  31006,  31002,  30998,  30994,  30990,
+   30986,  30982,  30977,  30973,  30969,  30965,  30961,  30957,
+   30953,  30949,  30945,  30940,  30936,  30932,  30928,  30924,
+   30920,  30916,  30911,  30907,  30903,  30899,  30895,  30890,
+   30886,  30882,  30878,  30874,  30869,  30865,  30861,  30857,
+   30853,  30848,  30844,  30840,  30836,  30831,  30827,  30823,
+   30819,  30814,  30810,  30806,  30801,  30797,  30793,  30789,
+   30784,  30780,  30776,  30771,  30767,  30763,  30758,  30754,
+   30750,  30745,  30741,  30737,  30732,  30728,  30723,  30719,
+   30715,  30710,  30706,  30702,  30697,  30693,  30688,  30684,
+   30680,  30675,  30671,  30666,  30662,  30657,  30653,  30649,
+   30644,  30640,  30635,  30631,  30626,  30622,  30617,  30613,
+   30608,  30604,  30599,  30595,  30590,  30586,  30581,  30577,
+   30572,  30568,  30563,  30559,  30554,  30550,  30545,  30541,
+   30536,  30531,  30527,  30522,  30518,  30513,  30509,  30504,
+   30499,  30495,  30490,  30486,  30481,  30476,  30472,  30467,
+   30462,  30458,  30453,  30449,  30444,  30439,  30435,  30430,
+   30425,  30421,  30416,  30411,  30407,  30402,  30397,  30393,
+   30388,  30383,  30378,  30374,  30369,  30364,  30360,  30355,
+   30350,  30345,  30341,  30336,  30331,  30326,  30322,  30317,
+   30312,  30307,  30302,  30298,  30293,  30288,  30283,  30278,
+   30274,  30269,  30264,  30259,  30254,  30250,  30245,  30240,
+   30235,  30230,  30225,  30221,  30216,  30211,  30206,  30201,
+   30196,  30191,  30186,  30182,  30177,  30172,  30167,  30162,
+   30157,  30152,  30147,  30142,  30137,  30132,  30127,  30122,
+   30118,  30113,  30108,  30103,  30098,  30093,  30088,  30083,
+   30078,  30073,  30068,  30063,  30058,  30053,  30048,  30043,
+   30038,  30033,  30028,  30023,  30018,  30013,  30008,  30002,
+   29997,  29992,  29987,  29982,  29977,  29972,  29967,  29962,
+   29957,  29952,  29947,  29942,  29936,  29931,  29926,  29921,
+   29916,  29911,  29906,  29901,  29895,  29890,  29885,  29880,
+   29875,  29870,  29864,  29859,  29854,  29849,  29844,  29839,
+   29833,  29828,  29823,  29818,  29813,  29807,  29802,  29797,
+   29792,  29786,  29781,  29776,  29771,  29765,  29760,  29755,
+   29750,  29744,  29739,  29734,  29729,  29723,  29718,  29713,
+   29707,  29702,  29697,  29691,  29686,  29681,  29675,  29670,
+   29665,  29659,  29654,  29649,  29643,  29638,  29633,  29627,
+   29622,  29617,  29611,  29606,  29600,  29595,  29590,  29584,
+   29579,  29573,  29568,  29563,  29557,  29552,  29546,  29541,
+   29535,  29530,  29525,  29519,  29514,  29508,  29503,  29497,
+   29492,  29486,  29481,  29475,  29470,  29464,  29459,  29453,
+   29448,  29442,  29437,  29431,  29426,  29420,  29415,  29409,
+   29404,  29398,  29392,  29387,  29381,  29376,  29370,  29365,
+   29359,  29353,  29348,  29342,  29337,  29331,  29325,  29320,
+   29314,  29309,  29303,  29297,  29292,  29286,  29280,  29275,
+   29269,  29264,  29258,  29252,  29247,  29241,  29235,  29230,
+   29224,  29218,  29212,  29207,  29201,  29195,  29190,  29184,
+   29178,  29173,  29167,  29161,  29155,  29150,  29144,  29138,
+   29132,  29127,  29121,  29115,  29109,  29104,  29098,  29092,
+   29086,  29080,  29075,  29069,  29063,  29057,  29051,  29046,
+   29040,  29034,  29028,  29022,  29016,  29011,  29005,  28999,
+   28993,  28987,  28981,  28975,  28970,  28964,  28958,  28952,
+   28946,  28940,  28934,  28928,  28922,  28917,  28911,  28905,
+   28899,  28893,  28887,  28881,  28875,  28869,  28863,  28857,
+   28851,  28845,  28839,  28833,  28827,  28821,  28815,  28809,
+   28803,  28797,  28791,  28785,  28779,  28773,  28767,  28761,
+   28755,  28749,  28743,  28737,  28731,  28725,  28719,  28713,
+   28707,  28701,  28695,  28689,  28683,  28677,  28671,  28665,
+   28658,  28652,  28646,  28640,  28634,  28628,  28622,  28616,
+   28610,  28603,  28597,  28591,  28585,  28579,  28573,  28567,
+   28560,  28554,  28548,  28542,  28536,  28530,  28523,  28517,
+   28511,  28505,  28499,  28492,  28486,  28480,  28474,  28468,
+   28461,  28455,  28449,  28443,  28436,  28430,  28424,  28418,
+   28411,  28405,  28399,  28393,  28386,  28380,  28374,  28367,
+   28361,  28355,  28349,  28342,  28336,  28330,  28323,  28317,
+   28311,  28304,  28298,  28292,  28285,  28279,  28273,  28266,
+   28260,  28254,  28247,  28241,  28234,  28228,  28222,  28215,
+   28209,  28202,  28196,  28190,  28183,  28177,  28170,  28164,
+   28158,  28151,  28145,  28138,  28132,  28125,  28119,  28113,
+   28106,  28100,  28093,  28087,  28080,  28074,  28067,  28061,
+   28054,  28048,  28041,  28035,  28028,  28022,  28015,  28009,
+   28002,  27996,  27989,  27983,  27976,  27969,  27963,  27956,
+   27950,  27943,  27937,  27930,  27924,  27917,  27910,  27904,
+   27897,  27891,  27884,  27877,  27871,  27864,  27858,  27851,
+   27844,  27838,  27831,  27824,  27818,  27811,  27805,  27798,
+   27791,  27785,  27778,  27771,  27765,  27758,  27751,  27745,
+   27738,  27731,  27724,  27718,  27711,  27704,  27698,  27691,
+   27684,  27677,  27671,  27664,  27657,  27650,  27644,  27637,
+   27630,  27623,  27617,  27610,  27603,  27596,  27590,  27583,
+   27576,  27569,  27562,  27556,  27549,  27542,  27535,  27528,
+   27522,  27515,  27508,  27501,  27494,  27487,  27481,  27474,
+   27467,  27460,  27453,  27446,  27440,  27433,  27426,  27419,
+   27412,  27405,  27398,  27391,  27384,  27378,  27371,  27364,
+   27357,  27350,  27343,  27336,  27329,  27322,  27315,  27308,
+   27301,  27294,  27287,  27280,  27273,  27267,  27260,  27253,
+   27246,  27239,  27232,  27225,  27218,  27211,  27204,  27197,
+   27190,  27183,  27176,  27169,  27162,  27154,  27147,  27140,
+   27133,  27126,  27119,  27112,  27105,  27098,  27091,  27084,
+   27077,  27070,  27063,  27056,  27049,  27041,  27034,  27027,
+   27020,  27013,  27006,  26999,  26992,  26985,  26977,  26970,
+   26963,  26956,  26949,  26942,  26935,  26927,  26920,  26913,
+   26906,  26899,  26892,  26884,  26877,  26870,  26863,  26856,
+   26848,  26841,  26834,  26827,  26820,  26812,  26805,  26798,
+   26791,  26783,  26776,  26769,  26762,  26754,  26747,  26740,
+   26733,  26725,  26718,  26711,  26704,  26696,  26689,  26682,
+   26674,  26667,  26660,  26652,  26645,  26638,  26630,  26623,
+   26616,  26608,  26601,  26594,  26586,  26579,  26572,  26564,
+   26557,  26550,  26542,  26535,  26528,  26520,  26513,  26505,
+   26498,  26491,  26483,  26476,  26468,  26461,  26454,  26446,
+   26439,  26431,  26424,  26416,  26409,  26402,  26394,  26387,
+   26379,  26372,  26364,  26357,  26349,  26342,  26334,  26327,
+   26320,  26312,  26305,  26297,  26290,  26282,  26275,  26267,
+   26259,  26252,  26244,  26237,  26229,  26222,  26214,  26207,
+   26199,  26192,  26184,  26177,  26169,  26161,  26154,  26146,
+   26139,  26131,  26124,  26116,  26108,  26101,  26093,  26086,
+   26078,  26070,  26063,  26055,  26048,  26040,  26032,  26025,
+   26017,  26009,  26002,  25994,  25986,  25979,  25971,  25963,
+   25956,  25948,  25940,  25933,  25925,  25917,  25910,  25902,
+   25894,  25887,  25879,  25871,  25863,  25856,  25848,  25840,
+   25833,  25825,  25817,  25809,  25802,  25794,  25786,  25778,
+   25771,  25763,  25755,  25747,  25739,  25732,  25724,  25716,
+   25708,  25701,  25693,  25685,  25677,  25669,  25662,  25654,
+   25646,  25638,  25630,  25622,  25615,  25607,  25599,  25591,
+   25583,  25575,  25567,  25560,  25552,  25544,  25536,  25528,
+   25520,  25512,  25504,  25497,  25489,  25481,  25473,  25465,
+   25457,  25449,  25441,  25433,  25425,  25417,  25410,  25402,
+   25394,  25386,  25378,  25370,  25362,  25354,  25346,  25338,
+   25330,  25322,  25314,  25306,  25298,  25290,  25282,  25274,
+   25266,  25258,  25250,  25242,  25234,  25226,  25218,  25210,
+   25202,  25194,  25186,  25178,  25170,  25162,  25154,  25146,
+   25138,  25130,  25121,  25113,  25105,  25097,  25089,  25081,
+   25073,  25065,  25057,  25049,  25041,  25033,  25024,  25016,
+   25008,  25000,  24992,  24984,  24976,  24968,  24959,  24951,
+   24943,  24935,  24927,  24919,  24910,  24902,  24894,  24886,
+   24878,  24870,  24861,  24853,  24845,  24837,  24829,  24820,
+   24812,  24804,  24796,  24788,  24779,  24771,  24763,  24755,
+   24746,  24738,  24730,  24722,  24713,  24705,  24697,  24689,
+   24680,  24672,  24664,  24656,  24647,  24639,  24631,  24622,
+   24614,  24606,  24598,  24589,  24581,  24573,  24564,  24556,
+   24548,  24539,  24531,  24523,  24514,  24506,  24498,  24489,
+   24481,  24473,  24464,  24456,  24448,  24439,  24431,  24422,
+   24414,  24406,  24397,  24389,  24380,  24372,  24364,  24355,
+   24347,  24338,  24330,  24322,  24313,  24305,  24296,  24288,
+   24279,  24271,  24263,  24254,  24246,  24237,  24229,  24220,
+   24212,  24203,  24195,  24186,  24178,  24169,  24161,  24152,
+   24144,  24136,  24127,  24119,  24110,  24101,  24093,  24084,
+   24076,  24067,  24059,  24050,  24042,  24033,  24025,  24016,
+   24008,  23999,  23991,  23982,  23973,  23965,  23956,  23948,
+   23939,  23930,  23922,  23913,  23905,  23896,  23888,  23879,
+   23870,  23862,  23853,  23844,  23836,  23827,  23819,  23810,
+   23801,  23793,  23784,  23775,  23767,  23758,  23749,  23741,
+   23732,  23723,  23715,  23706,  23697,  23689,  23680,  23671,
+   23663,  23654,  23645,  23637,  23628,  23619,  23610,  23602,
+   23593,  23584,  23576,  23567,  23558,  23549,  23541,  23532,
+   23523,  23514,  23506,  23497,  23488,  23479,  23471,  23462,
+   23453,  23444,  23436,  23427,  23418,  23409,  23400,  23392,
+   23383,  23374,  23365,  23356,  23348,  23339,  23330,  23321,
+   23312,  23303,  23295,  23286,  23277,  23268,  23259,  23250,
+   23241,  23233,  23224,  23215,  23206,  23197,  23188,  23179,
+   23170,  23162,  23153,  23144,  23135,  23126,  23117,  23108,
+   23099,  23090,  23081,  23073,  23064,  23055,  23046,  23037,
+   23028,  23019,  23010,  23001,  22992,  22983,  22974,  22965,
+   22956,  22947,  22938,  22929,  22920,  22911,  22902,  22893,
+   22884,  22875,  22866,  22857,  22848,  22839,  22830,  22821,
+   22812,  22803,  22794,  22785,  22776,  22767,  22758,  22749,
+   22740,  22731,  22722,  22713,  22704,  22695,  22686,  22677,
+   22668,  22658,  22649,  22640,  22631,  22622,  22613,  22604,
+   22595,  22586,  22577,  22568,  22558,  22549,  22540,  22531,
+   22522,  22513,  22504,  22495,  22485,  22476,  22467,  22458,
+   22449,  22440,  22431,  22421,  22412,  22403,  22394,  22385,
+   22375,  22366,  22357,  22348,  22339,  22330,  22320,  22311,
+   22302,  22293,  22284,  22274,  22265,  22256,  22247,  22237,
+   22228,  22219,  22210,  22200,  22191,  22182,  22173,  22163,
+   22154,  22145,  22136,  22126,  22117,  22108,  22099,  22089,
+   22080,  22071,  22061,  22052,  22043,  22034,  22024,  22015,
+   22006,  21996,  21987,  21978,  21968,  21959,  21950,  21940,
+   21931,  21922,  21912,  21903,  21894,  21884,  21875,  21866,
+   21856,  21847,  21838,  21828,  21819,  21809,  21800,  21791,
+   21781,  21772,  21762,  21753,  21744,  21734,  21725,  21715,
+   21706,  21697,  21687,  21678,  21668,  21659,  21649,  21640,
+   21631,  21621,  21612,  21602,  21593,  21583,  21574,  21564,
+   21555,  21546,  21536,  21527,  21517,  21508,  21498,  21489,
+   21479,  21470,  21460,  21451,  21441,  21432,  21422,  21413,
+   21403,  21394,  21384,  21375,  21365,  21356,  21346,  21336,
+   21327,  21317,  21308,  21298,  21289,  21279,  21270,  21260,
+   21251,  21241,  21231,  21222,  21212,  21203,  21193,  21183,
+   21174,  21164,  21155,  21145,  21136,  21126,  21116,  21107,
+   21097,  21087,  21078,  21068,  21059,  21049,  21039,  21030,
+   21020,  21010,  21001,  20991,  20981,  20972,  20962,  20952,
+   20943,  20933,  20923,  20914,  20904,  20894,  20885,  20875,
+   20865,  20856,  20846,  20836,  20827,  20817,  20807,  20798,
+   20788,  20778,  20768,  20759,  20749,  20739,  20729,  20720,
+   20710,  20700,  20691,  20681,  20671,  20661,  20652,  20642,
+   20632,  20622,  20612,  20603,  20593,  20583,  20573,  20564,
+   20554,  20544,  20534,  20524,  20515,  20505,  20495,  20485,
+   20475,  20466,  20456,  20446,  20436,  20426,  20416,  20407,
+   20397,  20387,  20377,  20367,  20357,  20348,  20338,  20328,
+   20318,  20308,  20298,  20288,  20279,  20269,  20259,  20249,
+   20239,  20229,  20219,  20209,  20200,  20190,  20180,  20170,
+   20160,  20150,  20140,  20130,  20120,  20110,  20100,  20090,
+   20081,  20071,  20061,  20051,  20041,  20031,  20021,  20011,
+   20001,  19991,  19981,  19971,  19961,  19951,  19941,  19931,
+   19921,  19911,  19901,  19891,  19881,  19871,  19861,  19851,
+   19841,  19831,  19821,  19811,  19801,  19791,  19781,  19771,
+   19761,  19751,  19741,  19731,  19721,  19711,  19701,  19691,
+   19681,  19671,  19661,  19651,  19641,  19631,  19621,  19611,
+   19601,  19590,  19580,  19570,  19560,  19550,  19540,  19530,
+   19520,  19510,  19500,  19490,  19479,  19469,  19459,  19449,
+   19439,  19429,  19419,  19409,  19399,  19388,  19378,  19368,
+   19358,  19348,  19338,  19328,  19317,  19307,  19297,  19287,
+   19277,  19267,  19256,  19246,  19236,  19226,  19216,  19206,
+   19195,  19185,  19175,  19165,  19155,  19144,  19134,  19124,
+   19114,  19104,  19093,  19083,  19073,  19063,  19053,  19042,
+   19032,  19022,  19012,  19001,  18991,  18981,  18971,  18960,
+   18950,  18940,  18930,  18919,  18909,  18899,  18889,  18878,
+   18868,  18858,  18848,  18837,  18827,  18817,  18806,  18796,
+   18786,  18776,  18765,  18755,  18745,  18734,  18724,  18714,
+   18703,  18693,  18683,  18672,  18662,  18652,  18641,  18631,
+   18621,  18610,  18600,  18590,  18579,  18569,  18559,  18548,
+   18538,  18528,  18517,  18507,  18496,  18486,  18476,  18465,
+   18455,  18445,  18434,  18424,  18413,  18403,  18393,  18382,
+   18372,  18361,  18351,  18341,  18330,  18320,  18309,  18299,
+   18288,  18278,  18268,  18257,  18247,  18236,  18226,  18215,
+   18205,  18194,  18184,  18174,  18163,  18153,  18142,  18132,
+   18121,  18111,  18100,  18090,  18079,  18069,  18058,  18048,
+   18037,  18027,  18016,  18006,  17995,  17985,  17974,  17964,
+   17953,  17943,  17932,  17922,  17911,  17901,  17890,  17880,
+   17869,  17859,  17848,  17838,  17827,  17817,  17806,  17795,
+   17785,  17774,  17764,  17753,  17743,  17732,  17721,  17711,
+   17700,  17690,  17679,  17669,  17658,  17647,  17637,  17626,
+   17616,  17605,  17594,  17584,  17573,  17563,  17552,  17541,
+   17531,  17520,  17510,  17499,  17488,  17478,  17467,  17456,
+   17446,  17435,  17425,  17414,  17403,  17393,  17382,  17371,
+   17361,  17350,  17339,  17329,  17318,  17307,  17297,  17286,
+   17275,  17265,  17254,  17243,  17233,  17222,  17211,  17200,
+   17190,  17179,  17168,  17158,  17147,  17136,  17126,  17115,
+   17104,  17093,  17083,  17072,  17061,  17050,  17040,  17029,
+   17018,  17008,  16997,  16986,  16975,  16965,  16954,  16943,
+   16932,  16922,  16911,  16900,  16889,  16878,  16868,  16857,
+   16846,  16835,  16825,  16814,  16803,  16792,  16781,  16771,
+   16760,  16749,  16738,  16727,  16717,  16706,  16695,  16684,
+   16673,  16663,  16652,  16641,  16630,  16619,  16608,  16598,
+   16587,  16576,  16565,  16554,  16543,  16533,  16522,  16511,
+   16500,  16489,  16478,  16467,  16456,  16446,  16435,  16424,
+   16413,  16402,  16391,  16380,  16369,  16359,  16348,  16337,
+   16326,  16315,  16304,  16293,  16282,  16271,  16261,  16250,
+   16239,  16228,  16217,  16206,  16195,  16184,  16173,  16162,
+   16151,  16140,  16129,  16118,  16108,  16097,  16086,  16075,
+   16064,  16053,  16042,  16031,  16020,  16009,  15998,  15987,
+   15976,  15965,  15954,  15943,  15932,  15921,  15910,  15899,
+   15888,  15877,  15866,  15855,  15844,  15833,  15822,  15811,
+   15800,  15789,  15778,  15767,  15756,  15745,  15734,  15723,
+   15712,  15701,  15690,  15679,  15668,  15657,  15646,  15635,
+   15624,  15613,  15602,  15591,  15580,  15568,  15557,  15546,
+   15535,  15524,  15513,  15502,  15491,  15480,  15469,  15458,
+   15447,  15436,  15425,  15413,  15402,  15391,  15380,  15369,
+   15358,  15347,  15336,  15325,  15314,  15302,  15291,  15280,
+   15269,  15258,  15247,  15236,  15225,  15213,  15202,  15191,
+   15180,  15169,  15158,  15147,  15136,  15124,  15113,  15102,
+   15091,  15080,  15069,  15057,  15046,  15035,  15024,  15013,
+   15002,  14990,  14979,  14968,  14957,  14946,  14935,  14923,
+   14912,  14901,  14890,  14879,  14867,  14856,  14845,  14834,
+   14823,  14811,  14800,  14789,  14778,  14767,  14755,  14744,
+   14733,  14722,  14710,  14699,  14688,  14677,  14665,  14654,
+   14643,  14632,  14621,  14609,  14598,  14587,  14576,  14564,
+   14553,  14542,  14530,  14519,  14508,  14497,  14485,  14474,
+   14463,  14452,  14440,  14429,  14418,  14406,  14395,  14384,
+   14373,  14361,  14350,  14339,  14327,  14316,  14305,  14293,
+   14282,  14271,  14260,  14248,  14237,  14226,  14214,  14203,
+   14192,  14180,  14169,  14158,  14146,  14135,  14124,  14112,
+   14101,  14090,  14078,  14067,  14056,  14044,  14033,  14021,
+   14010,  13999,  13987,  13976,  13965,  13953,  13942,  13931,
+   13919,  13908,  13896,  13885,  13874,  13862,  13851,  13839,
+   13828,  13817,  13805,  13794,  13783,  13771,  13760,  13748,
+   13737,  13725,  13714,  13703,  13691,  13680,  13668,  13657,
+   13646,  13634,  13623,  13611,  13600,  13588,  13577,  13566,
+   13554,  13543,  13531,  13520,  13508,  13497,  13485,  13474,
+   13463,  13451,  13440,  13428,  13417,  13405,  13394,  13382,
+   13371,  13359,  13348,  13336,  13325,  13313,  13302,  13290,
+   13279,  13267,  13256,  13244,  13233,  13221,  13210,  13198,
+   13187,  13175,  13164,  13152,  13141,  13129,  13118,  13106,
+   13095,  13083,  13072,  13060,  13049,  13037,  13026,  13014,
+   13003,  12991,  12980,  12968,  12957,  12945,  12933,  12922,
+   12910,  12899,  12887,  12876,  12864,  12853,  12841,  12829,
+   12818,  12806,  12795,  12783,  12772,  12760,  12748,  12737,
+   12725,  12714,  12702,  12691,  12679,  12667,  12656,  12644,
+   12633,  12621,  12609,  12598,  12586,  12575,  12563,  12551,
+   12540,  12528,  12517,  12505,  12493,  12482,  12470,  12458,
+   12447,  12435,  12424,  12412,  12400,  12389,  12377,  12365,
+   12354,  12342,  12330,  12319,  12307,  12296,  12284,  12272,
+   12261,  12249,  12237,  12226,  12214,  12202,  12191,  12179,
+   12167,  12156,  12144,  12132,  12121,  12109,  12097,  12086,
+   12074,  12062,  12051,  12039,  12027,  12015,  12004,  11992,
+   11980,  11969,  11957,  11945,  11934,  11922,  11910,  11898,
+   11887,  11875,  11863,  11852,  11840,  11828,  11816,  11805,
+   11793,  11781,  11770,  11758,  11746,  11734,  11723,  11711,
+   11699,  11687,  11676,  11664,  11652,  11640,  11629,  11617,
+   11605,  11593,  11582,  11570,  11558,  11546,  11535,  11523,
+   11511,  11499,  11488,  11476,  11464,  11452,  11441,  11429,
+   11417,  11405,  11393,  11382,  11370,  11358,  11346,  11334,
+   11323,  11311,  11299,  11287,  11276,  11264,  11252,  11240,
+   11228,  11216,  11205,  11193,  11181,  11169,  11157,  11146,
+   11134,  11122,  11110,  11098,  11087,  11075,  11063,  11051,
+   11039,  11027,  11016,  11004,  10992,  10980,  10968,  10956,
+   10945,  10933,  10921,  10909,  10897,  10885,  10873,  10862,
+   10850,  10838,  10826,  10814,  10802,  10790,  10779,  10767,
+   10755,  10743,  10731,  10719,  10707,  10695,  10684,  10672,
+   10660,  10648,  10636,  10624,  10612,  10600,  10588,  10577,
+   10565,  10553,  10541,  10529,  10517,  10505,  10493,  10481,
+   10469,  10458,  10446,  10434,  10422,  10410,  10398,  10386,
+   10374,  10362,  10350,  10338,  10326,  10315,  10303,  10291,
+   10279,  10267,  10255,  10243,  10231,  10219,  10207,  10195,
+   10183,  10171,  10159,  10147,  10135,  10123,  10112,  10100,
+   10088,  10076,  10064,  10052,  10040,  10028,  10016,  10004,
+    9992,   9980,   9968,   9956,   9944,   9932,   9920,   9908,
+    9896,   9884,   9872,   9860,   9848,   9836,   9824,   9812,
+    9800,   9788,   9776,   9764,   9752,   9740,   9728,   9716,
+    9704,   9692,   9680,   9668,   9656,   9644,   9632,   9620,
+    9608,   9596,   9584,   9572,   9560,   9548,   9536,   9524,
+    9512,   9500,   9488,   9476,   9464,   9452,   9440,   9428,
+    9416,   9404,   9392,   9380,   9368,   9356,   9344,   9332,
+    9319,   9307,   9295,   9283,   9271,   9259,   9247,   9235,
+    9223,   9211,   9199,   9187,   9175,   9163,   9151,   9139,
+    9127,   9114,   9102,   9090,   9078,   9066,   9054,   9042,
+    9030,   9018,   9006,   8994,   8982,   8970,   8957,   8945,
+    8933,   8921,   8909,   8897,   8885,   8873,   8861,   8849,
+    8836,   8824,   8812,   8800,   8788,   8776,   8764,   8752,
+    8740,   8728,   8715,   8703,   8691,   8679,   8667,   8655,
+    8643,   8631,   8618,   8606,   8594,   8582,   8570,   8558,
+    8546,   8534,   8521,   8509,   8497,   8485,   8473,   8461,
+    8449,   8436,   8424,   8412,   8400,   8388,   8376,   8364,
+    8351,   8339,   8327,   8315,   8303,   8291,   8279,   8266,
+    8254,   8242,   8230,   8218,   8206,   8193,   8181,   8169,
+    8157,   8145,   8133,   8120,   8108,   8096,   8084,   8072,
+    8059,   8047,   8035,   8023,   8011,   7999,   7986,   7974,
+    7962,   7950,   7938,   7925,   7913,   7901,   7889,   7877,
+    7864,   7852,   7840,   7828,   7816,   7803,   7791,   7779,
+    7767,   7755,   7742,   7730,   7718,   7706,   7694,   7681,
+    7669,   7657,   7645,   7632,   7620,   7608,   7596,   7584,
+    7571,   7559,   7547,   7535,   7522,   7510,   7498,   7486,
+    7473,   7461,   7449,   7437,   7425,   7412,   7400,   7388,
+    7376,   7363,   7351,   7339,   7327,   7314,   7302,   7290,
+    7278,   7265,   7253,   7241,   7229,   7216,   7204,   7192,
+    7180,   7167,   7155,   7143,   7130,   7118,   7106,   7094,
+    7081,   7069,   7057,   7045,   7032,   7020,   7008,   6995,
+    6983,   6971,   6959,   6946,   6934,   6922,   6910,   6897,
+    6885,   6873,   6860,   6848,   6836,   6824,   6811,   6799,
+    6787,   6774,   6762,   6750,   6737,   6725,   6713,   6701,
+    6688,   6676,   6664,   6651,   6639,   6627,   6614,   6602,
+    6590,   6577,   6565,   6553,   6541,   6528,   6516,   6504,
+    6491,   6479,   6467,   6454,   6442,   6430,   6417,   6405,
+    6393,   6380,   6368,   6356,   6343,   6331,   6319,   6306,
+    6294,   6282,   6269,   6257,   6245,   6232,   6220,   6208,
+    6195,   6183,   6171,   6158,   6146,   6134,   6121,   6109,
+    6097,   6084,   6072,   6060,   6047,   6035,   6023,   6010,
+    5998,   5985,   5973,   5961,   5948,   5936,   5924,   5911,
+    5899,   5887,   5874,   5862,   5850,   5837,   5825,   5812,
+    5800,   5788,   5775,   5763,   5751,   5738,   5726,   5713,
+    5701,   5689,   5676,   5664,   5652,   5639,   5627,   5614,
+    5602,   5590,   5577,   5565,   5553,   5540,   5528,   5515,
+    5503,   5491,   5478,   5466,   5453,   5441,   5429,   5416,
+    5404,   5391,   5379,   5367,   5354,   5342,   5329,   5317,
+    5305,   5292,   5280,   5267,   5255,   5243,   5230,   5218,
+    5205,   5193,   5181,   5168,   5156,   5143,   5131,   5119,
+    5106,   5094,   5081,   5069,   5057,   5044,   5032,   5019,
+    5007,   4994,   4982,   4970,   4957,   4945,   4932,   4920,
+    4907,   4895,   4883,   4870,   4858,   4845,   4833,   4820,
+    4808,   4796,   4783,   4771,   4758,   4746,   4733,   4721,
+    4709,   4696,   4684,   4671,   4659,   4646,   4634,   4622,
+    4609,   4597,   4584,   4572,   4559,   4547,   4534,   4522,
+    4510,   4497,   4485,   4472,   4460,   4447,   4435,   4422,
+    4410,   4397,   4385,   4373,   4360,   4348,   4335,   4323,
+    4310,   4298,   4285,   4273,   4260,   4248,   4236,   4223,
+    4211,   4198,   4186,   4173,   4161,   4148,   4136,   4123,
+    4111,   4098,   4086,   4074,   4061,   4049,   4036,   4024,
+    4011,   3999,   3986,   3974,   3961,   3949,   3936,   3924,
+    3911,   3899,   3886,   3874,   3861,   3849,   3836,   3824,
+    3812,   3799,   3787,   3774,   3762,   3749,   3737,   3724,
+    3712,   3699,   3687,   3674,   3662,   3649,   3637,   3624,
+    3612,   3599,   3587,   3574,   3562,   3549,   3537,   3524,
+    3512,   3499,   3487,   3474,   3462,   3449,   3437,   3424,
+    3412,   3399,   3387,   3374,   3362,   3349,   3337,   3324,
+    3312,   3299,   3287,   3274,   3262,   3249,   3237,   3224,
+    3212,   3199,   3187,   3174,   3162,   3149,   3137,   3124,
+    3112,   3099,   3087,   3074,   3062,   3049,   3037,   3024,
+    3012,   2999,   2987,   2974,   2962,   2949,   2937,   2924,
+    2912,   2899,   2887,   2874,   2861,   2849,   2836,   2824,
+    2811,   2799,   2786,   2774,   2761,   2749,   2736,   2724,
+    2711,   2699,   2686,   2674,   2661,   2649,   2636,   2624,
+    2611,   2599,   2586,   2573,   2561,   2548,   2536,   2523,
+    2511,   2498,   2486,   2473,   2461,   2448,   2436,   2423,
+    2411,   2398,   2385,   2373,   2360,   2348,   2335,   2323,
+    2310,   2298,   2285,   2273,   2260,   2248,   2235,   2223,
+    2210,   2197,   2185,   2172,   2160,   2147,   2135,   2122,
+    2110,   2097,   2085,   2072,   2060,   2047,   2034,   2022,
+    2009,   1997,   1984,   1972,   1959,   1947,   1934,   1922,
+    1909,   1896,   1884,   1871,   1859,   1846,   1834,   1821,
+    1809,   1796,   1784,   1771,   1758,   1746,   1733,   1721,
+    1708,   1696,   1683,   1671,   1658,   1646,   1633,   1620,
+    1608,   1595,   1583,   1570,   1558,   1545,   1533,   1520,
+    1507,   1495,   1482,   1470,   1457,   1445,   1432,   1420,
+    1407,   1394,   1382,   1369,   1357,   1344,   1332,   1319,
+    1307,   1294,   1281,   1269,   1256,   1244,   1231,   1219,
+    1206,   1194,   1181,   1168,   1156,   1143,   1131,   1118,
+    1106,   1093,   1081,   1068,   1055,   1043,   1030,   1018,
+    1005,    993,    980,    967,    955,    942,    930,    917,
+     905,    892,    880,    867,    854,    842,    829,    817,
+     804,    792,    779,    766,    754,    741,    729,    716,
+     704,    691,    679,    666,    653,    641,    628,    616,
+     603,    591,    578,    565,    553,    540,    528,    515,
+     503,    490,    478,    465,    452,    440,    427,    415,
+     402,    390,    377,    364,    352,    339,    327,    314,
+     302,    289,    276,    264,    251,    239,    226,    214,
+     201,    188,    176,    163,    151,    138,    126,    113,
+     101,     88,     75,     63,     50,     38,     25,     13,
+       0,
+};
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/******************************************************************************
+ *                                                                            *
+ * Hamming distance matching of binary descriptors                           *
+ *                                                                            *
+ * distance = sum over the words of p.cnt(q ^ d). Queries are handled in      *
+ * pairs, so that every database word loaded from L1 serves two distances    *
+ * while the 16 query words stay in registers.                                *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <pulp.h>
+#include "parHamming.h"
+
+PLP_L1_DATA unsigned int g_chunk[2][CHUNK*DESCR_WORDS];
+
+static inline void update(match_t *m, int dist, int index)
+{
+  if (dist < m->dist) {
+    m->dist2 = m->dist;
+    m->dist = dist;
+    m->index = index;
+  } else if (dist < m->dist2) {
+    m->dist2 = dist;
+  }
+}
+
+// queries [q0, q1) against the n descriptors of d, first one at index base
+static void scan(const unsigned int *query, int q0, int q1, const unsigned int *d, int n,
+                 int base, match_t *match)
+{
+  int q, i, w;
+
+  for (q = q0; q + 1 < q1; q += 2) {
+    const unsigned int *a = query + q*DESCR_WORDS;
+    const unsigned int *b = a + DESCR_WORDS;
+    unsigned int a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4], a5 = a[5], a6 = a[6], a7 = a[7];
+    unsigned int b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4], b5 = b[5], b6 = b[6], b7 = b[7];
+    const unsigned int *p = d;
+
+    for (i = 0; i < n; i++) {
+      unsigned int x;
+      int da, db;
+
+      x = p[0]; da  = __builtin_pulp_cnt(a0 ^ x); db  = __builtin_pulp_cnt(b0 ^ x);
+      x = p[1]; da += __builtin_pulp_cnt(a1 ^ x); db += __builtin_pulp_cnt(b1 ^ x);
+      x = p[2]; da += __builtin_pulp_cnt(a2 ^ x); db += __builtin_pulp_cnt(b2 ^ x);
+      x = p[3]; da += __builtin_pulp_cnt(a3 ^ x); db += __builtin_pulp_cnt(b3 ^ x);
+      x = p[4]; da += __builtin_pulp_cnt(a4 ^ x); db += __builtin_pulp_cnt(b4 ^ x);
+      x = p[5]; da += __builtin_pulp_cnt(a5 ^ x); db += __builtin_pulp_cnt(b5 ^ x);
+      x = p[6]; da += __builtin_pulp_cnt(a6 ^ x); db += __builtin_pulp_cnt(b6 ^ x);
+      x = p[7]; da += __builtin_pulp_cnt(a7 ^ x); db += __builtin_pulp_cnt(b7 ^ x);
+      p += DESCR_WORDS;
+
+      if (da < match[q].dist2)
+        update(&match[q], da, base + i);
+      if (db < match[q+1].dist2)
+        update(&match[q+1], db, base + i);
+    }
+  }
+
+  // odd query left
+  for (; q < q1; q++) {
+    const unsigned int *a = query + q*DESCR_WORDS;
+
+    for (i = 0; i < n; i++) {
+      int da = 0;
+      for (w = 0; w < DESCR_WORDS; w++)
+        da += __builtin_pulp_cnt(a[w] ^ d[i*DESCR_WORDS + w]);
+      if (da < match[q].dist2)
+        update(&match[q], da, base + i);
+    }
+  }
+}
+
+void hamming_match(const unsigned int *query, int nq, const unsigned int *db, int ndb,
+                   match_t *match, int nc)
+{
+  int id = rt_core_id();
+  int nchunk = ndb / CHUNK;
+  int size = CHUNK*DESCR_WORDS*sizeof(unsigned int);
+  int chunk = (nq + nc - 1) / nc;
+  int q0 = id*chunk;
+  int q1 = q0 + chunk < nq ? q0 + chunk : nq;
+  int din = 0;
+  int c, q;
+
+  if (id >= nc)
+    q0 = q1 = 0;
+
+  for (q = q0; q < q1; q++) {
+    match[q].index = -1;
+    match[q].dist = match[q].dist2 = DESCR_WORDS*32 + 1;
+  }
+
+  if (id == 0)
+    din = plp_dma_memcpy((unsigned int) db, (unsigned int) g_chunk[0], size, PLP_DMA_EXT2LOC);
+
+  for (c = 0; c < nchunk; c++) {
+    // the buffer of chunk c+1 was released by the barrier closing chunk c-1
+    if (id == 0) {
+      plp_dma_wait(din);
+      if (c + 1 < nchunk)
+        din = plp_dma_memcpy((unsigned int) (db + (c+1)*CHUNK*DESCR_WORDS), (unsigned int) g_chunk[(c+1)&1],
+                             size, PLP_DMA_EXT2LOC);
+    }
+
+    synch_barrier();
+
+    if (q0 < q1)
+      scan(query, q0, q1, g_chunk[c&1], CHUNK, c*CHUNK, match);
+
+    synch_barrier();
+  }
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#ifndef _PARHAMMING_H
+#define _PARHAMMING_H
+
+#include <pulp.h>
+
+// uncomment if doing test with SPI (disables printf's)
+// #define PULP_SPI
+
+// 256 bit binary descriptors (BRIEF / ORB), as the Descr* of bitDescriptor
+#define DESCR_WORDS   8
+
+// database size, queries, database descriptors per DMA chunk
+#define NDB           2048
+#define NQ            64
+#define CHUNK         128
+
+typedef struct {
+  int index;    // nearest database descriptor, lowest index on ties
+  int dist;     // its Hamming distance
+  int dist2;    // distance of the second nearest, for the ratio test
+} match_t;
+
+// Nearest neighbour of each of the nq queries (in L1) among the ndb
+// descriptors of db (in L2, ndb a multiple of CHUNK). The database goes
+// through L1 in double buffered chunks, each scanned by all the cores
+// against their share of the queries. Called by all cores.
+void hamming_match(const unsigned int *query, int nq, const unsigned int *db, int ndb,
+                   match_t *match, int nc);
+
+#endif
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <pulp.h>
+#include "parHamming.h"
+
+// L2 database
+unsigned int g_db[NDB*DESCR_WORDS];
+
+PLP_L1_DATA unsigned int g_query[NQ*DESCR_WORDS];
+PLP_L1_DATA match_t g_match[NQ];
+
+// expected matches, computed once
+match_t g_ref[NQ];
+
+// single-core cycles, for the speedup column
+static int g_cycles_1core;
+
+int test_match(int nc);
+void load();
+void reference();
+
+int main()
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  int errors = 0;
+  int nc;
+
+  if (rt_core_id() == 0) {
+    load();
+    reference();
+  }
+
+  synch_barrier();
+
+  for (nc = 1; nc <= get_core_num(); nc <<= 1)
+    errors += test_match(nc);
+
+  #ifndef PULP_SPI
+  if (rt_core_id() == 0)
+    printf("errors=%d\n", errors);
+  #endif
+
+  synch_barrier();
+
+  return errors;
+}
+
+// matches/cycle counts the query / database pairs compared
+int test_match(int nc)
+{
+  int errors = 0;
+  int q;
+
+  synch_barrier();
+
+  if (rt_core_id() == 0) {
+    reset_timer();
+    start_timer();
+  }
+
+  hamming_match(g_query, NQ, g_db, NDB, g_match, nc);
+
+  if (rt_core_id() == 0) {
+    int cycles;
+
+    stop_timer();
+    cycles = get_time();
+    if (nc == 1)
+      g_cycles_1core = cycles;
+
+    for (q = 0; q < NQ; q++) {
+      if (g_match[q].index != g_ref[q].index || g_match[q].dist != g_ref[q].dist ||
+          g_match[q].dist2 != g_ref[q].dist2)
+        errors++;
+    }
+
+    #ifndef PULP_SPI
+    printf("queries=%d, database=%d, cores=%d, errors=%d, time=%d, matches/cycle x1000=%d, speedup x100=%d\n",
+           NQ, NDB, nc, errors, cycles, (NQ * NDB * 1000) / cycles,
+           (g_cycles_1core * 100) / cycles);
+    #endif
+  }
+
+  synch_barrier();
+
+  return errors;
+}
+
+// random database; the even queries are copies of database descriptors
+// with up to 31 bits flipped, the odd ones random
+void load()
+{
+  unsigned int seed = 0x6a09e667;
+  int i, w;
+
+  for (i = 0; i < NDB*DESCR_WORDS; i++) {
+    seed = seed * 1103515245 + 12345;
+    g_db[i] = seed ^ (seed >> 15);
+  }
+
+  for (i = 0; i < NQ; i++) {
+    seed = seed * 1103515245 + 12345;
+    if (i & 1) {
+      for (w = 0; w < DESCR_WORDS; w++) {
+        seed = seed * 1103515245 + 12345;
+        g_query[i*DESCR_WORDS + w] = seed ^ (seed >> 13);
+      }
+    } else {
+      int src = (seed >> 8) % NDB;
+      int flips = (seed >> 24) & 31;
+      for (w = 0; w < DESCR_WORDS; w++)
+        g_query[i*DESCR_WORDS + w] = g_db[src*DESCR_WORDS + w];
+      for (w = 0; w < flips; w++) {
+        seed = seed * 1103515245 + 12345;
+        g_query[i*DESCR_WORDS + ((seed >> 8) & 7)] ^= 1 << ((seed >> 16) & 31);
+      }
+    }
+  }
+}
+
+// set bits of x by shift and add, independent of the p.cnt of the kernel
+// (__builtin_popcount lowers to it as well)
+static int popcount_ref(unsigned int x)
+{
+  x = x - ((x >> 1) & 0x55555555);
+  x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+  x = (x + (x >> 4)) & 0x0f0f0f0f;
+  x = x + (x >> 8);
+  x = x + (x >> 16);
+  return x & 0x3f;
+}
+
+// word by word with popcount_ref, straight from L2
+void reference()
+{
+  int q, i, w;
+
+  for (q = 0; q < NQ; q++) {
+    g_ref[q].index = -1;
+    g_ref[q].dist = g_ref[q].dist2 = DESCR_WORDS*32 + 1;
+    for (i = 0; i < NDB; i++) {
+      int dist = 0;
+      for (w = 0; w < DESCR_WORDS; w++)
+        dist += popcount_ref(g_query[q*DESCR_WORDS + w] ^ g_db[i*DESCR_WORDS + w]);
+      if (dist < g_ref[q].dist) {
+        g_ref[q].dist2 = g_ref[q].dist;
+        g_ref[q].dist = dist;
+        g_ref[q].index = i;
+      } else if (dist < g_ref[q].dist2) {
+        g_ref[q].dist2 = dist;
+      }
+    }
+  }
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/******************************************************************************
+ *                                                                            *
+ * Temporal-blocked multi-core stencil engine                                 *
+ *                                                                            *
+ * The grid stays in L2, two copies swapped by pointer after every sweep.     *
+ * A sweep advances the whole grid by tb steps, one strip of rows at a time:  *
+ * the strip is loaded with tb*ry halo rows on each side, then tb steps run   *
+ * in L1 between two buffers swapped by pointer, the valid region shrinking   *
+ * by ry rows per step (overlapped tiling), and only the strip's own rows go  *
+ * back to L2. Each step splits its rows in bands across the cores; the       *
+ * barrier at the end of the step is the halo synchronization, as the        *
+ * neighbouring bands are read directly in the shared L1. A third buffer      *
+ * receives the next strip by DMA while the current one is computed.         *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <pulp.h>
+#include "parStencil.h"
+
+PLP_L1_DATA short g_strip[3][STRIP_BUF] __attribute__((aligned(4)));
+
+static void radius(const stencil_t *s, int *ry, int *rx)
+{
+  int i;
+
+  *ry = *rx = 0;
+  for (i = 0; i < s->npts; i++) {
+    int y = s->dy[i] < 0 ? -s->dy[i] : s->dy[i];
+    int x = s->dx[i] < 0 ? -s->dx[i] : s->dx[i];
+    if (y > *ry) *ry = y;
+    if (x > *rx) *rx = x;
+  }
+}
+
+// n consecutive interior points, off[i] = dy[i]*nx + dx[i]
+static inline void span(const short *in, short *out, int n, const int *off, const short *w, int npts, int shift)
+{
+  int rnd = shift ? 1 << (shift-1) : 0;
+  int x, i;
+
+  for (x = 0; x < n; x++) {
+    int acc = rnd;
+    for (i = 0; i < npts; i++)
+      acc += w[i] * in[x + off[i]];
+    out[x] = __CLIP(acc >> shift, 15);
+  }
+}
+
+// global rows [r0, r1) of a buffer holding the rows from l0 on; frame
+// rows and columns are copied
+static void rows(const stencil_t *s, const int *off, const short *in, short *out, int l0,
+                 int r0, int r1, int ny, int nx, int ry, int rx)
+{
+  int a = r0 > ry ? r0 : ry;
+  int b = r1 < ny - ry ? r1 : ny - ry;
+  int r, x;
+
+  for (r = r0; r < r1; r++) {
+    if (r < a || r >= b) {
+      for (x = 0; x < nx; x++)
+        out[(r-l0)*nx + x] = in[(r-l0)*nx + x];
+    }
+  }
+
+  if (a >= b)
+    return;
+
+  // without column offsets the interior rows are one contiguous span
+  if (rx == 0) {
+    span(in + (a-l0)*nx, out + (a-l0)*nx, (b-a)*nx, off, s->w, s->npts, s->shift);
+    return;
+  }
+
+  for (r = a; r < b; r++) {
+    const short *pi = in + (r-l0)*nx;
+    short *po = out + (r-l0)*nx;
+    for (x = 0; x < rx; x++) {
+      po[x] = pi[x];
+      po[nx-1-x] = pi[nx-1-x];
+    }
+    span(pi + rx, po + rx, nx - 2*rx, off, s->w, s->npts, s->shift);
+  }
+}
+
+// tb steps of the whole grid, src to dst
+static void sweep(const stencil_t *s, const int *off, const short *src, short *dst,
+                  int ny, int nx, int tb, int ry, int rx, int nc)
+{
+  int id = rt_core_id();
+  int h = tb*ry;
+  int srows = STRIP_BUF/nx - 2*h;
+  int nstrip = (ny + srows - 1) / srows;
+  int cur = 0;
+  int din = 0, dout = 0;
+  int pending_out = 0;
+  int st, k;
+
+  if (id == 0) {
+    int l1 = srows + h < ny ? srows + h : ny;
+    din = plp_dma_memcpy((unsigned int) src, (unsigned int) g_strip[0], l1*nx*sizeof(short), PLP_DMA_EXT2LOC);
+  }
+
+  for (st = 0; st < nstrip; st++) {
+    int s0 = st*srows;
+    int s1 = s0 + srows < ny ? s0 + srows : ny;
+    int l0 = s0 - h > 0 ? s0 - h : 0;
+    int l1 = s1 + h < ny ? s1 + h : ny;
+    int next = (cur+1) % 3;
+    int other = (cur+2) % 3;
+    short *in = g_strip[cur];
+    short *out = g_strip[other];
+
+    // all buffers but the current one are free once the last strip is out
+    if (id == 0) {
+      plp_dma_wait(din);
+      if (pending_out) {
+        plp_dma_wait(dout);
+        pending_out = 0;
+      }
+      if (st + 1 < nstrip) {
+        int n0 = s1 - h > 0 ? s1 - h : 0;
+        int n1 = s1 + srows + h < ny ? s1 + srows + h : ny;
+        din = plp_dma_memcpy((unsigned int) (src + n0*nx), (unsigned int) g_strip[next],
+                             (n1-n0)*nx*sizeof(short), PLP_DMA_EXT2LOC);
+      }
+    }
+
+    synch_barrier();
+
+    for (k = 1; k <= tb; k++) {
+      int lo = l0 == 0 ? 0 : l0 + k*ry;
+      int hi = l1 == ny ? ny : l1 - k*ry;
+      int chunk = (hi - lo + nc - 1) / nc;
+      short *tmp;
+
+      if (id < nc) {
+        int r0 = lo + id*chunk;
+        int r1 = r0 + chunk < hi ? r0 + chunk : hi;
+        if (r0 < r1)
+          rows(s, off, in, out, l0, r0, r1, ny, nx, ry, rx);
+      }
+
+      synch_barrier();
+
+      tmp = in;
+      in = out;
+      out = tmp;
+    }
+
+    if (id == 0) {
+      dout = plp_dma_memcpy((unsigned int) (dst + s0*nx), (unsigned int) (in + (s0-l0)*nx),
+                            (s1-s0)*nx*sizeof(short), PLP_DMA_LOC2EXT);
+      pending_out = 1;
+    }
+
+    cur = next;
+  }
+
+  if (id == 0 && pending_out)
+    plp_dma_wait(dout);
+
+  synch_barrier();
+}
+
+short *stencil_run(const stencil_t *s, short *a, short *b, int ny, int nx, int t, int tb, int nc)
+{
+  int off[STENCIL_MAX_PTS];
+  int ry, rx, i, t0;
+
+  radius(s, &ry, &rx);
+
+  // a strip needs at least one row besides the halo rows of its tb steps
+  if (STRIP_BUF/nx - 2*(t < tb ? t : tb)*ry < 1)
+    return 0;
+
+  for (i = 0; i < s->npts; i++)
+    off[i] = s->dy[i]*nx + s->dx[i];
+
+  for (t0 = 0; t0 < t; t0 += tb) {
+    short *tmp;
+
+    sweep(s, off, a, b, ny, nx, t - t0 < tb ? t - t0 : tb, ry, rx, nc);
+
+    tmp = a;
+    a = b;
+    b = tmp;
+  }
+
+  return a;
+}
+
+short *stencil_ref(const stencil_t *s, short *a, short *b, int ny, int nx, int t)
+{
+  int rnd = s->shift ? 1 << (s->shift-1) : 0;
+  int ry, rx, k, y, x, i;
+
+  radius(s, &ry, &rx);
+
+  for (k = 0; k < t; k++) {
+    short *tmp;
+
+    for (y = 0; y < ny; y++) {
+      for (x = 0; x < nx; x++) {
+        if (y < ry || y >= ny - ry || x < rx || x >= nx - rx) {
+          b[y*nx + x] = a[y*nx + x];
+        } else {
+          int acc = rnd;
+          for (i = 0; i < s->npts; i++)
+            acc += s->w[i] * a[(y + s->dy[i])*nx + x + s->dx[i]];
+          acc >>= s->shift;
+          if (acc >  32767) acc =  32767;
+          if (acc < -32768) acc = -32768;
+          b[y*nx + x] = acc;
+        }
+      }
+    }
+
+    tmp = a;
+    a = b;
+    b = tmp;
+  }
+
+  return a;
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#ifndef _PARSTENCIL_H
+#define _PARSTENCIL_H
+
+#include <pulp.h>
+
+// uncomment if doing test with SPI (disables printf's)
+// #define PULP_SPI
+
+#define STENCIL_MAX_PTS   25
+
+// size of each of the 3 L1 strip buffers, in shorts
+#define STRIP_BUF         6144
+
+// Jacobi-type stencil on a grid of shorts:
+// out[y][x] = clip((sum w[i]*in[y+dy[i]][x+dx[i]] + round) >> shift)
+// for the interior points, the frame of the stencil radius stays fixed
+typedef struct {
+  int npts;
+  signed char dy[STENCIL_MAX_PTS];
+  signed char dx[STENCIL_MAX_PTS];
+  short w[STENCIL_MAX_PTS];
+  int shift;
+} stencil_t;
+
+// Runs t steps of s on the ny x nx grid in L2 at a, using b as the second
+// grid, and returns the grid holding the result (a or b). 1D stencils use
+// nx = 1 and dy offsets. The grid goes through L1 in strips of rows that
+// stay there for tb steps; the rows of every step are split across nc
+// cores, with a barrier between steps. Called by all cores. Returns 0
+// when STRIP_BUF cannot hold 2*tb*ry + 1 rows of nx shorts.
+short *stencil_run(const stencil_t *s, short *a, short *b, int ny, int nx, int t, int tb, int nc);
+
+// single core, straight in L2, one full grid per step
+short *stencil_ref(const stencil_t *s, short *a, short *b, int ny, int nx, int t);
+
+#endif
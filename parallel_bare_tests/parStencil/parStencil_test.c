@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <pulp.h>
+#include "parStencil.h"
+
+// time steps of every run
+#define T         16
+
+// largest grid, in points
+#define NPOINTS   16384
+
+#define NPROB     4
+#define NTB       2
+
+typedef struct {
+  const char *name;
+  int ny, nx;
+  stencil_t s;
+} problem_t;
+
+static const problem_t g_prob[NPROB] = {
+  // weights sum to 1.0 in Q15
+  { "jacobi-2d", 128, 128, { 5, { 0, -1, 1, 0, 0 }, { 0, 0, 0, -1, 1 },
+                             { 6556, 6553, 6553, 6553, 6553 }, 15 } },
+  { "gauss-2d",  128, 128, { 9, { -1, -1, -1, 0, 0, 0, 1, 1, 1 }, { -1, 0, 1, -1, 0, 1, -1, 0, 1 },
+                             { 1, 2, 1, 2, 4, 2, 1, 2, 1 }, 4 } },
+  // radius 2 cross, (16 6 6 6 6 -1 -1 -1 -1)/32, not positive: saturates on the edges
+  { "cross-r2",  128, 128, { 9, { 0, -1, 1, 0, 0, -2, 2, 0, 0 }, { 0, 0, 0, -1, 1, 0, 0, -2, 2 },
+                             { 16, 6, 6, 6, 6, -1, -1, -1, -1 }, 5 } },
+  { "jacobi-1d", NPOINTS, 1, { 3, { -1, 0, 1 }, { 0, 0, 0 },
+                             { 10923, 10922, 10923 }, 15 } }
+};
+
+static const int g_tb[NTB] = { 1, 8 };
+
+// L2: initial grid, engine grids, reference grids
+short g_init[NPOINTS];
+short g_a[NPOINTS];
+short g_b[NPOINTS];
+short g_ra[NPOINTS];
+short g_rb[NPOINTS];
+
+// single-core cycles of the current run, for the speedup column
+static int g_cycles_1core;
+
+int test_stencil(const problem_t *p, int tb, int nc, int ref_cycles, const short *ref);
+void load(int n);
+
+int main()
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  int errors = 0;
+  int p, tb, nc;
+
+  for (p = 0; p < NPROB; p++) {
+    const problem_t *pr = &g_prob[p];
+    const short *ref = 0;
+    int ref_cycles = 0;
+
+    if (rt_core_id() == 0) {
+      load(pr->ny * pr->nx);
+
+      reset_timer();
+      start_timer();
+
+      ref = stencil_ref(&pr->s, g_ra, g_rb, pr->ny, pr->nx, T);
+
+      stop_timer();
+      ref_cycles = get_time();
+    }
+
+    for (tb = 0; tb < NTB; tb++) {
+      for (nc = 1; nc <= get_core_num(); nc <<= 1)
+        errors += test_stencil(pr, g_tb[tb], nc, ref_cycles, ref);
+    }
+  }
+
+  #ifndef PULP_SPI
+  if (rt_core_id() == 0)
+    printf("errors=%d\n", errors);
+  #endif
+
+  synch_barrier();
+
+  return errors;
+}
+
+int test_stencil(const problem_t *p, int tb, int nc, int ref_cycles, const short *ref)
+{
+  int n = p->ny * p->nx;
+  int errors = 0;
+  short *res;
+  int i;
+
+  if (rt_core_id() == 0) {
+    for (i = 0; i < n; i++)
+      g_a[i] = g_init[i];
+  }
+
+  synch_barrier();
+
+  if (rt_core_id() == 0) {
+    reset_timer();
+    start_timer();
+  }
+
+  res = stencil_run(&p->s, g_a, g_b, p->ny, p->nx, T, tb, nc);
+
+  if (rt_core_id() == 0) {
+    int cycles;
+
+    stop_timer();
+    cycles = get_time();
+    if (nc == 1)
+      g_cycles_1core = cycles;
+
+    if (!res) {
+      errors++;
+    } else {
+      for (i = 0; i < n; i++) {
+        if (res[i] != ref[i])
+          errors++;
+      }
+    }
+
+    #ifndef PULP_SPI
+    printf("%s, %dx%d, steps=%d, tb=%d, cores=%d, errors=%d, time=%d, points/cycle x1000=%d, "
+           "speedup x100=%d, vs ref x100=%d\n", p->name, p->ny, p->nx, T, tb, nc, errors, cycles,
+           (n * T * 1000) / cycles, (g_cycles_1core * 100) / cycles, (ref_cycles * 100) / cycles);
+    #endif
+  }
+
+  synch_barrier();
+
+  return errors;
+}
+
+// pseudo random values with a smooth bump, within half of the full scale,
+// copied to the reference grid
+void load(int n)
+{
+  unsigned seed = 0x9e3779b9;
+  int i;
+
+  for (i = 0; i < n; i++) {
+    seed = seed * 1103515245 + 12345;
+    g_init[i] = ((int) seed >> 18) + ((i & 1023) < 512 ? 8192 : -8192);
+    g_ra[i] = g_init[i];
+  }
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/******************************************************************************
+ *                                                                            *
+ * Streaming block FIR/IIR filters                                            *
+ *                                                                            *
+ * Long multi-channel signals stay in L2 and go through L1 in blocks of       *
+ * BLOCK samples, double buffered per core: while block k is filtered the     *
+ * DMA fetches block k+1 and writes back the result of block k-1. The FIR     *
+ * input buffers keep ntaps-1 samples of room in front of the block, where    *
+ * the tail of the previous block is copied, so the kernel sees a contiguous  *
+ * delay line. The biquad states live in the filter structure.                *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <pulp.h>
+#include "streamFilter.h"
+
+// per core: input blocks with the FIR history in front and the 2 samples
+// read past the end by the FIR kernel, output blocks
+PLP_L1_DATA short g_in_buf[NCH][2][FIR_NTAPS_MAX + BLOCK + 4] __attribute__((aligned(4)));
+PLP_L1_DATA short g_out_buf[NCH][2][BLOCK] __attribute__((aligned(4)));
+
+typedef void (*block_fn)(void *f, const short *x, short *y, int n);
+
+void fir_init(fir_t *f, const short *h, int ntaps)
+{
+  int i;
+
+  f->ntaps = ntaps;
+  for (i = 0; i < ntaps; i++)
+    f->coeff[i] = h[ntaps-1-i];
+  f->coeff[ntaps] = 0;
+  for (i = 0; i < FIR_NTAPS_MAX; i++)
+    f->delay[i] = 0;
+}
+
+void iir_init(iir_t *f, const short *sos, int nsect)
+{
+  int s;
+
+  f->nsect = nsect;
+  for (s = 0; s < nsect; s++) {
+    f->b0[s]  = sos[5*s];
+    f->b12[s] = __PACK2(sos[5*s+1], sos[5*s+2]);
+    f->a12[s] = __PACK2(-sos[5*s+3], -sos[5*s+4]);
+    f->x[s]   = (v2s) {0, 0};
+    f->y[s]   = (v2s) {0, 0};
+  }
+}
+
+// 4 outputs per pass, each coefficient pair is loaded once for all of
+// them; the odd windows are shuffled out of two aligned words
+void fir_block(fir_t *f, const short *x, short *y, int n)
+{
+  const v2s *c = (const v2s *) f->coeff;
+  const short *base = x - (f->ntaps - 1);
+  int npairs = (f->ntaps + 1) / 2;
+  int i, j;
+
+  for (i = 0; i < n; i += 4) {
+    const v2s *w = (const v2s *) (base + i);
+    int s0 = 1 << (FIR_QF-1), s1 = s0, s2 = s0, s3 = s0;
+    v2s x0 = w[0];
+    v2s x1 = w[1];
+
+    for (j = 0; j < npairs; j++) {
+      v2s cj = c[j];
+      v2s x2 = w[j+2];
+      s0 = __SUMDOTP2(x0, cj, s0);
+      s1 = __SUMDOTP2(__builtin_shuffle(x0, x1, (v2s) {1, 2}), cj, s1);
+      s2 = __SUMDOTP2(x1, cj, s2);
+      s3 = __SUMDOTP2(__builtin_shuffle(x1, x2, (v2s) {1, 2}), cj, s3);
+      x0 = x1;
+      x1 = x2;
+    }
+
+    y[i]   = __CLIP(s0 >> FIR_QF, 15);
+    y[i+1] = __CLIP(s1 >> FIR_QF, 15);
+    y[i+2] = __CLIP(s2 >> FIR_QF, 15);
+    y[i+3] = __CLIP(s3 >> FIR_QF, 15);
+  }
+}
+
+// one section at a time over the whole block, its state in registers
+void iir_block(iir_t *f, const short *x, short *y, int n)
+{
+  int s, i;
+
+  for (s = 0; s < f->nsect; s++) {
+    const short *src = s == 0 ? x : y;
+    int b0 = f->b0[s];
+    v2s b12 = f->b12[s];
+    v2s a12 = f->a12[s];
+    v2s xh = f->x[s];
+    v2s yh = f->y[s];
+
+    for (i = 0; i < n; i++) {
+      int xi = src[i];
+      int acc = (1 << (IIR_QF-1)) + b0 * xi;
+      int yi;
+
+      acc = __SUMDOTP2(xh, b12, acc);
+      acc = __SUMDOTP2(yh, a12, acc);
+      yi = __CLIP(acc >> IIR_QF, 15);
+      xh = __PACK2(xi, xh[0]);
+      yh = __PACK2(yi, yh[0]);
+      y[i] = yi;
+    }
+
+    f->x[s] = xh;
+    f->y[s] = yh;
+  }
+}
+
+// len samples of one channel; hist samples of input history are carried
+// from block to block in front of the input buffers, starting from and
+// ending in delay
+static void stream_channel(void *f, block_fn fn, short *delay, int hist,
+                           const short *in, short *out, int len)
+{
+  int id = rt_core_id();
+  short *buf[2] = { g_in_buf[id][0] + FIR_NTAPS_MAX, g_in_buf[id][1] + FIR_NTAPS_MAX };
+  short *res[2] = { g_out_buf[id][0], g_out_buf[id][1] };
+  int din[2], dout[2];
+  int pending[2] = { 0, 0 };
+  int nblk = len / BLOCK;
+  int cur = 0;
+  int blk, i;
+
+  for (i = 0; i < hist; i++)
+    buf[0][i-hist] = delay[i];
+
+  din[0] = plp_dma_memcpy((unsigned int) in, (unsigned int) buf[0], BLOCK*sizeof(short), PLP_DMA_EXT2LOC);
+
+  for (blk = 0; blk < nblk; blk++) {
+    plp_dma_wait(din[cur]);
+    if (blk + 1 < nblk)
+      din[cur^1] = plp_dma_memcpy((unsigned int) (in + (blk+1)*BLOCK), (unsigned int) buf[cur^1],
+                                  BLOCK*sizeof(short), PLP_DMA_EXT2LOC);
+
+    if (pending[cur]) {
+      plp_dma_wait(dout[cur]);
+      pending[cur] = 0;
+    }
+
+    fn(f, buf[cur], res[cur], BLOCK);
+
+    dout[cur] = plp_dma_memcpy((unsigned int) (out + blk*BLOCK), (unsigned int) res[cur],
+                               BLOCK*sizeof(short), PLP_DMA_LOC2EXT);
+    pending[cur] = 1;
+
+    // the DMA only writes the block itself, the history area is free
+    for (i = 0; i < hist; i++)
+      buf[cur^1][i-hist] = buf[cur][BLOCK-hist+i];
+
+    cur ^= 1;
+  }
+
+  for (i = 0; i < hist; i++)
+    delay[i] = buf[cur][i-hist];
+
+  if (pending[0]) plp_dma_wait(dout[0]);
+  if (pending[1]) plp_dma_wait(dout[1]);
+}
+
+void fir_stream(fir_t *f, const short *in, short *out, int nch, int len, int ld, int nc)
+{
+  int id = rt_core_id();
+  int ch;
+
+  if (id < nc) {
+    for (ch = id; ch < nch; ch += nc)
+      stream_channel(&f[ch], (block_fn) fir_block, f[ch].delay, f[ch].ntaps - 1,
+                     in + ch*ld, out + ch*ld, len);
+  }
+
+  synch_barrier();
+}
+
+void iir_stream(iir_t *f, const short *in, short *out, int nch, int len, int ld, int nc)
+{
+  int id = rt_core_id();
+  int ch;
+
+  if (id < nc) {
+    for (ch = id; ch < nch; ch += nc)
+      stream_channel(&f[ch], (block_fn) iir_block, 0, 0, in + ch*ld, out + ch*ld, len);
+  }
+
+  synch_barrier();
+}
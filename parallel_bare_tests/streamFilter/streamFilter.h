@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#ifndef _STREAMFILTER_H
+#define _STREAMFILTER_H
+
+#include <pulp.h>
+
+// uncomment if doing test with SPI (disables printf's)
+// #define PULP_SPI
+
+// channels, one L2 signal of LEN samples each (planar layout); channels
+// are distributed over the cores, so more cores than NCH stay idle
+#define NCH             8
+#define LEN             4096
+
+// samples per DMA block, LEN must be a multiple of it
+#define BLOCK           256
+
+// largest filters
+#define FIR_NTAPS_MAX   32
+#define IIR_NSECT_MAX   4
+
+// Q15 samples, FIR taps in Q15, biquad coefficients in Q14
+#define FIR_QF          15
+#define IIR_QF          14
+
+// FIR, odd number of taps. The coefficients are kept time reversed and
+// zero padded to an even length, delay holds the last ntaps-1 inputs.
+typedef struct {
+  short coeff[FIR_NTAPS_MAX] __attribute__((aligned(4)));
+  short delay[FIR_NTAPS_MAX] __attribute__((aligned(4)));
+  int ntaps;
+} fir_t;
+
+// cascade of direct form I biquads:
+// y = b0*x + b1*x[-1] + b2*x[-2] - a1*y[-1] - a2*y[-2]
+typedef struct {
+  short b0[IIR_NSECT_MAX];
+  v2s   b12[IIR_NSECT_MAX];     // {b1, b2}
+  v2s   a12[IIR_NSECT_MAX];     // {-a1, -a2}
+  v2s   x[IIR_NSECT_MAX];       // {x[-1], x[-2]} of each section
+  v2s   y[IIR_NSECT_MAX];       // {y[-1], y[-2]}
+  int nsect;
+} iir_t;
+
+// h[ntaps], in the usual order y[n] = sum h[k]*x[n-k]; clears the state
+void fir_init(fir_t *f, const short *h, int ntaps);
+// sos[nsect][5] = {b0, b1, b2, a1, a2}; clears the state
+void iir_init(iir_t *f, const short *sos, int nsect);
+
+// n outputs (multiple of 4) of one block; x[-(ntaps-1)..-1] must hold the
+// previous inputs and x must be 4-byte aligned
+void fir_block(fir_t *f, const short *x, short *y, int n);
+void iir_block(iir_t *f, const short *x, short *y, int n);
+
+// Filters the next len samples (multiple of BLOCK) of every channel, from
+// in[ch*ld] to out[ch*ld] in L2. Channel ch runs on core ch % nc; each
+// core streams its channels through L1 in blocks of BLOCK samples, the
+// next block being fetched by DMA while the current one is filtered. The
+// state of each channel is kept across blocks and across calls. Called by
+// all cores.
+void fir_stream(fir_t *f, const short *in, short *out, int nch, int len, int ld, int nc);
+void iir_stream(iir_t *f, const short *in, short *out, int nch, int len, int ld, int nc);
+
+#endif
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <pulp.h>
+#include "streamFilter.h"
+
+#define FIR_NTAPS  31
+#define IIR_NSECT  2
+
+// low pass, cut-off at 0.1 fs, Hamming windowed sinc, Q15
+static const short fir_h[FIR_NTAPS] = {
+  0, 39, 91, 139, 129, 0, -271, -609, -832, -696, 0, 1297, 3011, 4755, 6059, 6542,
+  6059, 4755, 3011, 1297, 0, -696, -832, -609, -271, 0, 129, 139, 91, 39, 0
+};
+
+// 4th order Butterworth low pass, cut-off at 0.05 fs, {b0, b1, b2, a1, a2} Q14
+static const short iir_sos[IIR_NSECT*5] = {
+  359, 717, 359, -27869, 12919,
+  312, 624, 312, -24243,  9107
+};
+
+// L2, channel ch at ch*LEN
+short g_in_l2[NCH*LEN];
+short g_out_l2[NCH*LEN];
+
+PLP_L1_DATA fir_t g_fir[NCH];
+PLP_L1_DATA iir_t g_iir[NCH];
+
+// single-core cycles of the FIR and IIR runs, for the speedup column
+static int g_cycles_1core[2];
+
+int test_stream(int iir, int nc);
+void load();
+int check_fir(int ch);
+int check_iir(int ch);
+
+int main()
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  int errors = 0;
+  int nc;
+
+  if (rt_core_id() == 0)
+    load();
+
+  synch_barrier();
+
+  for (nc = 1; nc <= get_core_num() && nc <= NCH; nc <<= 1) {
+    errors += test_stream(0, nc);
+    errors += test_stream(1, nc);
+  }
+
+  #ifndef PULP_SPI
+  if (rt_core_id() == 0)
+    printf("errors=%d\n", errors);
+  #endif
+
+  synch_barrier();
+
+  return errors;
+}
+
+// the signal is fed in two calls of LEN/2 samples, so the filter state
+// crosses both block and call boundaries
+int test_stream(int iir, int nc)
+{
+  int errors = 0;
+  int ch;
+
+  if (rt_core_id() == 0) {
+    for (ch = 0; ch < NCH; ch++) {
+      if (iir)
+        iir_init(&g_iir[ch], iir_sos, IIR_NSECT);
+      else
+        fir_init(&g_fir[ch], fir_h, FIR_NTAPS);
+    }
+    for (ch = 0; ch < NCH*LEN; ch++)
+      g_out_l2[ch] = 0;
+  }
+
+  synch_barrier();
+
+  if (rt_core_id() == 0) {
+    reset_timer();
+    start_timer();
+  }
+
+  if (iir) {
+    iir_stream(g_iir, g_in_l2, g_out_l2, NCH, LEN/2, LEN, nc);
+    iir_stream(g_iir, g_in_l2 + LEN/2, g_out_l2 + LEN/2, NCH, LEN/2, LEN, nc);
+  } else {
+    fir_stream(g_fir, g_in_l2, g_out_l2, NCH, LEN/2, LEN, nc);
+    fir_stream(g_fir, g_in_l2 + LEN/2, g_out_l2 + LEN/2, NCH, LEN/2, LEN, nc);
+  }
+
+  if (rt_core_id() == 0) {
+    int cycles;
+
+    stop_timer();
+    cycles = get_time();
+    if (nc == 1)
+      g_cycles_1core[iir] = cycles;
+
+    for (ch = 0; ch < NCH; ch++)
+      errors += iir ? check_iir(ch) : check_fir(ch);
+
+    #ifndef PULP_SPI
+    printf("%s, channels=%d, cores=%d, errors=%d, time=%d, samples/cycle x1000=%d, speedup x100=%d\n",
+           iir ? "iir" : "fir", NCH, nc, errors, cycles, (NCH*LEN*1000) / cycles,
+           (g_cycles_1core[iir] * 100) / cycles);
+    #endif
+  }
+
+  synch_barrier();
+
+  return errors;
+}
+
+// a triangle wave of a different period per channel plus pseudo random
+// noise, within half of the full scale
+void load()
+{
+  unsigned seed = 0x2545f491;
+  int ch, i;
+
+  for (ch = 0; ch < NCH; ch++) {
+    int period = 64 + 24*ch;
+    for (i = 0; i < LEN; i++) {
+      int ph = i % period;
+      int tri = (ph < period/2 ? ph : period - ph) * 32768 / period - 8192;
+      seed = seed * 1103515245 + 12345;
+      g_in_l2[ch*LEN + i] = tri + ((int) seed >> 19);
+    }
+  }
+}
+
+// direct form, whole signal at once
+int check_fir(int ch)
+{
+  const short *x = g_in_l2 + ch*LEN;
+  const short *y = g_out_l2 + ch*LEN;
+  int errors = 0;
+  int n, k;
+
+  for (n = 0; n < LEN; n++) {
+    int acc = 1 << (FIR_QF-1);
+    for (k = 0; k < FIR_NTAPS && k <= n; k++)
+      acc += fir_h[k] * x[n-k];
+    acc >>= FIR_QF;
+    if (acc >  32767) acc =  32767;
+    if (acc < -32768) acc = -32768;
+    if (y[n] != acc)
+      errors++;
+  }
+
+  return errors;
+}
+
+int check_iir(int ch)
+{
+  const short *x = g_in_l2 + ch*LEN;
+  const short *y = g_out_l2 + ch*LEN;
+  int z[IIR_NSECT][4] = { { 0 } };  // x[-1], x[-2], y[-1], y[-2]
+  int errors = 0;
+  int n, s;
+
+  for (n = 0; n < LEN; n++) {
+    int v = x[n];
+    for (s = 0; s < IIR_NSECT; s++) {
+      const short *c = iir_sos + 5*s;
+      int acc = (1 << (IIR_QF-1)) + c[0]*v + c[1]*z[s][0] + c[2]*z[s][1] - c[3]*z[s][2] - c[4]*z[s][3];
+      acc >>= IIR_QF;
+      if (acc >  32767) acc =  32767;
+      if (acc < -32768) acc = -32768;
+      z[s][1] = z[s][0];
+      z[s][0] = v;
+      z[s][3] = z[s][2];
+      z[s][2] = acc;
+      v = acc;
+    }
+    if (y[n] != v)
+      errors++;
+  }
+
+  return errors;
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <stdio.h>
+#include "common.h"
+#include "aes_tt.h"
+
+// CBC decryption and CTR with the T-table core, blocks split across the
+// cluster cores, against message size. CBC encryption is serial, it runs
+// on one core as the baseline. The results are checked against the
+// single-core ones.
+
+#define MAX_LEN 4096
+#define NSIZES  4
+
+static const int g_sizes[NSIZES] = { 256, 1024, 2048, MAX_LEN };
+
+static const uint8_t g_key[32] = {
+  0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe,
+  0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+  0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7,
+  0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4
+};
+
+static const uint8_t g_iv[16] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+  0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+
+// low counter word close to wrapping, to cross the carry
+static const uint8_t g_ctr[16] = {
+  0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+  0xf8, 0xf9, 0xfa, 0xfb, 0xff, 0xff, 0xff, 0xe0
+};
+
+PLP_L1_DATA uint8_t g_msg[MAX_LEN];
+PLP_L1_DATA uint8_t g_cbc[MAX_LEN];
+PLP_L1_DATA uint8_t g_ctr_ref[MAX_LEN];
+PLP_L1_DATA uint8_t g_out[MAX_LEN];
+PLP_L1_DATA aes_tt_ctx g_ctx;
+
+// single-core cycles of cbc decrypt and ctr, for the speedup column
+static int g_cycles_1core[2];
+
+int test_modes(int len, int nc);
+void load(int keybits);
+
+int main()
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  int errors = 0;
+  int keybits, s, nc;
+
+  for (keybits = 128; keybits <= 256; keybits += 128) {
+    if (rt_core_id() == 0)
+      load(keybits);
+
+    synch_barrier();
+
+    for (s = 0; s < NSIZES; s++)
+      for (nc = 1; nc <= get_core_num(); nc <<= 1)
+        errors += test_modes(g_sizes[s], nc);
+  }
+
+  #ifndef PULP_SPI
+  if (rt_core_id() == 0)
+    printf("errors=%d\n", errors);
+  #endif
+
+  synch_barrier();
+
+  return errors;
+}
+
+// one timed run of cbc decrypt (mode 0) or ctr (mode 1) on nc cores
+static int run(int mode, int len, int nc)
+{
+  int cycles = 0;
+
+  if (rt_core_id() == 0)
+    memset(g_out, 0, len);
+
+  synch_barrier();
+
+  if (rt_core_id() == 0) {
+    reset_timer();
+    start_timer();
+  }
+
+  if (mode == 0)
+    aes_tt_cbc_decrypt(&g_ctx, g_iv, g_cbc, g_out, len, nc);
+  else
+    aes_tt_ctr(&g_ctx, g_ctr, g_msg, g_out, len, nc);
+
+  synch_barrier();
+
+  if (rt_core_id() == 0) {
+    stop_timer();
+    cycles = get_time();
+  }
+
+  return cycles;
+}
+
+int test_modes(int len, int nc)
+{
+  int errors = 0;
+  int cycles[2];
+  int mode;
+
+  for (mode = 0; mode < 2; mode++) {
+    cycles[mode] = run(mode, len, nc);
+
+    if (rt_core_id() == 0) {
+      if (nc == 1)
+        g_cycles_1core[mode] = cycles[mode];
+      if (memcmp(g_out, mode == 0 ? g_msg : g_ctr_ref, len) != 0)
+        errors++;
+    }
+  }
+
+  if (rt_core_id() == 0) {
+    #ifndef PULP_SPI
+    for (mode = 0; mode < 2; mode++)
+      printf("AES-%d, %s, %d bytes, cores=%d, errors=%d, time=%d, bytes/cycle x1000=%d, speedup x100=%d\n",
+             g_ctx.rounds == 10 ? 128 : 256, mode ? "ctr" : "cbc decrypt", len, nc, errors, cycles[mode],
+             (len * 1000) / cycles[mode], (g_cycles_1core[mode] * 100) / cycles[mode]);
+    #endif
+  }
+
+  synch_barrier();
+
+  return errors;
+}
+
+// message, its CBC encryption (timed, serial) and its single-core CTR
+void load(int keybits)
+{
+  uint8_t iv[16];
+  unsigned seed = 0x9e3779b9 + keybits;
+  int cycles, i;
+
+  if (keybits == 128)
+    aes_tt_init();
+  aes_tt_set_key(&g_ctx, g_key, keybits);
+
+  for (i = 0; i < MAX_LEN; i++) {
+    seed = seed * 1103515245 + 12345;
+    g_msg[i] = seed >> 24;
+  }
+
+  memcpy(iv, g_iv, 16);
+  reset_timer();
+  start_timer();
+  aes_tt_cbc_encrypt(&g_ctx, iv, g_msg, g_cbc, MAX_LEN);
+  stop_timer();
+  cycles = get_time();
+
+  aes_tt_ctr(&g_ctx, g_ctr, g_msg, g_ctr_ref, MAX_LEN, 1);
+
+  #ifndef PULP_SPI
+  printf("AES-%d, cbc encrypt, %d bytes, cores=1, time=%d, bytes/cycle x1000=%d\n",
+         keybits, MAX_LEN, cycles, (MAX_LEN * 1000) / cycles);
+  #endif
+}
@@ -0,0 +1 @@
+../aes_shared/aes_tt.c
\ No newline at end of file
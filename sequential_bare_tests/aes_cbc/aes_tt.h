@@ -0,0 +1 @@
+../aes_shared/aes_tt.h
\ No newline at end of file
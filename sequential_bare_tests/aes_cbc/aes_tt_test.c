@@ -0,0 +1,259 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <stdio.h>
+#include "common.h"
+#include "aes_tt.h"
+
+#define AES_MAXROUNDS 14
+#define AES_IV_SIZE   16
+#define KEYSIZE       16
+
+// message for the comparison with aes_cbc.c and the bytes/cycle figures
+#define MSG_LEN       1024
+
+typedef struct aes_key_st {
+  uint16_t rounds;
+  uint16_t key_size;
+  uint32_t ks[(AES_MAXROUNDS+1)*8];
+  uint8_t iv[AES_IV_SIZE];
+} AES_CTX;
+
+typedef enum {
+  AES_MODE_128,
+  AES_MODE_256
+} AES_MODE;
+
+extern void AES_set_key(AES_CTX *ctx, const uint8_t *key,
+                        const uint8_t *iv, AES_MODE mode);
+extern void AES_cbc_encrypt(AES_CTX *ctx, const uint8_t *in, uint8_t *out,
+                            int size);
+extern void AES_convert_key(AES_CTX *ctx);
+extern void AES_cbc_decrypt(AES_CTX *ctx, const uint8_t *in, uint8_t *out,
+                            int size);
+
+// FIPS-197 appendix C: key 00 01 .. 1f (first 16/24/32 bytes),
+// plaintext 00 11 .. ff
+static const uint8_t fips_ct[3][16] = {
+  { 0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+    0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a },
+  { 0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0,
+    0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91 },
+  { 0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf,
+    0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89 }
+};
+
+// SP 800-38A F.2.1 and F.5.1, AES-128
+static const uint8_t sp_key[16] = {
+  0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+  0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+
+static const uint8_t sp_pt[64] = {
+  0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+  0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+  0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+  0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+  0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+  0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+  0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+  0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+
+static const uint8_t sp_cbc_ct[64] = {
+  0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46,
+  0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d,
+  0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72, 0x19, 0xee,
+  0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2,
+  0x73, 0xbe, 0xd6, 0xb8, 0xe3, 0xc1, 0x74, 0x3b,
+  0x71, 0x16, 0xe6, 0x9e, 0x22, 0x22, 0x95, 0x16,
+  0x3f, 0xf1, 0xca, 0xa1, 0x68, 0x1f, 0xac, 0x09,
+  0x12, 0x0e, 0xca, 0x30, 0x75, 0x86, 0xe1, 0xa7
+};
+
+static const uint8_t sp_ctr[16] = {
+  0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+  0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+
+static const uint8_t sp_ctr_ct[64] = {
+  0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26,
+  0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+  0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff,
+  0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+  0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e,
+  0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+  0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1,
+  0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee
+};
+
+// key and iv of aes_cbc_test.c
+static const uint8_t key[KEYSIZE] = {
+  0xff, 0xde, 0x00, 0xad,
+  0xff, 0xb0, 0x00, 0x0b,
+  0xff, 0xde, 0x00, 0xad,
+  0xff, 0xb0, 0x00, 0x0b
+};
+
+static const uint8_t iv[KEYSIZE] = {
+  0xff, 0xc0, 0x00, 0xfe,
+  0xff, 0xc0, 0x00, 0x7d,
+  0xff, 0xc0, 0x00, 0xfe,
+  0xff, 0xc0, 0x00, 0x7d
+};
+
+static uint8_t msg[MSG_LEN] __sram;
+static uint8_t enc[MSG_LEN] __sram;
+static uint8_t dec[MSG_LEN] __sram;
+static uint8_t ref[MSG_LEN] __sram;
+static uint8_t iv_tmp[AES_IV_SIZE] __sram;
+
+static AES_CTX context __sram;
+static aes_tt_ctx tt_context __sram;
+
+const char* __attribute__((weak)) get_testname()
+{
+  return "aes_tt";
+}
+
+static int check_kat() {
+  uint8_t k[32], pt[16], out[16];
+  int errors = 0;
+  int i, n;
+
+  for (i = 0; i < 32; i++)
+    k[i] = i;
+  for (i = 0; i < 16; i++)
+    pt[i] = i * 0x11;
+
+  for (n = 0; n < 3; n++) {
+    aes_tt_set_key(&tt_context, k, 128 + 64*n);
+    aes_tt_encrypt(&tt_context, pt, out);
+    errors += memcmp(out, fips_ct[n], 16) != 0;
+    aes_tt_decrypt(&tt_context, out, out);
+    errors += memcmp(out, pt, 16) != 0;
+  }
+
+  aes_tt_set_key(&tt_context, sp_key, 128);
+
+  for (i = 0; i < 16; i++)
+    iv_tmp[i] = i;
+  aes_tt_cbc_encrypt(&tt_context, iv_tmp, sp_pt, enc, 64);
+  errors += memcmp(enc, sp_cbc_ct, 64) != 0;
+  errors += memcmp(iv_tmp, sp_cbc_ct + 48, 16) != 0;
+  for (i = 0; i < 16; i++)
+    iv_tmp[i] = i;
+  aes_tt_cbc_decrypt(&tt_context, iv_tmp, sp_cbc_ct, dec, 64, 1);
+  errors += memcmp(dec, sp_pt, 64) != 0;
+
+  aes_tt_ctr(&tt_context, sp_ctr, sp_pt, enc, 64, 1);
+  errors += memcmp(enc, sp_ctr_ct, 64) != 0;
+  // a partial last block
+  aes_tt_ctr(&tt_context, sp_ctr, sp_ctr_ct, dec, 57, 1);
+  errors += memcmp(dec, sp_pt, 57) != 0;
+
+  return errors;
+}
+
+// bytes/cycle x1000 of aes_cbc.c and of the T-table modes on MSG_LEN bytes,
+// the CBC ciphertexts must be the same
+static int bench() {
+  int t[5], i;
+  int errors = 0;
+
+  AES_set_key(&context, key, iv, AES_MODE_128);
+  reset_timer();
+  start_timer();
+  AES_cbc_encrypt(&context, msg, ref, MSG_LEN);
+  stop_timer();
+  t[0] = get_time();
+
+  AES_set_key(&context, key, iv, AES_MODE_128);
+  AES_convert_key(&context);
+  reset_timer();
+  start_timer();
+  AES_cbc_decrypt(&context, ref, dec, MSG_LEN);
+  stop_timer();
+  t[1] = get_time();
+  errors += memcmp(dec, msg, MSG_LEN) != 0;
+
+  aes_tt_set_key(&tt_context, key, 128);
+  memcpy(iv_tmp, iv, AES_IV_SIZE);
+  reset_timer();
+  start_timer();
+  aes_tt_cbc_encrypt(&tt_context, iv_tmp, msg, enc, MSG_LEN);
+  stop_timer();
+  t[2] = get_time();
+  errors += memcmp(enc, ref, MSG_LEN) != 0;
+
+  reset_timer();
+  start_timer();
+  aes_tt_cbc_decrypt(&tt_context, iv, enc, dec, MSG_LEN, 1);
+  stop_timer();
+  t[3] = get_time();
+  errors += memcmp(dec, msg, MSG_LEN) != 0;
+
+  reset_timer();
+  start_timer();
+  aes_tt_ctr(&tt_context, iv, msg, enc, MSG_LEN, 1);
+  stop_timer();
+  t[4] = get_time();
+  aes_tt_ctr(&tt_context, iv, enc, dec, MSG_LEN, 1);
+  errors += memcmp(dec, msg, MSG_LEN) != 0;
+
+  printf("aes_cbc.c, %d bytes: encrypt %d cycles, %d bytes/cycle x1000, decrypt %d cycles, %d bytes/cycle x1000\n",
+         MSG_LEN, t[0], (MSG_LEN * 1000) / t[0], t[1], (MSG_LEN * 1000) / t[1]);
+  printf("T-table, %d bytes: cbc encrypt %d cycles, %d bytes/cycle x1000, cbc decrypt %d cycles, %d bytes/cycle x1000, ctr %d cycles, %d bytes/cycle x1000\n",
+         MSG_LEN, t[2], (MSG_LEN * 1000) / t[2], t[3], (MSG_LEN * 1000) / t[3],
+         t[4], (MSG_LEN * 1000) / t[4]);
+
+  return errors;
+}
+
+void test_setup() {
+  aes_tt_init();
+  for (int i = 0; i < MSG_LEN; i++)
+    msg[i] = (i * 73 + (i >> 4)) & 0xFF;
+}
+
+void test_clear() {
+  memset(enc, 0, MSG_LEN);
+  memset(dec, 0, MSG_LEN);
+  memset(&tt_context, 0, sizeof(tt_context));
+}
+
+// same work as aes_cbc_test.c, on the first 64 bytes
+void test_run() {
+  aes_tt_set_key(&tt_context, key, 128);
+  memcpy(iv_tmp, iv, AES_IV_SIZE);
+  aes_tt_cbc_encrypt(&tt_context, iv_tmp, msg, enc, 64);
+  aes_tt_cbc_decrypt(&tt_context, iv, enc, dec, 64, 1);
+}
+
+int test_check() {
+  int errors = memcmp(dec, msg, 64) != 0;
+
+  errors += check_kat();
+  errors += bench();
+
+  if (errors != 0)
+    printf("aes_tt: %d errors\n", errors);
+
+  return errors == 0;
+}
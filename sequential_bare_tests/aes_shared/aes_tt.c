@@ -0,0 +1,364 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/*
+ * AES with 32 bit T-tables: a round is 16 table lookups and 16 xors, the
+ * tables fusing SubBytes, ShiftRows and MixColumns (InvMixColumns for the
+ * decryption, which uses the equivalent inverse cipher key schedule). The
+ * state is kept as 4 big endian column words, two rounds per loop trip.
+ *
+ * The 8 tables (8 KiB) and the inverse S-box are computed by aes_tt_init
+ * into local memory rather than read from L2; the S-box is the low byte
+ * of Te1. Table lookups depend on the data, as in any T-table AES.
+ */
+
+#include <string.h>
+#include "pulp.h"
+#include "aes_tt.h"
+
+RT_LOCAL_DATA static uint32_t Te0[256], Te1[256], Te2[256], Te3[256];
+RT_LOCAL_DATA static uint32_t Td0[256], Td1[256], Td2[256], Td3[256];
+RT_LOCAL_DATA static uint8_t Td4[256];
+
+#define ROR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+#define GETU32(p) (((uint32_t) (p)[0] << 24) | ((uint32_t) (p)[1] << 16) | \
+                   ((uint32_t) (p)[2] <<  8) | ((uint32_t) (p)[3]))
+#define PUTU32(p, v) { (p)[0] = (v) >> 24; (p)[1] = (v) >> 16; \
+                       (p)[2] = (v) >>  8; (p)[3] = (v); }
+
+#define SBOX(x)   (Te1[(x)] & 0xff)
+
+static uint8_t xtime(uint8_t x)
+{
+    return (x << 1) ^ ((x & 0x80) ? 0x1b : 0);
+}
+
+static uint8_t rotl8(uint8_t x, int n)
+{
+    return (x << n) | (x >> (8 - n));
+}
+
+void aes_tt_init(void)
+{
+    uint8_t sbox[256];
+    uint8_t p = 1, q = 1;
+    int i;
+
+    /* p runs over the powers of 3, q over those of its inverse */
+    do {
+        p ^= xtime(p);
+        q ^= q << 1;
+        q ^= q << 2;
+        q ^= q << 4;
+        if (q & 0x80)
+            q ^= 0x09;
+        sbox[p] = 0x63 ^ q ^ rotl8(q, 1) ^ rotl8(q, 2) ^ rotl8(q, 3) ^ rotl8(q, 4);
+    } while (p != 1);
+    sbox[0] = 0x63;
+
+    for (i = 0; i < 256; i++)
+        Td4[sbox[i]] = i;
+
+    for (i = 0; i < 256; i++)
+    {
+        uint32_t s = sbox[i], s2 = xtime(s), s3 = s2 ^ s;
+        uint32_t v = Td4[i], v2 = xtime(v), v4 = xtime(v2), v8 = xtime(v4);
+        uint32_t e, d;
+
+        /* S.(02, 01, 01, 03) and S^-1.(0e, 09, 0d, 0b) */
+        e = (s2 << 24) | (s << 16) | (s << 8) | s3;
+        d = ((v8 ^ v4 ^ v2) << 24) | ((v8 ^ v) << 16) | ((v8 ^ v4 ^ v) << 8) | (v8 ^ v2 ^ v);
+
+        Te0[i] = e;
+        Te1[i] = ROR32(e, 8);
+        Te2[i] = ROR32(e, 16);
+        Te3[i] = ROR32(e, 24);
+        Td0[i] = d;
+        Td1[i] = ROR32(d, 8);
+        Td2[i] = ROR32(d, 16);
+        Td3[i] = ROR32(d, 24);
+    }
+}
+
+int aes_tt_set_key(aes_tt_ctx *ctx, const uint8_t *key, int keybits)
+{
+    uint32_t *w = ctx->ek;
+    uint32_t rcon = 1;
+    int nk, nw, i, r;
+
+    switch (keybits)
+    {
+        case 128: nk = 4; break;
+        case 192: nk = 6; break;
+        case 256: nk = 8; break;
+        default:  return -1;
+    }
+
+    ctx->rounds = nk + 6;
+    nw = 4 * (ctx->rounds + 1);
+
+    for (i = 0; i < nk; i++)
+        w[i] = GETU32(key + 4*i);
+
+    for (i = nk; i < nw; i++)
+    {
+        uint32_t t = w[i-1];
+
+        if (i % nk == 0)
+        {
+            t = (SBOX((t >> 16) & 0xff) << 24) ^ (SBOX((t >> 8) & 0xff) << 16) ^
+                (SBOX(t & 0xff) << 8) ^ SBOX(t >> 24) ^ (rcon << 24);
+            rcon = xtime(rcon);
+        }
+        else if (nk > 6 && i % nk == 4)
+        {
+            t = (SBOX(t >> 24) << 24) ^ (SBOX((t >> 16) & 0xff) << 16) ^
+                (SBOX((t >> 8) & 0xff) << 8) ^ SBOX(t & 0xff);
+        }
+
+        w[i] = w[i-nk] ^ t;
+    }
+
+    /* round keys in reverse order, InvMixColumns on the inner ones */
+    for (r = 0; r <= ctx->rounds; r++)
+    {
+        for (i = 0; i < 4; i++)
+        {
+            uint32_t k = ctx->ek[4*(ctx->rounds - r) + i];
+
+            if (r > 0 && r < ctx->rounds)
+                k = Td0[SBOX(k >> 24)] ^ Td1[SBOX((k >> 16) & 0xff)] ^
+                    Td2[SBOX((k >> 8) & 0xff)] ^ Td3[SBOX(k & 0xff)];
+
+            ctx->dk[4*r + i] = k;
+        }
+    }
+
+    return 0;
+}
+
+#define ENC_ROUND(d0, d1, d2, d3, s0, s1, s2, s3, k) \
+    d0 = Te0[s0 >> 24] ^ Te1[(s1 >> 16) & 0xff] ^ Te2[(s2 >> 8) & 0xff] ^ Te3[s3 & 0xff] ^ (k)[0]; \
+    d1 = Te0[s1 >> 24] ^ Te1[(s2 >> 16) & 0xff] ^ Te2[(s3 >> 8) & 0xff] ^ Te3[s0 & 0xff] ^ (k)[1]; \
+    d2 = Te0[s2 >> 24] ^ Te1[(s3 >> 16) & 0xff] ^ Te2[(s0 >> 8) & 0xff] ^ Te3[s1 & 0xff] ^ (k)[2]; \
+    d3 = Te0[s3 >> 24] ^ Te1[(s0 >> 16) & 0xff] ^ Te2[(s1 >> 8) & 0xff] ^ Te3[s2 & 0xff] ^ (k)[3]
+
+#define ENC_LAST(s0, s1, s2, s3, k) \
+    ((Te2[s0 >> 24] & 0xff000000) ^ (Te3[(s1 >> 16) & 0xff] & 0x00ff0000) ^ \
+     (Te0[(s2 >> 8) & 0xff] & 0x0000ff00) ^ (Te1[s3 & 0xff] & 0x000000ff) ^ (k))
+
+#define DEC_ROUND(d0, d1, d2, d3, s0, s1, s2, s3, k) \
+    d0 = Td0[s0 >> 24] ^ Td1[(s3 >> 16) & 0xff] ^ Td2[(s2 >> 8) & 0xff] ^ Td3[s1 & 0xff] ^ (k)[0]; \
+    d1 = Td0[s1 >> 24] ^ Td1[(s0 >> 16) & 0xff] ^ Td2[(s3 >> 8) & 0xff] ^ Td3[s2 & 0xff] ^ (k)[1]; \
+    d2 = Td0[s2 >> 24] ^ Td1[(s1 >> 16) & 0xff] ^ Td2[(s0 >> 8) & 0xff] ^ Td3[s3 & 0xff] ^ (k)[2]; \
+    d3 = Td0[s3 >> 24] ^ Td1[(s2 >> 16) & 0xff] ^ Td2[(s1 >> 8) & 0xff] ^ Td3[s0 & 0xff] ^ (k)[3]
+
+#define DEC_LAST(s0, s1, s2, s3, k) \
+    (((uint32_t) Td4[s0 >> 24] << 24) ^ ((uint32_t) Td4[(s1 >> 16) & 0xff] << 16) ^ \
+     ((uint32_t) Td4[(s2 >> 8) & 0xff] << 8) ^ (uint32_t) Td4[s3 & 0xff] ^ (k))
+
+static inline void encrypt_words(const aes_tt_ctx *ctx, uint32_t s[4])
+{
+    const uint32_t *k = ctx->ek;
+    uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
+    int r = ctx->rounds >> 1;
+
+    s0 = s[0] ^ k[0];
+    s1 = s[1] ^ k[1];
+    s2 = s[2] ^ k[2];
+    s3 = s[3] ^ k[3];
+
+    for (;;)
+    {
+        ENC_ROUND(t0, t1, t2, t3, s0, s1, s2, s3, k + 4);
+        k += 8;
+        if (--r == 0)
+            break;
+        ENC_ROUND(s0, s1, s2, s3, t0, t1, t2, t3, k);
+    }
+
+    s[0] = ENC_LAST(t0, t1, t2, t3, k[0]);
+    s[1] = ENC_LAST(t1, t2, t3, t0, k[1]);
+    s[2] = ENC_LAST(t2, t3, t0, t1, k[2]);
+    s[3] = ENC_LAST(t3, t0, t1, t2, k[3]);
+}
+
+static inline void decrypt_words(const aes_tt_ctx *ctx, uint32_t s[4])
+{
+    const uint32_t *k = ctx->dk;
+    uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
+    int r = ctx->rounds >> 1;
+
+    s0 = s[0] ^ k[0];
+    s1 = s[1] ^ k[1];
+    s2 = s[2] ^ k[2];
+    s3 = s[3] ^ k[3];
+
+    for (;;)
+    {
+        DEC_ROUND(t0, t1, t2, t3, s0, s1, s2, s3, k + 4);
+        k += 8;
+        if (--r == 0)
+            break;
+        DEC_ROUND(s0, s1, s2, s3, t0, t1, t2, t3, k);
+    }
+
+    s[0] = DEC_LAST(t0, t3, t2, t1, k[0]);
+    s[1] = DEC_LAST(t1, t0, t3, t2, k[1]);
+    s[2] = DEC_LAST(t2, t1, t0, t3, k[2]);
+    s[3] = DEC_LAST(t3, t2, t1, t0, k[3]);
+}
+
+void aes_tt_encrypt(const aes_tt_ctx *ctx, const uint8_t in[16], uint8_t out[16])
+{
+    uint32_t s[4];
+    int i;
+
+    for (i = 0; i < 4; i++)
+        s[i] = GETU32(in + 4*i);
+    encrypt_words(ctx, s);
+    for (i = 0; i < 4; i++)
+        PUTU32(out + 4*i, s[i]);
+}
+
+void aes_tt_decrypt(const aes_tt_ctx *ctx, const uint8_t in[16], uint8_t out[16])
+{
+    uint32_t s[4];
+    int i;
+
+    for (i = 0; i < 4; i++)
+        s[i] = GETU32(in + 4*i);
+    decrypt_words(ctx, s);
+    for (i = 0; i < 4; i++)
+        PUTU32(out + 4*i, s[i]);
+}
+
+void aes_tt_cbc_encrypt(const aes_tt_ctx *ctx, uint8_t iv[16],
+                        const uint8_t *in, uint8_t *out, int len)
+{
+    uint32_t s[4];
+    int i;
+
+    for (i = 0; i < 4; i++)
+        s[i] = GETU32(iv + 4*i);
+
+    for ( ; len >= AES_TT_BLOCKSIZE; len -= AES_TT_BLOCKSIZE)
+    {
+        for (i = 0; i < 4; i++)
+            s[i] ^= GETU32(in + 4*i);
+        encrypt_words(ctx, s);
+        for (i = 0; i < 4; i++)
+            PUTU32(out + 4*i, s[i]);
+        in += AES_TT_BLOCKSIZE;
+        out += AES_TT_BLOCKSIZE;
+    }
+
+    for (i = 0; i < 4; i++)
+        PUTU32(iv + 4*i, s[i]);
+}
+
+/* blocks [*b0, *b1) of core id out of nc */
+static void block_range(int nblk, int nc, int *b0, int *b1)
+{
+    int id = nc > 1 ? rt_core_id() : 0;
+    int chunk = (nblk + nc - 1) / nc;
+
+    *b0 = id * chunk;
+    *b1 = *b0 + chunk < nblk ? *b0 + chunk : nblk;
+    if (id >= nc || *b0 > nblk)
+        *b0 = *b1 = 0;
+}
+
+/* every plaintext block only needs two ciphertext blocks */
+void aes_tt_cbc_decrypt(const aes_tt_ctx *ctx, const uint8_t iv[16],
+                        const uint8_t *in, uint8_t *out, int len, int nc)
+{
+    uint32_t s[4], prev[4];
+    int b, b0, b1, i;
+
+    block_range(len / AES_TT_BLOCKSIZE, nc, &b0, &b1);
+    if (b0 == b1)
+        return;
+
+    for (i = 0; i < 4; i++)
+        prev[i] = b0 == 0 ? GETU32(iv + 4*i) : GETU32(in + 16*(b0 - 1) + 4*i);
+
+    for (b = b0; b < b1; b++)
+    {
+        const uint8_t *pi = in + 16*b;
+        uint8_t *po = out + 16*b;
+
+        for (i = 0; i < 4; i++)
+            s[i] = GETU32(pi + 4*i);
+        decrypt_words(ctx, s);
+        for (i = 0; i < 4; i++)
+        {
+            uint32_t c = GETU32(pi + 4*i);
+            PUTU32(po + 4*i, s[i] ^ prev[i]);
+            prev[i] = c;
+        }
+    }
+}
+
+void aes_tt_ctr(const aes_tt_ctx *ctx, const uint8_t ctr[16],
+                const uint8_t *in, uint8_t *out, int len, int nc)
+{
+    uint32_t c[4], s[4];
+    uint8_t ks[16];
+    int b, b0, b1, i, n;
+
+    block_range((len + AES_TT_BLOCKSIZE - 1) / AES_TT_BLOCKSIZE, nc, &b0, &b1);
+    if (b0 == b1)
+        return;
+
+    /* counter of the first block of the range */
+    for (i = 0; i < 4; i++)
+        c[i] = GETU32(ctr + 4*i);
+    c[3] += b0;
+    if (c[3] < (uint32_t) b0 && ++c[2] == 0 && ++c[1] == 0)
+        ++c[0];
+
+    for (b = b0; b < b1; b++)
+    {
+        for (i = 0; i < 4; i++)
+            s[i] = c[i];
+        encrypt_words(ctx, s);
+
+        if (++c[3] == 0 && ++c[2] == 0 && ++c[1] == 0)
+            ++c[0];
+
+        n = len - 16*b < AES_TT_BLOCKSIZE ? len - 16*b : AES_TT_BLOCKSIZE;
+        if (n == AES_TT_BLOCKSIZE)
+        {
+            for (i = 0; i < 4; i++)
+            {
+                uint32_t v = GETU32(in + 16*b + 4*i) ^ s[i];
+                PUTU32(out + 16*b + 4*i, v);
+            }
+        }
+        else
+        {
+            for (i = 0; i < 4; i++)
+                PUTU32(ks + 4*i, s[i]);
+            for (i = 0; i < n; i++)
+                out[16*b + i] = in[16*b + i] ^ ks[i];
+        }
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/*
+ * T-table AES core, shared by aes_cbc and rijndael (symlinked from
+ * ../aes_shared).
+ *
+ * aes_tt_init builds the tables in local memory (L1 on the cluster) and
+ * must run once before anything else, on one core. The modes that can
+ * run on several cores (cbc_decrypt, ctr) split the blocks in contiguous
+ * ranges over cores 0..nc-1, no synchronization inside: the caller puts a
+ * barrier after them. With nc = 1 they are plain single-core calls.
+ */
+
+#ifndef AES_TT_H
+#define AES_TT_H
+
+#include <stdint.h>
+
+#define AES_TT_BLOCKSIZE  16
+#define AES_TT_MAXROUNDS  14
+
+typedef struct
+{
+    int rounds;
+    uint32_t ek[4*(AES_TT_MAXROUNDS+1)];   /* encryption round keys */
+    uint32_t dk[4*(AES_TT_MAXROUNDS+1)];   /* equivalent inverse cipher */
+} aes_tt_ctx;
+
+void aes_tt_init(void);
+
+/* keybits 128, 192 or 256; returns 0, -1 for any other size */
+int aes_tt_set_key(aes_tt_ctx *ctx, const uint8_t *key, int keybits);
+
+void aes_tt_encrypt(const aes_tt_ctx *ctx, const uint8_t in[16], uint8_t out[16]);
+void aes_tt_decrypt(const aes_tt_ctx *ctx, const uint8_t in[16], uint8_t out[16]);
+
+/* len a multiple of 16; iv is updated to the last ciphertext block */
+void aes_tt_cbc_encrypt(const aes_tt_ctx *ctx, uint8_t iv[16],
+                        const uint8_t *in, uint8_t *out, int len);
+
+/* len a multiple of 16, in and out must not overlap; iv is not updated,
+   the next one is the last block of in */
+void aes_tt_cbc_decrypt(const aes_tt_ctx *ctx, const uint8_t iv[16],
+                        const uint8_t *in, uint8_t *out, int len, int nc);
+
+/* block i uses the 128 bit big endian counter ctr + i; any len, encryption
+   and decryption are the same */
+void aes_tt_ctr(const aes_tt_ctx *ctx, const uint8_t ctr[16],
+                const uint8_t *in, uint8_t *out, int len, int nc);
+
+#endif
@@ -77,6 +77,87 @@ void Process_Descriptor_Bis(unsigned int *Descr, int Size, void action(int index
     }
   }
 }
+#define BIT_SCAN
+#elif !defined(RV_ISA_RV32)
+/*
+ * Xpulp versions: p.ff1 / p.fl1 find the lowest / highest set bit, p.bclrr
+ * clears it and p.cnt counts the bits, so the work is proportional to the
+ * number of set bits instead of 32 tests per word.
+ */
+#define BIT_SCAN
+
+void Process_Descriptor_Bis(unsigned int *Descr, int Size, void action(int index))
+
+{
+  int i;
+
+  for (i=0; i<Size/(sizeof(unsigned int)*8); i++) {
+    unsigned int D = Descr[i];
+    while (D) {
+      int s = __builtin_pulp_ff1(D);
+      action(32*i+s);
+      D = __BITCLR_R(D, 1, s);
+    }
+  }
+}
+
+/* Same actions, highest index first */
+void Process_Descriptor_Rev(unsigned int *Descr, int Size, void action(int index))
+
+{
+  int i;
+
+  for (i=Size/(sizeof(unsigned int)*8)-1; i>=0; i--) {
+    unsigned int D = Descr[i];
+    while (D) {
+      int s = __FL1(D);
+      action(32*i+s);
+      D = __BITCLR_R(D, 1, s);
+    }
+  }
+}
+
+/* Number of set bits */
+int Count_Descriptor(unsigned int *Descr, int Size)
+
+{
+  int i, n = 0;
+
+  for (i=0; i<Size/(sizeof(unsigned int)*8); i++)
+    n += __builtin_pulp_cnt(Descr[i]);
+  return n;
+}
+
+/*
+ * For large bitmaps: the indexes of the set bits are gathered in increasing
+ * order and handed to action in batches of at least BATCH (but the last),
+ * which saves a call per bit. The bit count of the word gives the trip
+ * count of the extraction loop, a hardware loop with no test on the data.
+ */
+#define BATCH 32
+
+void Process_Descriptor_Batch(unsigned int *Descr, int Size, void action(int *index, int n))
+
+{
+  int Index[BATCH+32];
+  int i, k, n = 0;
+
+  for (i=0; i<Size/(sizeof(unsigned int)*8); i++) {
+    unsigned int D = Descr[i];
+    int c = __builtin_pulp_cnt(D);
+    for (k=0; k<c; k++) {
+      int s = __builtin_pulp_ff1(D);
+      Index[n++] = 32*i+s;
+      D = __BITCLR_R(D, 1, s);
+    }
+    if (n >= BATCH) {
+      action(Index, n);
+      n = 0;
+    }
+  }
+  if (n)
+    action(Index, n);
+}
 #endif
 
 
@@ -90,19 +171,74 @@ RT_LOCAL_DATA unsigned int Descr2[8] = {0x55555555, 0x55555555, 0x55555555, 0x55
 RT_LOCAL_DATA unsigned int Descr1[8] = {0xAAAAAAAA, 0xAAAAAAAA, 0xAAAAAAAA, 0xAAAAAAAA, 0xAAAAAAAA, 0xAAAAAAAA, 0xAAAAAAAA, 0xAAAAAAAA};
 RT_LOCAL_DATA unsigned int Descr0[8] = {0,0,0,0,0,0,0,0};
 RT_LOCAL_DATA int Count;
+RT_LOCAL_DATA int Sum;
 
 void signal(int index)
 
 {
   Count = Count + 1;
+  Sum = Sum + index;
 }
 
-void Process(testresult_t *result, char *Mess, unsigned int *Descr, int Descr_Size, unsigned int *cTime, unsigned int *asmTime)
+#if defined(__riscv__) && defined(BIT_SCAN)
+RT_LOCAL_DATA int Last;
+RT_LOCAL_DATA int Unordered;
+
+void signal_batch(int *index, int n)
 
 {
-  int Count_Regular;
+  int k;
+  for (k=0; k<n; k++) {
+    if (index[k] <= Last)
+      Unordered++;
+    Last = index[k];
+    Sum = Sum + index[k];
+  }
+  Count = Count + n;
+}
 
-  Count = 0;
+/* Reverse scan, bit count and batched scan, against the regular version */
+void Process_Riscv(testresult_t *result, char *Mess, unsigned int *Descr, int Descr_Size,
+                   int Count_Regular, int Sum_Regular, unsigned int *batchTime)
+
+{
+  int n;
+
+  Count = 0; Sum = 0;
+  Process_Descriptor_Rev(Descr, Descr_Size, signal);
+  if(Count != Count_Regular || Sum != Sum_Regular) {
+    result->errors += 1;
+  }
+
+  reset_timer();
+  start_timer();
+  n = Count_Descriptor(Descr, Descr_Size);
+  stop_timer();
+  printf("Count:    %s -> %d bits set, %d cycles\n", Mess, n, get_time());
+  if(n != Count_Regular) {
+    result->errors += 1;
+  }
+
+  Count = 0; Sum = 0; Last = -1; Unordered = 0;
+  reset_timer();
+  start_timer();
+  Process_Descriptor_Batch(Descr, Descr_Size, signal_batch);
+  stop_timer();
+  *batchTime += get_time();
+  printf("Nr. cycles: %d\n", get_time());
+  printf("Batched:  %s -> %d actions triggered\n", Mess, Count);
+  if(Count != Count_Regular || Sum != Sum_Regular || Unordered) {
+    result->errors += 1;
+  }
+}
+#endif
+
+void Process(testresult_t *result, char *Mess, unsigned int *Descr, int Descr_Size, unsigned int *cTime, unsigned int *asmTime, unsigned int *batchTime)
+
+{
+  int Count_Regular, Sum_Regular;
+
+  Count = 0; Sum = 0;
   printf("\n==========Process %s Starting==============\n", Mess);
   reset_timer();
   start_timer();
@@ -118,9 +254,10 @@ void Process(testresult_t *result, char *Mess, unsigned int *Descr, int Descr_Si
   printf("Nr. cycles: %d\n", get_time());
   printf("Regular:  %s -> %d actions triggered\n", Mess, Count);
   Count_Regular = Count;
+  Sum_Regular = Sum;
 
-#ifndef __riscv__
-  Count = 0;
+#ifdef BIT_SCAN
+  Count = 0; Sum = 0;
   reset_timer();
   start_timer();
   Process_Descriptor_Bis(Descr, Descr_Size, signal);
@@ -129,16 +266,24 @@ void Process(testresult_t *result, char *Mess, unsigned int *Descr, int Descr_Si
   printf("Nr. cycles: %d\n", get_time());
   printf("Optimized:%s -> %d actions triggered\n", Mess, Count);
 
-  if(Count != Count_Regular) {
+  if(Count != Count_Regular || Sum != Sum_Regular) {
     result->errors += 1;
   }
 #endif
+
+#if defined(__riscv__) && defined(BIT_SCAN)
+  Process_Riscv(result, Mess, Descr, Descr_Size, Count_Regular, Sum_Regular, batchTime);
+#endif
 }
 
 void check_bit(testresult_t *result, void (*start)(), void (*stop)());
+void check_bit_large(testresult_t *result, void (*start)(), void (*stop)());
 
 testcase_t testcases[] = {
   { .name = "bit",          .test = check_bit          },
+#if defined(__riscv__) && defined(BIT_SCAN)
+  { .name = "bit_large",    .test = check_bit_large    },
+#endif
   {0, 0}
 };
 
@@ -155,22 +300,62 @@ void check_bit(testresult_t *result, void (*start)(), void (*stop)()) {
   Count = 0;
   if(get_core_id() == 0) {
     int Descr_Size = 256;
-    unsigned int cTime = 0, asmTime = 0;
+    unsigned int cTime = 0, asmTime = 0, batchTime = 0;
     start();
     perf_stop();
-    Process(result, "All 0", Descr0, Descr_Size, &cTime, &asmTime);
-    Process(result, "All 1", Descr4, Descr_Size, &cTime, &asmTime);
-    Process(result, "Alternate 1/0", Descr1, Descr_Size, &cTime, &asmTime);
-    Process(result, "Alternate 0/1", Descr2, Descr_Size, &cTime, &asmTime);
-    Process(result, "Half 1 then half 0", Descr6, Descr_Size, &cTime, &asmTime);
-    Process(result, "Half 0 then half 1", Descr5, Descr_Size, &cTime, &asmTime);
-    Process(result, "25% 1, 75% 0", Descr7, Descr_Size, &cTime, &asmTime);
-    Process(result, "75% 1, 25% 0", Descr8, Descr_Size, &cTime, &asmTime);
-    Process(result, "Random", Descr3, Descr_Size, &cTime, &asmTime);
+    Process(result, "All 0", Descr0, Descr_Size, &cTime, &asmTime, &batchTime);
+    Process(result, "All 1", Descr4, Descr_Size, &cTime, &asmTime, &batchTime);
+    Process(result, "Alternate 1/0", Descr1, Descr_Size, &cTime, &asmTime, &batchTime);
+    Process(result, "Alternate 0/1", Descr2, Descr_Size, &cTime, &asmTime, &batchTime);
+    Process(result, "Half 1 then half 0", Descr6, Descr_Size, &cTime, &asmTime, &batchTime);
+    Process(result, "Half 0 then half 1", Descr5, Descr_Size, &cTime, &asmTime, &batchTime);
+    Process(result, "25% 1, 75% 0", Descr7, Descr_Size, &cTime, &asmTime, &batchTime);
+    Process(result, "75% 1, 25% 0", Descr8, Descr_Size, &cTime, &asmTime, &batchTime);
+    Process(result, "Random", Descr3, Descr_Size, &cTime, &asmTime, &batchTime);
     stop();
     printf("C version cycles: %d\n", cTime);
     printf("ASM version cycles: %d\n", asmTime);
+#if defined(__riscv__) && defined(BIT_SCAN)
+    printf("Batched version cycles: %d\n", batchTime);
+#endif
 
     printf("#Errors: %d\n", g_errors);
   }
 }
+
+#if defined(__riscv__) && defined(BIT_SCAN)
+/* 8192 bit maps, about 3% and 90% of the bits set */
+#define LARGE_SIZE 8192
+
+RT_LOCAL_DATA unsigned int Large[LARGE_SIZE/32];
+
+void Fill_Large(int Per_256)
+
+{
+  unsigned int seed = 0x13579bdf;
+  int i;
+
+  for (i=0; i<LARGE_SIZE; i++) {
+    seed = seed * 1103515245 + 12345;
+    if (((seed >> 16) & 0xFF) < Per_256)
+      Large[i/32] = BIT_S(Large[i/32], i%32);
+    else
+      Large[i/32] = BIT_C(Large[i/32], i%32);
+  }
+}
+
+void check_bit_large(testresult_t *result, void (*start)(), void (*stop)()) {
+  unsigned int cTime = 0, asmTime = 0, batchTime = 0;
+
+  Fill_Large(8);
+  Process(result, "Large sparse", Large, LARGE_SIZE, &cTime, &asmTime, &batchTime);
+  Fill_Large(230);
+  start();
+  Process(result, "Large dense", Large, LARGE_SIZE, &cTime, &asmTime, &batchTime);
+  stop();
+
+  printf("Large set, C cycles: %d\n", cTime);
+  printf("Large set, ASM cycles: %d\n", asmTime);
+  printf("Large set, batched cycles: %d\n", batchTime);
+}
+#endif
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/* generated by gen_twiddles.py, do not edit */
+#include <stdint.h>
+#include "kiss_fftr.h"
+#include "kiss_fft.h"
+#include "_kiss_fft_guts.h"
+#include "pulp.h"
+
+// copied from fft_precomputed.c
+struct __attribute__((__packed__)) kiss_fft_state_precomputed{
+    int nfft;
+    int inverse;
+    int factors[2*MAXFACTORS];
+    kiss_fft_cpx twiddles[256];
+};
+
+RT_LOCAL_DATA struct kiss_fft_state_precomputed g_bench_state_radix2 __attribute__((aligned(4))) = {128, 0, {2, 64, 2, 32, 2, 16, 2, 8, 2, 4, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {{32767, 0}, {32728, -1608}, {32609, -3212}, {32412, -4808}, {32137, -6393}, {31785, -7962}, {31356, -9512}, {30852, -11039}, {30273, -12539}, {29621, -14010}, {28898, -15446}, {28105, -16846}, {27245, -18204}, {26319, -19519}, {25329, -20787}, {24279, -22005}, {23170, -23170}, {22005, -24279}, {20787, -25329}, {19519, -26319}, {18204, -27245}, {16846, -28105}, {15446, -28898}, {14010, -29621}, {12539, -30273}, {11039, -30852}, {9512, -31356}, {7962, -31785}, {6393, -32137}, {4808, -32412}, {3212, -32609}, {1608, -32728}, {0, -32767}, {-1608, -32728}, {-3212, -32609}, {-4808, -32412}, {-6393, -32137}, {-7962, -31785}, {-9512, -31356}, {-11039, -30852}, {-12539, -30273}, {-14010, -29621}, {-15446, -28898}, {-16846, -28105}, {-18204, -27245}, {-19519, -26319}, {-20787, -25329}, {-22005, -24279}, {-23170, -23170}, {-24279, -22005}, {-25329, -20787}, {-26319, -19519}, {-27245, -18204}, {-28105, -16846}, {-28898, -15446}, {-29621, -14010}, {-30273, -12539}, {-30852, -11039}, {-31356, -9512}, {-31785, -7962}, {-32137, -6393}, {-32412, -4808}, {-32609, -3212}, {-32728, -1608}, {-32767, 0}, {-32728, 1608}, {-32609, 3212}, {-32412, 4808}, {-32137, 6393}, {-31785, 7962}, {-31356, 9512}, {-30852, 11039}, {-30273, 12539}, {-29621, 14010}, {-28898, 15446}, {-28105, 16846}, {-27245, 18204}, {-26319, 19519}, {-25329, 20787}, {-24279, 22005}, {-23170, 23170}, {-22005, 24279}, {-20787, 25329}, {-19519, 26319}, {-18204, 27245}, {-16846, 28105}, {-15446, 28898}, {-14010, 29621}, {-12539, 30273}, {-11039, 30852}, {-9512, 31356}, {-7962, 31785}, {-6393, 32137}, {-4808, 32412}, {-3212, 32609}, {-1608, 32728}, {0, 32767}, {1608, 32728}, {3212, 32609}, {4808, 32412}, {6393, 32137}, {7962, 31785}, {9512, 31356}, {11039, 30852}, {12539, 30273}, {14010, 29621}, {15446, 28898}, {16846, 28105}, {18204, 27245}, {19519, 26319}, {20787, 25329}, {22005, 24279}, {23170, 23170}, {24279, 22005}, {25329, 20787}, {26319, 19519}, {27245, 18204}, {28105, 16846}, {28898, 15446}, {29621, 14010}, {30273, 12539}, {30852, 11039}, {31356, 9512}, {31785, 7962}, {32137, 6393}, {32412, 4808}, {32609, 3212}, {32728, 1608}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}}};
+
+RT_LOCAL_DATA struct kiss_fft_state_precomputed g_bench_state_radix3 __attribute__((aligned(4))) = {243, 0, {3, 81, 3, 27, 3, 9, 3, 3, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {{32767, 0}, {32756, -847}, {32723, -1694}, {32668, -2539}, {32592, -3383}, {32494, -4224}, {32373, -5063}, {32232, -5898}, {32068, -6730}, {31884, -7557}, {31678, -8378}, {31451, -9195}, {31202, -10005}, {30933, -10808}, {30643, -11604}, {30333, -12392}, {30003, -13173}, {29652, -13944}, {29282, -14706}, {28892, -15458}, {28482, -16200}, {28054, -16931}, {27607, -17650}, {27141, -18358}, {26658, -19054}, {26156, -19737}, {25637, -20406}, {25101, -21062}, {24548, -21704}, {23979, -22332}, {23393, -22944}, {22792, -23541}, {22176, -24123}, {21545, -24688}, {20900, -25237}, {20240, -25769}, {19567, -26283}, {18881, -26780}, {18182, -27259}, {17472, -27720}, {16749, -28163}, {16015, -28586}, {15271, -28991}, {14516, -29376}, {13752, -29742}, {12978, -30087}, {12196, -30413}, {11406, -30718}, {10608, -31002}, {9803, -31266}, {8991, -31509}, {8173, -31731}, {7350, -31932}, {6522, -32111}, {5690, -32269}, {4854, -32406}, {4014, -32520}, {3172, -32613}, {2328, -32684}, {1482, -32733}, {635, -32761}, {-212, -32766}, {-1059, -32750}, {-1905, -32712}, {-2750, -32651}, {-3594, -32569}, {-4434, -32466}, {-5272, -32340}, {-6107, -32193}, {-6937, -32024}, {-7763, -31834}, {-8583, -31623}, {-9398, -31390}, {-10206, -31137}, {-11008, -30863}, {-11802, -30568}, {-12588, -30252}, {-13366, -29917}, {-14135, -29561}, {-14895, -29186}, {-15644, -28791}, {-16383, -28377}, {-17112, -27944}, {-17828, -27492}, {-18533, -27022}, {-19226, -26534}, {-19905, -26028}, {-20572, -25505}, {-21224, -24964}, {-21862, -24407}, {-22486, -23834}, {-23095, -23245}, {-23688, -22640}, {-24265, -22020}, {-24827, -21385}, {-25371, -20736}, {-25899, -20073}, {-26409, -19397}, {-26902, -18708}, {-27376, -18006}, {-27833, -17292}, {-28271, -16567}, {-28689, -15830}, {-29089, -15083}, {-29469, -14326}, {-29830, -13559}, {-30170, -12784}, {-30491, -11999}, {-30791, -11207}, {-31070, -10407}, {-31329, -9600}, {-31567, -8787}, {-31783, -7968}, {-31979, -7144}, {-32153, -6315}, {-32305, -5481}, {-32436, -4644}, {-32545, -3804}, {-32633, -2961}, {-32699, -2117}, {-32742, -1271}, {-32764, -424}, {-32764, 424}, {-32742, 1271}, {-32699, 2117}, {-32633, 2961}, {-32545, 3804}, {-32436, 4644}, {-32305, 5481}, {-32153, 6315}, {-31979, 7144}, {-31783, 7968}, {-31567, 8787}, {-31329, 9600}, {-31070, 10407}, {-30791, 11207}, {-30491, 11999}, {-30170, 12784}, {-29830, 13559}, {-29469, 14326}, {-29089, 15083}, {-28689, 15830}, {-28271, 16567}, {-27833, 17292}, {-27376, 18006}, {-26902, 18708}, {-26409, 19397}, {-25899, 20073}, {-25371, 20736}, {-24827, 21385}, {-24265, 22020}, {-23688, 22640}, {-23095, 23245}, {-22486, 23834}, {-21862, 24407}, {-21224, 24964}, {-20572, 25505}, {-19905, 26028}, {-19226, 26534}, {-18533, 27022}, {-17828, 27492}, {-17112, 27944}, {-16384, 28377}, {-15644, 28791}, {-14895, 29186}, {-14135, 29561}, {-13366, 29917}, {-12588, 30252}, {-11802, 30568}, {-11008, 30863}, {-10206, 31137}, {-9398, 31390}, {-8583, 31623}, {-7763, 31834}, {-6937, 32024}, {-6107, 32193}, {-5272, 32340}, {-4434, 32466}, {-3594, 32569}, {-2750, 32651}, {-1905, 32712}, {-1059, 32750}, {-212, 32766}, {635, 32761}, {1482, 32733}, {2328, 32684}, {3172, 32613}, {4014, 32520}, {4854, 32406}, {5690, 32269}, {6522, 32111}, {7350, 31932}, {8173, 31731}, {8991, 31509}, {9803, 31266}, {10608, 31002}, {11406, 30718}, {12196, 30413}, {12978, 30087}, {13752, 29742}, {14516, 29376}, {15271, 28991}, {16015, 28586}, {16749, 28163}, {17472, 27720}, {18182, 27259}, {18881, 26780}, {19567, 26283}, {20240, 25769}, {20900, 25237}, {21545, 24688}, {22176, 24123}, {22792, 23541}, {23393, 22944}, {23979, 22332}, {24548, 21704}, {25101, 21062}, {25637, 20406}, {26156, 19737}, {26658, 19054}, {27141, 18358}, {27607, 17650}, {28054, 16931}, {28482, 16200}, {28892, 15458}, {29282, 14706}, {29652, 13944}, {30003, 13173}, {30333, 12392}, {30643, 11604}, {30933, 10808}, {31202, 10005}, {31451, 9195}, {31678, 8378}, {31884, 7557}, {32068, 6730}, {32232, 5898}, {32373, 5063}, {32494, 4224}, {32592, 3383}, {32668, 2539}, {32723, 1694}, {32756, 847}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}}};
+
+RT_LOCAL_DATA struct kiss_fft_state_precomputed g_bench_state_radix4 __attribute__((aligned(4))) = {256, 0, {4, 64, 4, 16, 4, 4, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {{32767, 0}, {32757, -804}, {32728, -1608}, {32678, -2410}, {32609, -3212}, {32521, -4011}, {32412, -4808}, {32285, -5602}, {32137, -6393}, {31971, -7179}, {31785, -7962}, {31580, -8739}, {31356, -9512}, {31113, -10278}, {30852, -11039}, {30571, -11793}, {30273, -12539}, {29956, -13279}, {29621, -14010}, {29268, -14732}, {28898, -15446}, {28510, -16151}, {28105, -16846}, {27683, -17530}, {27245, -18204}, {26790, -18868}, {26319, -19519}, {25832, -20159}, {25329, -20787}, {24811, -21403}, {24279, -22005}, {23731, -22594}, {23170, -23170}, {22594, -23731}, {22005, -24279}, {21403, -24811}, {20787, -25329}, {20159, -25832}, {19519, -26319}, {18868, -26790}, {18204, -27245}, {17530, -27683}, {16846, -28105}, {16151, -28510}, {15446, -28898}, {14732, -29268}, {14010, -29621}, {13279, -29956}, {12539, -30273}, {11793, -30571}, {11039, -30852}, {10278, -31113}, {9512, -31356}, {8739, -31580}, {7962, -31785}, {7179, -31971}, {6393, -32137}, {5602, -32285}, {4808, -32412}, {4011, -32521}, {3212, -32609}, {2410, -32678}, {1608, -32728}, {804, -32757}, {0, -32767}, {-804, -32757}, {-1608, -32728}, {-2410, -32678}, {-3212, -32609}, {-4011, -32521}, {-4808, -32412}, {-5602, -32285}, {-6393, -32137}, {-7179, -31971}, {-7962, -31785}, {-8739, -31580}, {-9512, -31356}, {-10278, -31113}, {-11039, -30852}, {-11793, -30571}, {-12539, -30273}, {-13279, -29956}, {-14010, -29621}, {-14732, -29268}, {-15446, -28898}, {-16151, -28510}, {-16846, -28105}, {-17530, -27683}, {-18204, -27245}, {-18868, -26790}, {-19519, -26319}, {-20159, -25832}, {-20787, -25329}, {-21403, -24811}, {-22005, -24279}, {-22594, -23731}, {-23170, -23170}, {-23731, -22594}, {-24279, -22005}, {-24811, -21403}, {-25329, -20787}, {-25832, -20159}, {-26319, -19519}, {-26790, -18868}, {-27245, -18204}, {-27683, -17530}, {-28105, -16846}, {-28510, -16151}, {-28898, -15446}, {-29268, -14732}, {-29621, -14010}, {-29956, -13279}, {-30273, -12539}, {-30571, -11793}, {-30852, -11039}, {-31113, -10278}, {-31356, -9512}, {-31580, -8739}, {-31785, -7962}, {-31971, -7179}, {-32137, -6393}, {-32285, -5602}, {-32412, -4808}, {-32521, -4011}, {-32609, -3212}, {-32678, -2410}, {-32728, -1608}, {-32757, -804}, {-32767, 0}, {-32757, 804}, {-32728, 1608}, {-32678, 2410}, {-32609, 3212}, {-32521, 4011}, {-32412, 4808}, {-32285, 5602}, {-32137, 6393}, {-31971, 7179}, {-31785, 7962}, {-31580, 8739}, {-31356, 9512}, {-31113, 10278}, {-30852, 11039}, {-30571, 11793}, {-30273, 12539}, {-29956, 13279}, {-29621, 14010}, {-29268, 14732}, {-28898, 15446}, {-28510, 16151}, {-28105, 16846}, {-27683, 17530}, {-27245, 18204}, {-26790, 18868}, {-26319, 19519}, {-25832, 20159}, {-25329, 20787}, {-24811, 21403}, {-24279, 22005}, {-23731, 22594}, {-23170, 23170}, {-22594, 23731}, {-22005, 24279}, {-21403, 24811}, {-20787, 25329}, {-20159, 25832}, {-19519, 26319}, {-18868, 26790}, {-18204, 27245}, {-17530, 27683}, {-16846, 28105}, {-16151, 28510}, {-15446, 28898}, {-14732, 29268}, {-14010, 29621}, {-13279, 29956}, {-12539, 30273}, {-11793, 30571}, {-11039, 30852}, {-10278, 31113}, {-9512, 31356}, {-8739, 31580}, {-7962, 31785}, {-7179, 31971}, {-6393, 32137}, {-5602, 32285}, {-4808, 32412}, {-4011, 32521}, {-3212, 32609}, {-2410, 32678}, {-1608, 32728}, {-804, 32757}, {0, 32767}, {804, 32757}, {1608, 32728}, {2410, 32678}, {3212, 32609}, {4011, 32521}, {4808, 32412}, {5602, 32285}, {6393, 32137}, {7179, 31971}, {7962, 31785}, {8739, 31580}, {9512, 31356}, {10278, 31113}, {11039, 30852}, {11793, 30571}, {12539, 30273}, {13279, 29956}, {14010, 29621}, {14732, 29268}, {15446, 28898}, {16151, 28510}, {16846, 28105}, {17530, 27683}, {18204, 27245}, {18868, 26790}, {19519, 26319}, {20159, 25832}, {20787, 25329}, {21403, 24811}, {22005, 24279}, {22594, 23731}, {23170, 23170}, {23731, 22594}, {24279, 22005}, {24811, 21403}, {25329, 20787}, {25832, 20159}, {26319, 19519}, {26790, 18868}, {27245, 18204}, {27683, 17530}, {28105, 16846}, {28510, 16151}, {28898, 15446}, {29268, 14732}, {29621, 14010}, {29956, 13279}, {30273, 12539}, {30571, 11793}, {30852, 11039}, {31113, 10278}, {31356, 9512}, {31580, 8739}, {31785, 7962}, {31971, 7179}, {32137, 6393}, {32285, 5602}, {32412, 4808}, {32521, 4011}, {32609, 3212}, {32678, 2410}, {32728, 1608}, {32757, 804}}};
+
+RT_LOCAL_DATA struct kiss_fft_state_precomputed g_bench_state_radix5 __attribute__((aligned(4))) = {125, 0, {5, 25, 5, 5, 5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {{32767, 0}, {32726, -1646}, {32602, -3289}, {32395, -4922}, {32107, -6544}, {31738, -8149}, {31288, -9733}, {30759, -11293}, {30153, -12824}, {29471, -14323}, {28714, -15786}, {27885, -17208}, {26985, -18588}, {26017, -19920}, {24983, -21202}, {23886, -22431}, {22729, -23602}, {21514, -24715}, {20245, -25764}, {18925, -26749}, {17557, -27666}, {16145, -28513}, {14692, -29289}, {13202, -29990}, {11679, -30615}, {10126, -31163}, {8547, -31633}, {6947, -32022}, {5329, -32331}, {3698, -32558}, {2057, -32702}, {412, -32764}, {-1235, -32744}, {-2879, -32640}, {-4515, -32454}, {-6140, -32187}, {-7749, -31837}, {-9339, -31408}, {-10905, -30899}, {-12444, -30312}, {-13952, -29648}, {-15424, -28910}, {-16857, -28099}, {-18247, -27216}, {-19592, -26265}, {-20886, -25247}, {-22129, -24166}, {-23315, -23024}, {-24442, -21823}, {-25508, -20568}, {-26509, -19260}, {-27443, -17904}, {-28308, -16502}, {-29102, -15059}, {-29821, -13578}, {-30466, -12062}, {-31034, -10516}, {-31523, -8944}, {-31932, -7349}, {-32261, -5735}, {-32509, -4107}, {-32674, -2468}, {-32757, -823}, {-32757, 823}, {-32674, 2468}, {-32509, 4107}, {-32261, 5735}, {-31932, 7349}, {-31523, 8944}, {-31034, 10516}, {-30466, 12062}, {-29821, 13578}, {-29102, 15059}, {-28308, 16502}, {-27443, 17904}, {-26509, 19260}, {-25508, 20568}, {-24442, 21823}, {-23315, 23024}, {-22129, 24166}, {-20886, 25247}, {-19592, 26265}, {-18247, 27216}, {-16857, 28099}, {-15424, 28910}, {-13952, 29648}, {-12444, 30312}, {-10905, 30899}, {-9339, 31408}, {-7749, 31837}, {-6140, 32187}, {-4515, 32454}, {-2879, 32640}, {-1235, 32744}, {412, 32764}, {2057, 32702}, {3698, 32558}, {5329, 32331}, {6947, 32022}, {8547, 31633}, {10126, 31163}, {11679, 30615}, {13202, 29990}, {14692, 29289}, {16145, 28513}, {17557, 27666}, {18925, 26749}, {20245, 25764}, {21514, 24715}, {22729, 23602}, {23886, 22431}, {24983, 21202}, {26017, 19920}, {26985, 18588}, {27885, 17208}, {28714, 15786}, {29471, 14323}, {30153, 12824}, {30759, 11293}, {31288, 9733}, {31738, 8149}, {32107, 6544}, {32395, 4922}, {32602, 3289}, {32726, 1646}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}}};
+
+kiss_fft_cfg g_bench_cfg[4] = {(kiss_fft_cfg)&g_bench_state_radix2, (kiss_fft_cfg)&g_bench_state_radix3,
+                              (kiss_fft_cfg)&g_bench_state_radix4, (kiss_fft_cfg)&g_bench_state_radix5};
@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+
+# Generates the precomputed kiss_fft states used by the packed (SIMD=1)
+# build and by the per-radix benchmark, with the same Q15 rounding as
+# kiss_fft_alloc(): floor(.5 + 32767*cos(phase)).
+
+import math
+
+SAMP_MAX = 32767
+
+LICENSE = '''/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+/* generated by gen_twiddles.py, do not edit */
+#include <stdint.h>
+#include "kiss_fftr.h"
+#include "kiss_fft.h"
+#include "_kiss_fft_guts.h"
+#include "pulp.h"
+
+// copied from fft_precomputed.c
+struct __attribute__((__packed__)) kiss_fft_state_precomputed{
+    int nfft;
+    int inverse;
+    int factors[2*MAXFACTORS];
+    kiss_fft_cpx twiddles[256];
+};
+
+'''
+
+
+def cexp(phase):
+    return (int(math.floor(.5 + SAMP_MAX * math.cos(phase))),
+            int(math.floor(.5 + SAMP_MAX * math.sin(phase))))
+
+
+def factors(n, radix):
+    f = []
+    while n > 1:
+        n //= radix
+        f += [radix, n]
+    return f + [0] * (64 - len(f))
+
+
+def cpx_list(vals, length):
+    vals = vals + [(0, 0)] * (length - len(vals))
+    return ', '.join('{%d, %d}' % v for v in vals)
+
+
+def state(name, nfft, inverse, radix):
+    tw = []
+    for i in range(nfft):
+        phase = -2 * math.pi * i / nfft
+        if inverse:
+            phase = -phase
+        tw.append(cexp(phase))
+    return ('RT_LOCAL_DATA struct kiss_fft_state_precomputed %s __attribute__((aligned(4))) = {%d, %d, {%s}, {%s}};\n\n'
+            % (name, nfft, inverse, ', '.join(str(x) for x in factors(nfft, radix)), cpx_list(tw, 256)))
+
+
+################################################################################
+# 512 point real FFT/IFFT of main.c, 256 point complex substate, in L1
+
+f = open('fft_precomputed_v2s.c', 'w')
+f.write(LICENSE)
+f.write('''// copied from kiss_fftr.c
+struct __attribute__((__packed__)) kiss_fftr_state {
+    kiss_fft_cfg substate;
+    kiss_fft_cpx * tmpbuf;
+    kiss_fft_cpx * super_twiddles;
+};
+
+''')
+
+for inverse, prefix in [(0, 'g_fft'), (1, 'g_ifft')]:
+    f.write(state(prefix + '_state', 256, inverse, 4))
+    sup = []
+    for i in range(128):
+        phase = -math.pi * ((i + 1) / 256.0 + .5)
+        if inverse:
+            phase = -phase
+        sup.append(cexp(phase))
+    f.write('RT_LOCAL_DATA kiss_fft_cpx %sr_state_tmpbuf[512] __attribute__((aligned(4)));\n' % prefix)
+    f.write('RT_LOCAL_DATA kiss_fft_cpx %sr_state_super_twiddles[256] __attribute__((aligned(4))) = {%s};\n\n'
+            % (prefix, cpx_list(sup, 256)))
+    f.write('struct kiss_fftr_state %sr_state = {(kiss_fft_cfg)&%s_state, %sr_state_tmpbuf, %sr_state_super_twiddles};\n\n'
+            % (prefix, prefix, prefix, prefix))
+f.close()
+
+################################################################################
+# one forward state per radix for the benchmark, a single radix per state
+
+f = open('fft_precomputed_bench.c', 'w')
+f.write(LICENSE)
+for radix, nfft in [(2, 128), (3, 243), (4, 256), (5, 125)]:
+    f.write(state('g_bench_state_radix%d' % radix, nfft, 0, radix))
+f.write('kiss_fft_cfg g_bench_cfg[4] = {(kiss_fft_cfg)&g_bench_state_radix2, (kiss_fft_cfg)&g_bench_state_radix3,\n'
+        '                              (kiss_fft_cfg)&g_bench_state_radix4, (kiss_fft_cfg)&g_bench_state_radix5};\n')
+f.close()
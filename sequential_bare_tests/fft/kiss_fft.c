@@ -21,6 +21,172 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
  fixed or floating point complex numbers.  It also delares the kf_ internal functions.
  */
 
+#ifdef KISS_FFT_V2S
+/* Q15 butterflies on packed {r, i} pairs. The 1/p scaling of C_FIXDIV is
+   folded in the complex multiplications: pv.cplxmul div2/div4 for radix 2
+   and 4, twiddles scaled by {SAMP_MAX/p, 0} for radix 3 and 5. Products are
+   truncated instead of rounded, so results may differ from the scalar
+   butterflies by a few LSB. Twiddles and buffers must be word aligned. */
+
+#ifndef ARCHI_CORE_HAS_CPLX
+/* cores without the complex extension, same results as the instructions */
+#define __CPLXMULS(x, y)      ((v2s) {(signed short) ((((int) (x)[0]*(int) (y)[0]) - ((int) (x)[1]*(int) (y)[1])) >> 15), \
+                                      (signed short) ((((int) (x)[0]*(int) (y)[1]) + ((int) (x)[1]*(int) (y)[0])) >> 15)})
+#define __CPLXMULSDIV2(x, y)  (__CPLXMULS(x, y) >> (v2s) {1, 1})
+#define __CPLXMULSDIV4(x, y)  (__CPLXMULS(x, y) >> (v2s) {2, 2})
+#define __SUB2ROTMJ(x, y)     ((v2s) {(x)[1]-(y)[1], (y)[0]-(x)[0]})
+#endif
+
+static void kf_bfly2(
+        kiss_fft_cpx * Fout,
+        const size_t fstride,
+        const kiss_fft_cfg st,
+        int m
+        )
+{
+    v2s * F = (v2s *) Fout;
+    v2s * F2 = F + m;
+    v2s * tw = (v2s *) st->twiddles;
+    do{
+        v2s a = *F >> (v2s) {1, 1};
+        v2s t = __CPLXMULSDIV2(*F2, *tw);
+        tw += fstride;
+        *F2++ = a - t;
+        *F++ = a + t;
+    }while (--m);
+}
+
+static void kf_bfly4(
+        kiss_fft_cpx * Fout,
+        const size_t fstride,
+        const kiss_fft_cfg st,
+        const size_t m
+        )
+{
+    v2s * F = (v2s *) Fout;
+    v2s *tw1,*tw2,*tw3;
+    size_t k=m;
+    const size_t m2=2*m;
+    const size_t m3=3*m;
+    const int inverse = st->inverse;
+
+    tw3 = tw2 = tw1 = (v2s *) st->twiddles;
+
+    do {
+        v2s a  = F[0] >> (v2s) {2, 2};
+        v2s s0 = __CPLXMULSDIV4(F[m], *tw1);
+        v2s s1 = __CPLXMULSDIV4(F[m2], *tw2);
+        v2s s2 = __CPLXMULSDIV4(F[m3], *tw3);
+        v2s s3 = s0 + s2;
+        v2s s5 = a - s1;
+        /* -j*(s0-s2) forward, +j*(s0-s2) inverse */
+        v2s r  = inverse ? __SUB2ROTMJ(s2, s0) : __SUB2ROTMJ(s0, s2);
+
+        a += s1;
+        tw1 += fstride;
+        tw2 += fstride*2;
+        tw3 += fstride*3;
+
+        F[m2] = a - s3;
+        F[0]  = a + s3;
+        F[m]  = s5 + r;
+        F[m3] = s5 - r;
+        ++F;
+    }while(--k);
+}
+
+static void kf_bfly3(
+         kiss_fft_cpx * Fout,
+         const size_t fstride,
+         const kiss_fft_cfg st,
+         size_t m
+         )
+{
+     v2s * F = (v2s *) Fout;
+     size_t k=m;
+     const size_t m2 = 2*m;
+     v2s *tw1,*tw2;
+     const v2s third = {SAMP_MAX/3, 0};
+     /* s0*epi3.i rotated by -j, in a single product */
+     const v2s epi3j = {0, -st->twiddles[fstride*m].i};
+
+     tw1=tw2=(v2s *) st->twiddles;
+
+     do{
+         v2s a  = __CPLXMULS(F[0], third);
+         v2s s1 = __CPLXMULS(F[m], __CPLXMULS(*tw1, third));
+         v2s s2 = __CPLXMULS(F[m2], __CPLXMULS(*tw2, third));
+         v2s s3 = s1 + s2;
+         v2s r  = __CPLXMULS(s1 - s2, epi3j);
+         v2s b  = a - (s3 >> (v2s) {1, 1});
+
+         tw1 += fstride;
+         tw2 += fstride*2;
+
+         F[0]  = a + s3;
+         F[m2] = b + r;
+         F[m]  = b - r;
+         ++F;
+     }while(--k);
+}
+
+static void kf_bfly5(
+        kiss_fft_cpx * Fout,
+        const size_t fstride,
+        const kiss_fft_cfg st,
+        int m
+        )
+{
+    v2s *F0,*F1,*F2,*F3,*F4;
+    int u;
+    v2s * tw = (v2s *) st->twiddles;
+    kiss_fft_cpx ya,yb;
+    const v2s fifth = {SAMP_MAX/5, 0};
+    v2s yar, ybr, yaj, ybj, myaj, mybj;
+
+    ya = st->twiddles[fstride*m];
+    yb = st->twiddles[fstride*2*m];
+    /* real scalings by ya.r, yb.r and rotations j*ya.i, j*yb.i as products */
+    yar  = (v2s) {ya.r, 0};
+    ybr  = (v2s) {yb.r, 0};
+    yaj  = (v2s) {0, ya.i};
+    ybj  = (v2s) {0, yb.i};
+    myaj = (v2s) {0, -ya.i};
+    mybj = (v2s) {0, -yb.i};
+
+    F0=(v2s *) Fout;
+    F1=F0+m;
+    F2=F0+2*m;
+    F3=F0+3*m;
+    F4=F0+4*m;
+
+    for ( u=0; u<m; ++u ) {
+        v2s s0  = __CPLXMULS(*F0, fifth);
+        v2s s1  = __CPLXMULS(*F1, __CPLXMULS(tw[u*fstride], fifth));
+        v2s s2  = __CPLXMULS(*F2, __CPLXMULS(tw[2*u*fstride], fifth));
+        v2s s3  = __CPLXMULS(*F3, __CPLXMULS(tw[3*u*fstride], fifth));
+        v2s s4  = __CPLXMULS(*F4, __CPLXMULS(tw[4*u*fstride], fifth));
+        v2s s7  = s1 + s4;
+        v2s s10 = s1 - s4;
+        v2s s8  = s2 + s3;
+        v2s s9  = s2 - s3;
+        v2s s5  = s0 + __CPLXMULS(s7, yar) + __CPLXMULS(s8, ybr);
+        v2s s6  = __CPLXMULS(s10, myaj) + __CPLXMULS(s9, mybj);
+        v2s s11 = s0 + __CPLXMULS(s7, ybr) + __CPLXMULS(s8, yar);
+        v2s s12 = __CPLXMULS(s10, ybj) + __CPLXMULS(s9, myaj);
+
+        *F0 = s0 + s7 + s8;
+        *F1 = s5 - s6;
+        *F4 = s5 + s6;
+        *F2 = s11 + s12;
+        *F3 = s11 - s12;
+
+        ++F0;++F1;++F2;++F3;++F4;
+    }
+}
+
+#else
+
 static void kf_bfly2(
         kiss_fft_cpx * Fout,
         const size_t fstride,
@@ -197,6 +363,8 @@ static void kf_bfly5(
     }
 }
 
+#endif
+
 /* perform the butterfly for one stage of a mixed radix FFT */
 static void kf_bfly_generic(
         kiss_fft_cpx * Fout,
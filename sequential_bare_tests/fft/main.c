@@ -30,9 +30,26 @@
 
 extern struct kiss_fftr_state g_fftr_state;
 extern struct kiss_fftr_state g_ifftr_state;
+extern kiss_fft_cfg g_bench_cfg[4];
 
-RT_LOCAL_DATA kiss_fft_cpx freq[257];
-RT_LOCAL_DATA int16_t buffer_out[516];
+// the packed butterflies truncate instead of rounding, allowed error in LSB
+#ifdef KISS_FFT_V2S
+#define RESP_TOL 8
+#else
+#define RESP_TOL 0
+#endif
+
+// per-radix benchmark: tone of amplitude BENCH_AMP at bin BENCH_BIN
+#define BENCH_AMP 16384
+#define BENCH_BIN 5
+#define BENCH_TOL 16
+
+RT_LOCAL_DATA kiss_fft_cpx freq[257] __attribute__((aligned(4)));
+RT_LOCAL_DATA int16_t buffer_out[516] __attribute__((aligned(4)));
+RT_LOCAL_DATA kiss_fft_cpx bench_in[256] __attribute__((aligned(4)));
+RT_LOCAL_DATA kiss_fft_cpx bench_out[256] __attribute__((aligned(4)));
+
+static unsigned int bench_radix();
 
 //--------------------------------------------------------------------------
 // main function
@@ -66,7 +83,8 @@ int main() {
   if(core_id == 0) {
     // now check the responses
     for(i = 0; i < 512; i++) {
-      if((buffer_out[i] & 0xFFFF) != (g_expresp[i] & 0xFFFF)) {
+      int diff = buffer_out[i] - g_expresp[i];
+      if(diff > RESP_TOL || diff < -RESP_TOL) {
         errors++;
         printf("Error: Is %X, expected %X, at %X\n", buffer_out[i], g_expresp[i], &g_expresp[i]);
       }
@@ -74,6 +92,8 @@ int main() {
 
     printf("#Cycles 0, %d\n", get_time());
 
+    errors += bench_radix();
+
     if(errors) {
       printf("Core %d, %d errors found\n", core_id, errors);
       printf("NOT OK!!!!!\n");
@@ -86,3 +106,48 @@ int main() {
 
   return errors;
 }
+
+//--------------------------------------------------------------------------
+// one complex FFT per radix, each state uses a single radix
+//--------------------------------------------------------------------------
+static unsigned int bench_radix() {
+  unsigned int errors = 0;
+  int r;
+
+  for(r = 0; r < 4; r++) {
+    kiss_fft_cfg st = g_bench_cfg[r];
+    int n = st->nfft;
+    int p = st->factors[0];
+    int stages = 0;
+    int m, i, err = 0, cycles;
+
+    for(m = n; m > 1; m /= p)
+      stages++;
+
+    // exp(+2*pi*i*BENCH_BIN*k/n) is the conjugate of the forward twiddle
+    for(i = 0; i < n; i++) {
+      kiss_fft_cpx t = st->twiddles[(BENCH_BIN*i) % n];
+      bench_in[i].r =  (BENCH_AMP * t.r) >> 15;
+      bench_in[i].i = -(BENCH_AMP * t.i) >> 15;
+    }
+
+    reset_timer();
+    start_timer();
+    kiss_fft(st, bench_in, bench_out);
+    stop_timer();
+    cycles = get_time();
+
+    // forward kiss_fft scales by 1/n: BENCH_AMP at BENCH_BIN, 0 elsewhere
+    for(i = 0; i < n; i++) {
+      int dr = bench_out[i].r - (i == BENCH_BIN ? BENCH_AMP : 0);
+      int di = bench_out[i].i;
+      if(dr > BENCH_TOL || dr < -BENCH_TOL || di > BENCH_TOL || di < -BENCH_TOL)
+        err++;
+    }
+    errors += err;
+
+    printf("radix %d, N=%d: %d cycles, %d cycles/butterfly, errors %d\n", p, n, cycles, cycles / (stages * n / p), err);
+  }
+
+  return errors;
+}
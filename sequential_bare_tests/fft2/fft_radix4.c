@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include "fft_radix4.h"
+#include "fft_twiddle_q15.h"
+
+/*
+ * Radix-4 decimation in frequency FFT on packed {re, im} Q15 samples, with a
+ * radix-2 last stage when log2(n) is odd. The second and third outputs of
+ * every radix-4 butterfly are stored swapped, so that the result comes out
+ * in plain bit-reversed order exactly as with radix-2 stages, and a single
+ * bit-reverse table serves every length.
+ *
+ * All loops have a trip count known on entry and no early exit, so that the
+ * compiler maps the two innermost levels on the hardware loops.
+ */
+
+#ifndef ARCHI_CORE_HAS_CPLX
+/* cores without the complex extension, same results as the instructions */
+#define __CPLXMULSDIV4(x, y)  ((v2s) {(signed short) ((((int) (x)[0]*(int) (y)[0]) - ((int) (x)[1]*(int) (y)[1])) >> 15), \
+                                      (signed short) ((((int) (x)[0]*(int) (y)[1]) + ((int) (x)[1]*(int) (y)[0])) >> 15)} >> (v2s) {2, 2})
+#define __SUB2ROTMJ(x, y)     ((v2s) {(x)[1]-(y)[1], (y)[0]-(x)[0]})
+#define __ADD2DIV2(x, y)      (((x)+(y)) >> (v2s) {1, 1})
+#define __ADD2DIV4(x, y)      (((x)+(y)) >> (v2s) {2, 2})
+#define __SUB2DIV2(x, y)      (((x)-(y)) >> (v2s) {1, 1})
+#endif
+
+v2s fft_twiddle[3*FFT_NMAX/4] __sram;
+unsigned short fft_bitrev[FFT_NMAX] __sram;
+
+void fft_cossin(int k, short *c, short *s) {
+  const int q = FFT_NMAX/4;
+
+  k &= FFT_NMAX-1;
+  if (k <= q) {
+    *c = cos_q15[k];
+    *s = cos_q15[q-k];
+  } else if (k <= 2*q) {
+    *c = -cos_q15[2*q-k];
+    *s = cos_q15[k-q];
+  } else if (k <= 3*q) {
+    *c = -cos_q15[k-2*q];
+    *s = -cos_q15[3*q-k];
+  } else {
+    *c = cos_q15[4*q-k];
+    *s = -cos_q15[k-3*q];
+  }
+}
+
+void fft_radix4_init() {
+  for (int k = 0; k < 3*FFT_NMAX/4; k++) {
+    short c, s;
+    fft_cossin(k, &c, &s);
+    fft_twiddle[k] = __PACK2(c, -s);
+  }
+
+  for (int k = 0; k < FFT_NMAX; k++) {
+    unsigned int r = 0;
+    for (int b = 0; b < FFT_LOG2_NMAX; b++)
+      r |= ((k >> b) & 1) << (FFT_LOG2_NMAX-1-b);
+    fft_bitrev[k] = r;
+  }
+}
+
+void fft_radix4(v2s *data, int n) {
+  int log2n = 31 - __builtin_clz(n);
+  int len = n;
+  int tstep = FFT_NMAX / n;
+
+  /* radix-4 stages: 4 inputs summed, each output scaled by 1/4 */
+  while (len >= 4) {
+    int q = len >> 2;
+    int ngroups = n / len;
+    v2s *tw1 = fft_twiddle;
+    v2s *tw2 = fft_twiddle;
+    v2s *tw3 = fft_twiddle;
+
+    for (int k = 0; k < q; k++) {
+      v2s w1 = *tw1;
+      v2s w2 = *tw2;
+      v2s w3 = *tw3;
+      v2s *p = data + k;
+
+      tw1 += tstep;
+      tw2 += 2*tstep;
+      tw3 += 3*tstep;
+
+      for (int g = 0; g < ngroups; g++) {
+        v2s a = p[0];
+        v2s b = p[q];
+        v2s c = p[2*q];
+        v2s d = p[3*q];
+
+        v2s u0 = a + c;
+        v2s u1 = a - c;
+        v2s u2 = b + d;
+        v2s u3 = __SUB2ROTMJ(b, d);   /* -j*(b-d) */
+
+        p[0]   = __ADD2DIV4(u0, u2);
+        p[q]   = __CPLXMULSDIV4(u0 - u2, w2);
+        p[2*q] = __CPLXMULSDIV4(u1 + u3, w1);
+        p[3*q] = __CPLXMULSDIV4(u1 - u3, w3);
+
+        p += len;
+      }
+    }
+
+    len >>= 2;
+    tstep <<= 2;
+  }
+
+  /* radix-2 tail, all twiddles are 1 */
+  if (len == 2) {
+    v2s *p = data;
+    for (int g = 0; g < n/2; g++) {
+      v2s a = p[0];
+      v2s b = p[1];
+      p[0] = __ADD2DIV2(a, b);
+      p[1] = __SUB2DIV2(a, b);
+      p += 2;
+    }
+  }
+
+  /* back to natural order */
+  {
+    int shift = FFT_LOG2_NMAX - log2n;
+    for (int i = 0; i < n; i++) {
+      int j = fft_bitrev[i] >> shift;
+      if (i < j) {
+        v2s tmp = data[i];
+        data[i] = data[j];
+        data[j] = tmp;
+      }
+    }
+  }
+}
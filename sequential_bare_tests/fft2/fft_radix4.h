@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#ifndef FFT_RADIX4_H
+#define FFT_RADIX4_H
+
+#include "common.h"
+
+/* largest supported transform, sizes the twiddle and bit-reverse tables */
+#define FFT_NMAX      4096
+#define FFT_LOG2_NMAX 12
+
+/* W^k = exp(-2*pi*i*k/FFT_NMAX), packed {re, im} Q15, k < 3*FFT_NMAX/4 */
+extern v2s fft_twiddle[3*FFT_NMAX/4];
+/* bit reversal of k on FFT_LOG2_NMAX bits */
+extern unsigned short fft_bitrev[FFT_NMAX];
+
+/* cos and sin of 2*pi*k/FFT_NMAX in Q15, any k */
+void fft_cossin(int k, short *c, short *s);
+
+void fft_radix4_init();
+
+/* In place forward FFT of n = 2^m points (4 <= n <= FFT_NMAX), packed
+   {re, im} Q15. Each stage scales by its radix so the output is DFT/n;
+   input magnitudes must stay below 2^13. */
+void fft_radix4(v2s *data, int n);
+
+#endif
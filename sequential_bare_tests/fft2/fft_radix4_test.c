@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <stdio.h>
+#include "common.h"
+#include "fft_radix4.h"
+
+/* lengths of the fft() vs fft_radix4() comparison */
+#define NMIN     64
+
+/* two tones: x[n] = A1*exp(2*pi*i*F1*n/N) + A2*exp(2*pi*i*F2*n/N), so
+   that the scaled transform is A1 at bin F1, A2 at bin F2 and 0 elsewhere */
+#define A1       4096
+#define A2       (-2048)
+#define F1(n)    3
+#define F2(n)    ((n)/2 - 5)
+
+/* allowed error per component, in LSB */
+#define TOL      4
+
+/* shared by both implementations, fft() sees it as interleaved shorts */
+v2s buf[FFT_NMAX] __sram;
+
+/* fft() twiddles for the length under test: cos and sin of 2*pi*k/N */
+short wpr[FFT_NMAX/2] __sram;
+short wpi[FFT_NMAX/2] __sram;
+
+extern void fft(short *, int, short *, short *);
+
+const char* __attribute__((weak)) get_testname()
+{
+  return "fft2_radix4";
+}
+
+static void load_tones(int n) {
+  int step = FFT_NMAX / n;
+  for (int i = 0; i < n; i++) {
+    short c1, s1, c2, s2;
+    fft_cossin(F1(n)*i*step, &c1, &s1);
+    fft_cossin(F2(n)*i*step, &c2, &s2);
+    buf[i] = __PACK2((A1*c1 + A2*c2) >> 15, (A1*s1 + A2*s2) >> 15);
+  }
+}
+
+static int check_tones(int n) {
+  int errors = 0;
+  for (int k = 0; k < n; k++) {
+    int re = (k == F1(n) ? A1 : 0) + (k == F2(n) ? A2 : 0);
+    int dr = buf[k][0] - re;
+    int di = buf[k][1];
+    if (dr > TOL || dr < -TOL || di > TOL || di < -TOL)
+      errors++;
+  }
+  return errors;
+}
+
+static void load_fft_twiddles(int n) {
+  int step = FFT_NMAX / n;
+  for (int k = 0; k < n/2; k++)
+    fft_cossin(k*step, &wpr[k], &wpi[k]);
+}
+
+/* cycles of fft() and fft_radix4() on every power of two length; fft()
+   does not scale, so only its cycle count is meaningful on this input */
+static int bench_lengths() {
+  int errors = 0;
+
+  for (int n = NMIN; n <= FFT_NMAX; n <<= 1) {
+    int t_fft, t_radix4, err;
+
+    load_tones(n);
+    load_fft_twiddles(n);
+    reset_timer();
+    start_timer();
+    fft((short *) buf, n, wpr, wpi);
+    stop_timer();
+    t_fft = get_time();
+
+    load_tones(n);
+    reset_timer();
+    start_timer();
+    fft_radix4(buf, n);
+    stop_timer();
+    t_radix4 = get_time();
+
+    err = check_tones(n);
+    errors += err;
+
+    printf("N=%d: fft %d cycles, fft_radix4 %d cycles, speedup x100 %d, errors %d\n",
+           n, t_fft, t_radix4, (t_fft * 100) / t_radix4, err);
+  }
+
+  return errors;
+}
+
+void test_setup() {
+  fft_radix4_init();
+}
+
+void test_clear() {
+  load_tones(FFT_NMAX);
+}
+
+void test_run(int n) {
+  fft_radix4(buf, FFT_NMAX);
+}
+
+int test_check() {
+  if (check_tones(FFT_NMAX) != 0)
+    return 0;
+
+  return bench_lengths() == 0;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <stdio.h>
+#include "../common.h"
+
+/*
+ * Register-blocked FIR: every pass computes 4 consecutive outputs, so each
+ * coefficient vector is loaded once and used 4 times. Input windows are
+ * only loaded at word-aligned addresses; the windows of the odd outputs
+ * are built from two aligned words with pv.shuffle2 instead of misaligned
+ * loads. The accumulation is 32 bit and the result is rounded, shifted by
+ * qf and saturated to the output width.
+ *
+ * arr must be 4-byte aligned, coeff_len a multiple of the vector length
+ * (zero pad the coefficients otherwise). Like fir16/fir8, the outputs are
+ * arr_length - coeff_len.
+ */
+
+typedef signed short FiltsV __attribute__((vector_size (4)));
+typedef signed char  FiltcV __attribute__((vector_size (4)));
+
+void fir16_block(const int16_t *arr, const int16_t *coeff, int16_t *output,
+         unsigned arr_length, unsigned coeff_len, unsigned qf) {
+
+  unsigned n = arr_length - coeff_len;
+  int round = qf ? 1 << (qf - 1) : 0;
+  const FiltsV *VectC = (const FiltsV *) coeff;
+  unsigned i;
+
+  for (i = 0; i + 4 <= n; i += 4) {
+    const FiltsV *VectA = (const FiltsV *) &arr[i];
+    int s0 = round, s1 = round, s2 = round, s3 = round;
+    FiltsV x0 = VectA[0];
+    FiltsV x1 = VectA[1];
+
+    for (unsigned j = 0; j < coeff_len/2; j++) {
+      FiltsV c = VectC[j];
+      FiltsV x2 = VectA[j+2];
+      s0 = __SUMDOTP2(x0, c, s0);
+      s1 = __SUMDOTP2(__builtin_shuffle(x0, x1, (FiltsV){1, 2}), c, s1);
+      s2 = __SUMDOTP2(x1, c, s2);
+      s3 = __SUMDOTP2(__builtin_shuffle(x1, x2, (FiltsV){1, 2}), c, s3);
+      x0 = x1;
+      x1 = x2;
+    }
+
+    output[i]   = __CLIP(s0 >> qf, 15);
+    output[i+1] = __CLIP(s1 >> qf, 15);
+    output[i+2] = __CLIP(s2 >> qf, 15);
+    output[i+3] = __CLIP(s3 >> qf, 15);
+  }
+
+  for (; i < n; i++) {
+    int sum = round;
+    for (unsigned j = 0; j < coeff_len; j++)
+      sum += arr[i+j] * coeff[j];
+    output[i] = __CLIP(sum >> qf, 15);
+  }
+}
+
+void fir8_block(const int8_t *arr, const int8_t *coeff, int8_t *output,
+         unsigned arr_length, unsigned coeff_len, unsigned qf) {
+
+  unsigned n = arr_length - coeff_len;
+  int round = qf ? 1 << (qf - 1) : 0;
+  const FiltcV *VectC = (const FiltcV *) coeff;
+  unsigned i;
+
+  for (i = 0; i + 4 <= n; i += 4) {
+    const FiltcV *VectA = (const FiltcV *) &arr[i];
+    int s0 = round, s1 = round, s2 = round, s3 = round;
+    FiltcV x0 = VectA[0];
+
+    for (unsigned j = 0; j < coeff_len/4; j++) {
+      FiltcV c = VectC[j];
+      FiltcV x1 = VectA[j+1];
+      s0 = __SUMDOTP4(x0, c, s0);
+      s1 = __SUMDOTP4(__builtin_shuffle(x0, x1, (FiltcV){1, 2, 3, 4}), c, s1);
+      s2 = __SUMDOTP4(__builtin_shuffle(x0, x1, (FiltcV){2, 3, 4, 5}), c, s2);
+      s3 = __SUMDOTP4(__builtin_shuffle(x0, x1, (FiltcV){3, 4, 5, 6}), c, s3);
+      x0 = x1;
+    }
+
+    output[i]   = __CLIP(s0 >> qf, 7);
+    output[i+1] = __CLIP(s1 >> qf, 7);
+    output[i+2] = __CLIP(s2 >> qf, 7);
+    output[i+3] = __CLIP(s3 >> qf, 7);
+  }
+
+  for (; i < n; i++) {
+    int sum = round;
+    for (unsigned j = 0; j < coeff_len; j++)
+      sum += arr[i+j] * coeff[j];
+    output[i] = __CLIP(sum >> qf, 7);
+  }
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <stdio.h>
+#include "common.h"
+
+#define NSAMPLES    1024
+#define FILTER_SIZE 16
+
+#if WORD==16
+#define QF          15
+typedef int16_t sample_t;
+
+/* low pass, Q15, gain slightly above 1 so that full scale inputs saturate */
+sample_t filter_l2[FILTER_SIZE] = {
+  -328, -512, -256, 768, 2560, 4608, 6144, 6912,
+  6912, 6144, 4608, 2560, 768, -256, -512, -328
+};
+
+extern void fir16(const int16_t *in, const int16_t *coeffs, int16_t *out,
+                unsigned in_length, unsigned coeffs_length);
+extern void fir16_dotp(const int16_t *in, const int16_t *coeffs, int16_t *out,
+                unsigned in_length, unsigned coeffs_length);
+extern void fir16_block(const int16_t *in, const int16_t *coeffs, int16_t *out,
+                unsigned in_length, unsigned coeffs_length, unsigned qf);
+
+#define FIR_REF   fir16
+#define FIR_DOTP  fir16_dotp
+#define FIR_BLOCK fir16_block
+#define SAT_BITS  15
+
+const char* get_testname() {
+  return "fir16_block";
+}
+#endif
+
+#if WORD==8
+#define QF          7
+typedef int8_t sample_t;
+
+/* same low pass in Q7 */
+sample_t filter_l2[FILTER_SIZE] = {
+  -1, -2, -1, 3, 10, 18, 24, 27,
+  27, 24, 18, 10, 3, -1, -2, -1
+};
+
+extern void fir8(const int8_t *in, const int8_t *coeffs, int16_t *out,
+                unsigned in_length, unsigned coeffs_length);
+extern void fir8_dotp(const int8_t *in, const int8_t *coeffs, int16_t *out,
+                unsigned in_length, unsigned coeffs_length);
+extern void fir8_block(const int8_t *in, const int8_t *coeffs, int8_t *out,
+                unsigned in_length, unsigned coeffs_length, unsigned qf);
+
+#define FIR_REF   fir8
+#define FIR_DOTP  fir8_dotp
+#define FIR_BLOCK fir8_block
+#define SAT_BITS  7
+
+const char* get_testname() {
+  return "fir8_block";
+}
+#endif
+
+/* fir_block needs word aligned input and coefficients */
+sample_t input[NSAMPLES] __sram __attribute__((aligned(4)));
+sample_t filter[FILTER_SIZE] __sram __attribute__((aligned(4)));
+sample_t output[NSAMPLES] __sram;
+/* output of the existing fir16/fir8 variants, only timed */
+int16_t bench_output[NSAMPLES] __sram;
+
+/* one output per iteration, 32 bit accumulation, same rounding and
+   saturation as the block kernel */
+static int check_block() {
+  int errors = 0;
+  for (int i = 0; i < NSAMPLES - FILTER_SIZE; i++) {
+    int sum = 1 << (QF - 1);
+    for (int j = 0; j < FILTER_SIZE; j++)
+      sum += input[i+j] * filter[j];
+    sum >>= QF;
+    if (sum >  (1 << SAT_BITS) - 1) sum = (1 << SAT_BITS) - 1;
+    if (sum < -(1 << SAT_BITS))     sum = -(1 << SAT_BITS);
+    if (output[i] != sum)
+      errors++;
+  }
+  return errors;
+}
+
+/* cycles of the scalar, one output dotp and block kernels on the same
+   input; only the block kernel output is checked */
+static void bench() {
+  int n = NSAMPLES - FILTER_SIZE;
+  int t_ref, t_block;
+#if DOTP==1
+  int t_dotp;
+#endif
+
+  reset_timer();
+  start_timer();
+  FIR_REF(input, filter, bench_output, NSAMPLES, FILTER_SIZE);
+  stop_timer();
+  t_ref = get_time();
+
+#if DOTP==1
+  reset_timer();
+  start_timer();
+  FIR_DOTP(input, filter, bench_output, NSAMPLES, FILTER_SIZE);
+  stop_timer();
+  t_dotp = get_time();
+#endif
+
+  reset_timer();
+  start_timer();
+  FIR_BLOCK(input, filter, output, NSAMPLES, FILTER_SIZE, QF);
+  stop_timer();
+  t_block = get_time();
+
+  printf("%s, %d outputs, %d taps\n", get_testname(), n, FILTER_SIZE);
+  printf("scalar: %d cycles, %d cycles/output x100\n", t_ref, (t_ref * 100) / n);
+#if DOTP==1
+  printf("dotp:   %d cycles, %d cycles/output x100\n", t_dotp, (t_dotp * 100) / n);
+#endif
+  printf("block:  %d cycles, %d cycles/output x100, speedup x100 vs scalar %d\n",
+         t_block, (t_block * 100) / n, (t_ref * 100) / t_block);
+}
+
+void test_setup() {
+  /* square wave at 7/8 of full scale plus small pseudo random noise, the
+     plateaus saturate the output */
+  int fs = 1 << SAT_BITS;
+  unsigned seed = 0x1234567;
+  for (int i = 0; i < NSAMPLES; i++) {
+    int noise = (int) seed >> (35 - SAT_BITS);
+    seed = seed * 1103515245 + 12345;
+    input[i] = (sample_t) ((i & 64 ? fs : -fs) / 8 * 7 + noise);
+  }
+  for (int k = 0; k < FILTER_SIZE; k++)
+    filter[k] = filter_l2[k];
+}
+
+void test_clear() {
+  for (int i = 0; i < NSAMPLES; i++)
+    output[i] = 0;
+}
+
+void test_run() {
+  FIR_BLOCK(input, filter, output, NSAMPLES, FILTER_SIZE, QF);
+}
+
+int test_check() {
+  int errors = check_block();
+  if (errors != 0) {
+    printf("fir block: %d errors\n", errors);
+    return 0;
+  }
+
+  bench();
+
+  return check_block() == 0;
+}
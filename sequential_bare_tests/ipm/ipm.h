@@ -19,7 +19,9 @@
  */
 #ifndef IPM_H
 
+#ifndef N
 #define N 5
+#endif
 #define M 3
 
 #endif
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <stdio.h>
+#include "common.h"
+
+/*
+ * Fused dilation, erosion and laplacian_filter with a flat m x m
+ * structuring element, in one streaming pass over the image.
+ *
+ * Output (i, j), 0 <= i < h, 0 <= j < w, covers A[i..i+m-1][j..j+m-1]
+ * like in ipm.c, and keeps its results: D and E start from 0, so
+ * D = max(0, window max), E = min(0, window min), R = (D + E) / 2 - A[i][j].
+ *
+ * The element is separable: every input row is reduced once to the max
+ * and min of m consecutive pixels (pv.max/pv.min on windows shifted with
+ * pv.shuffle2), into a circular buffer of m lines. As soon as m lines are
+ * there, the column max/min over the buffer gives a row of D and E, and R
+ * comes from a dot product of the packed (D, E) pairs with (1, 1), exact
+ * in 32 bit, so that the input is only streamed once.
+ *
+ * A, D, E and R share the row stride, in elements. A and stride must be
+ * word aligned, and the rows of A readable up to w + m + 6 pixels;
+ * m <= IPM_MAX_M, w <= IPM_MAX_W.
+ */
+
+typedef signed short IpmsV __attribute__((vector_size (4)));
+typedef signed char  IpmcV __attribute__((vector_size (4)));
+
+#define IPM_MAX_M   7
+#define IPM_MAX_W   128
+
+// m lines of horizontal max and min, one word per vector
+static int line_max[IPM_MAX_M][IPM_MAX_W/2] __sram;
+static int line_min[IPM_MAX_M][IPM_MAX_W/2] __sram;
+
+static inline IpmsV win16(const IpmsV *a, int k)
+{
+  if (k & 1)
+    return __builtin_shuffle(a[k>>1], a[(k>>1)+1], (IpmsV){1, 2});
+  return a[k>>1];
+}
+
+static inline IpmcV win8(const IpmcV *a, int k)
+{
+  switch (k & 3) {
+  case 1:  return __builtin_shuffle(a[k>>2], a[(k>>2)+1], (IpmcV){1, 2, 3, 4});
+  case 2:  return __builtin_shuffle(a[k>>2], a[(k>>2)+1], (IpmcV){2, 3, 4, 5});
+  case 3:  return __builtin_shuffle(a[k>>2], a[(k>>2)+1], (IpmcV){3, 4, 5, 6});
+  default: return a[k>>2];
+  }
+}
+
+void ipm_fused16(const int16_t *A, int16_t *D, int16_t *E, int16_t *R,
+                 int stride, int h, int w, int m) {
+
+  int nv = (w + 1) / 2;
+  IpmsV ones = {1, 1};
+  IpmsV zero = {0, 0};
+
+  for (int r = 0; r < h + m - 1; r++) {
+    const IpmsV *a = (const IpmsV *) (A + r*stride);
+    IpmsV *lmax = (IpmsV *) line_max[r % m];
+    IpmsV *lmin = (IpmsV *) line_min[r % m];
+
+    // row pass
+    for (int v = 0; v < nv; v++) {
+      IpmsV mx = a[v], mn = a[v];
+      for (int k = 1; k < m; k++) {
+        IpmsV x = win16(a + v, k);
+        mx = __MAX2(mx, x);
+        mn = __MIN2(mn, x);
+      }
+      lmax[v] = mx;
+      lmin[v] = mn;
+    }
+
+    if (r < m - 1)
+      continue;
+
+    // column pass and laplacian of output row i
+    int i = r - m + 1;
+    const int16_t *ai = A + i*stride;
+    int16_t *di = D + i*stride;
+    int16_t *ei = E + i*stride;
+    int16_t *ri = R + i*stride;
+
+    for (int v = 0; v < nv; v++) {
+      IpmsV mx = zero, mn = zero;
+      for (int s = 0; s < m; s++) {
+        mx = __MAX2(mx, ((IpmsV *) line_max[s])[v]);
+        mn = __MIN2(mn, ((IpmsV *) line_min[s])[v]);
+      }
+
+      int s0 = __DOTP2(__builtin_shuffle(mx, mn, (IpmsV){0, 2}), ones);
+      int s1 = __DOTP2(__builtin_shuffle(mx, mn, (IpmsV){1, 3}), ones);
+      int j = 2*v;
+
+      if (j + 1 < w) {
+        *(IpmsV *) &di[j] = mx;
+        *(IpmsV *) &ei[j] = mn;
+        *(IpmsV *) &ri[j] = __PACK2(__CLIP(s0/2 - ai[j], 15), __CLIP(s1/2 - ai[j+1], 15));
+      } else {
+        di[j] = mx[0];
+        ei[j] = mn[0];
+        ri[j] = __CLIP(s0/2 - ai[j], 15);
+      }
+    }
+  }
+}
+
+// same with 8 bit pixels, R is 16 bit and needs no saturation
+void ipm_fused8(const int8_t *A, int8_t *D, int8_t *E, int16_t *R,
+                int stride, int h, int w, int m) {
+
+  int nv = (w + 3) / 4;
+  IpmcV lo = {1, 1, 0, 0};
+  IpmcV hi = {0, 0, 1, 1};
+  IpmcV zero = {0, 0, 0, 0};
+
+  for (int r = 0; r < h + m - 1; r++) {
+    const IpmcV *a = (const IpmcV *) (A + r*stride);
+    IpmcV *lmax = (IpmcV *) line_max[r % m];
+    IpmcV *lmin = (IpmcV *) line_min[r % m];
+
+    for (int v = 0; v < nv; v++) {
+      IpmcV mx = a[v], mn = a[v];
+      for (int k = 1; k < m; k++) {
+        IpmcV x = win8(a + v, k);
+        mx = __MAX4(mx, x);
+        mn = __MIN4(mn, x);
+      }
+      lmax[v] = mx;
+      lmin[v] = mn;
+    }
+
+    if (r < m - 1)
+      continue;
+
+    int i = r - m + 1;
+    const int8_t *ai = A + i*stride;
+    int8_t *di = D + i*stride;
+    int8_t *ei = E + i*stride;
+    int16_t *ri = R + i*stride;
+
+    for (int v = 0; v < nv; v++) {
+      IpmcV mx = zero, mn = zero;
+      for (int s = 0; s < m; s++) {
+        mx = __MAX4(mx, ((IpmcV *) line_max[s])[v]);
+        mn = __MIN4(mn, ((IpmcV *) line_min[s])[v]);
+      }
+
+      // (D0, E0, D1, E1) and (D2, E2, D3, E3)
+      IpmcV de01 = __builtin_shuffle(mx, mn, (IpmcV){0, 4, 1, 5});
+      IpmcV de23 = __builtin_shuffle(mx, mn, (IpmcV){2, 6, 3, 7});
+      int s[4];
+      s[0] = __DOTP4(de01, lo);
+      s[1] = __DOTP4(de01, hi);
+      s[2] = __DOTP4(de23, lo);
+      s[3] = __DOTP4(de23, hi);
+
+      int j = 4*v;
+      if (j + 3 < w) {
+        *(IpmcV *) &di[j] = mx;
+        *(IpmcV *) &ei[j] = mn;
+        *(IpmsV *) &ri[j]   = __PACK2(s[0]/2 - ai[j],   s[1]/2 - ai[j+1]);
+        *(IpmsV *) &ri[j+2] = __PACK2(s[2]/2 - ai[j+2], s[3]/2 - ai[j+3]);
+      } else {
+        for (int l = 0; j + l < w; l++) {
+          di[j+l] = mx[l];
+          ei[j+l] = mn[l];
+          ri[j+l] = s[l]/2 - ai[j+l];
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <stdio.h>
+#include "common.h"
+#include "ipm.h"
+
+/* the existing functions work on i, j in [1, N-2] */
+#define H   (N - 2)
+#define W   (N - 2)
+
+/* packed copies: pixel (i, j) at [i][j + XOFF], so that j = 1 is word
+   aligned, with room for the kernel reading past the last column */
+#define XOFF    3
+#define STRIDE  ((N + 1 + XOFF + M + 8) & ~3)
+
+#if WORD==16
+typedef int16_t pixel_t;
+#define AMP     8192
+#define IPM_FUSED ipm_fused16
+
+const char* get_testname() {
+  return "ipm16_fused";
+}
+#endif
+
+#if WORD==8
+typedef int8_t pixel_t;
+#define AMP     128
+#define IPM_FUSED ipm_fused8
+
+const char* get_testname() {
+  return "ipm8_fused";
+}
+#endif
+
+extern void dilation(int A[N + 1][N + 1], int D[N + 1][N + 1], int B[M][M]);
+extern void erosion(int A[N + 1][N + 1], int E[N + 1][N + 1], int B[M][M]);
+extern void laplacian_filter(int A[N + 1][N + 1], int R[N + 1][N + 1], int B[M][M]);
+
+extern void ipm_fused16(const int16_t *A, int16_t *D, int16_t *E, int16_t *R,
+                        int stride, int h, int w, int m);
+extern void ipm_fused8(const int8_t *A, int8_t *D, int8_t *E, int16_t *R,
+                       int stride, int h, int w, int m);
+
+/* input and outputs of the existing functions */
+static int x[N + 1][N + 1] __sram;
+static int d[N + 1][N + 1] __sram;
+static int e[N + 1][N + 1] __sram;
+static int r[N + 1][N + 1] __sram;
+
+static pixel_t xs[N + 1][STRIDE] __sram __attribute__((aligned(4)));
+static pixel_t ds[N + 1][STRIDE] __sram __attribute__((aligned(4)));
+static pixel_t es[N + 1][STRIDE] __sram __attribute__((aligned(4)));
+static int16_t rs[N + 1][STRIDE] __sram __attribute__((aligned(4)));
+
+/* flat structuring element */
+int Ne_l2[M][M] = {1, 1, 1, 1, 1, 1, 1, 1, 1};
+int Ne[M][M] __sram;
+
+static void run_fused() {
+  IPM_FUSED(&xs[1][1 + XOFF], &ds[1][1 + XOFF], &es[1][1 + XOFF], &rs[1][1 + XOFF],
+            STRIDE, H, W, M);
+}
+
+/* cycles of the three existing passes and of the fused one on the same
+   image, then the fused outputs against the existing ones */
+static int check_fused() {
+  int t_dil, t_ero, t_lap, t_fused;
+  int npix = H * W;
+  int errors = 0;
+
+  reset_timer();
+  start_timer();
+  dilation(x, d, Ne);
+  stop_timer();
+  t_dil = get_time();
+
+  reset_timer();
+  start_timer();
+  erosion(x, e, Ne);
+  stop_timer();
+  t_ero = get_time();
+
+  reset_timer();
+  start_timer();
+  laplacian_filter(x, r, Ne);
+  stop_timer();
+  t_lap = get_time();
+
+  reset_timer();
+  start_timer();
+  run_fused();
+  stop_timer();
+  t_fused = get_time();
+
+  for (int i = 1; i < N - 1; i++)
+    for (int j = 1; j < N - 1; j++) {
+      if (ds[i][j + XOFF] != d[i][j] || es[i][j + XOFF] != e[i][j] ||
+          rs[i][j + XOFF] != r[i][j])
+        errors++;
+    }
+
+  printf("%s, %dx%d pixels, %dx%d element\n", get_testname(), H, W, M, M);
+  printf("dilation:  %d cycles, %d cycles/pixel x100\n", t_dil, (t_dil * 100) / npix);
+  printf("erosion:   %d cycles, %d cycles/pixel x100\n", t_ero, (t_ero * 100) / npix);
+  printf("laplacian: %d cycles, %d cycles/pixel x100\n", t_lap, (t_lap * 100) / npix);
+  printf("fused:     %d cycles, %d cycles/pixel x100, speedup x100 vs the three passes %d\n",
+         t_fused, (t_fused * 100) / npix, ((t_dil + t_ero + t_lap) * 100) / t_fused);
+
+  return errors;
+}
+
+void test_setup() {
+  /* pseudo random pixels of both signs over the whole range */
+  unsigned seed = 0x2468ace;
+  for (int i = 0; i <= N; i++)
+    for (int j = 0; j <= N; j++) {
+      seed = seed * 1103515245 + 12345;
+      x[i][j] = (int) (seed >> 8) % AMP;
+      if (seed & 0x80000000)
+        x[i][j] = -x[i][j] - 1;
+      xs[i][j + XOFF] = x[i][j];
+    }
+
+  for (int i=0;i<M;i++)
+    for (int k=0;k<M;k++)
+      Ne[i][k] = Ne_l2[i][k];
+}
+
+void test_clear() {
+  for (int i = 0; i <= N; i++)
+    for (int j = 0; j < STRIDE; j++) {
+      ds[i][j] = 0;
+      es[i][j] = 0;
+      rs[i][j] = 0;
+    }
+}
+
+void test_run() {
+  run_fused();
+}
+
+int test_check() {
+  int errors = check_fused();
+  if (errors != 0)
+    printf("ipm fused: %d errors\n", errors);
+
+  return errors == 0;
+}
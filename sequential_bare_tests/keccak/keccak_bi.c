@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <stdio.h>
+// Keccak-f[1600] for 32 bit cores: bit interleaving, lane complementing,
+// fully unrolled rounds. Same results as keccakf / do_keccak in keccak.c.
+//
+// Every 64 bit lane is kept as two 32 bit words, the even bits and the odd
+// bits, so that a 64 bit rotation is two 32 bit rotations (p.ror), with no
+// carries between the halves. State word 2*i holds the even bits of lane i,
+// 2*i+1 the odd ones.
+//
+// Lanes 1, 2, 8, 12, 17 and 20 are stored complemented. With the and/or
+// variants of Chi below, which follow from that, each plane needs a single
+// NOT instead of five (RV32 has no and-not).
+
+#include "common.h"
+
+#define KECCAK_ROUNDS 24
+
+#define ROL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+// keccakf_rndc, even and odd bits
+static const uint32_t keccakf_rndc_bi[48] =
+{
+    0x00000001, 0x00000000, 0x00000000, 0x00000089, 0x00000000, 0x8000008b,
+    0x00000000, 0x80008080, 0x00000001, 0x0000008b, 0x00000001, 0x00008000,
+    0x00000001, 0x80008088, 0x00000001, 0x80000082, 0x00000000, 0x0000000b,
+    0x00000000, 0x0000000a, 0x00000001, 0x00008082, 0x00000000, 0x00008003,
+    0x00000001, 0x0000808b, 0x00000001, 0x8000000b, 0x00000001, 0x8000008a,
+    0x00000001, 0x80000081, 0x00000000, 0x80000081, 0x00000000, 0x80000008,
+    0x00000000, 0x00000083, 0x00000000, 0x80008003, 0x00000001, 0x80008088,
+    0x00000000, 0x80000088, 0x00000001, 0x00008000, 0x00000000, 0x80008082,
+};
+
+static inline __attribute__((always_inline))
+void round_bi(const uint32_t *A, uint32_t *E, uint32_t rc0, uint32_t rc1)
+{
+    uint32_t Ca0, Ce0, Ci0, Co0, Cu0, Ca1, Ce1, Ci1, Co1, Cu1;
+    uint32_t Da0, De0, Di0, Do0, Du0, Da1, De1, Di1, Do1, Du1;
+    uint32_t Ba, Be, Bi, Bo, Bu, n;
+
+    // Theta
+    Ca0 = A[0] ^ A[10] ^ A[20] ^ A[30] ^ A[40];
+    Ce0 = A[2] ^ A[12] ^ A[22] ^ A[32] ^ A[42];
+    Ci0 = A[4] ^ A[14] ^ A[24] ^ A[34] ^ A[44];
+    Co0 = A[6] ^ A[16] ^ A[26] ^ A[36] ^ A[46];
+    Cu0 = A[8] ^ A[18] ^ A[28] ^ A[38] ^ A[48];
+    Ca1 = A[1] ^ A[11] ^ A[21] ^ A[31] ^ A[41];
+    Ce1 = A[3] ^ A[13] ^ A[23] ^ A[33] ^ A[43];
+    Ci1 = A[5] ^ A[15] ^ A[25] ^ A[35] ^ A[45];
+    Co1 = A[7] ^ A[17] ^ A[27] ^ A[37] ^ A[47];
+    Cu1 = A[9] ^ A[19] ^ A[29] ^ A[39] ^ A[49];
+    Da0 = Cu0 ^ ROL32(Ce1, 1);
+    Da1 = Cu1 ^ Ce0;
+    De0 = Ca0 ^ ROL32(Ci1, 1);
+    De1 = Ca1 ^ Ci0;
+    Di0 = Ce0 ^ ROL32(Co1, 1);
+    Di1 = Ce1 ^ Co0;
+    Do0 = Ci0 ^ ROL32(Cu1, 1);
+    Do1 = Ci1 ^ Cu0;
+    Du0 = Co0 ^ ROL32(Ca1, 1);
+    Du1 = Co1 ^ Ca0;
+
+    // Rho Pi Chi, plane 0, with Iota
+    Ba = A[0] ^ Da0;
+    Be = ROL32(A[12] ^ De0, 22);
+    Bi = ROL32(A[25] ^ Di1, 22);
+    Bo = ROL32(A[37] ^ Do1, 11);
+    Bu = ROL32(A[48] ^ Du0, 7);
+    n = ~Bi;
+    E[0] = Ba ^ (Be | Bi) ^ rc0;
+    E[2] = Be ^ (n | Bo);
+    E[4] = Bi ^ (Bo & Bu);
+    E[6] = Bo ^ (Bu | Ba);
+    E[8] = Bu ^ (Ba & Be);
+    Ba = A[1] ^ Da1;
+    Be = ROL32(A[13] ^ De1, 22);
+    Bi = ROL32(A[24] ^ Di0, 21);
+    Bo = ROL32(A[36] ^ Do0, 10);
+    Bu = ROL32(A[49] ^ Du1, 7);
+    n = ~Bi;
+    E[1] = Ba ^ (Be | Bi) ^ rc1;
+    E[3] = Be ^ (n | Bo);
+    E[5] = Bi ^ (Bo & Bu);
+    E[7] = Bo ^ (Bu | Ba);
+    E[9] = Bu ^ (Ba & Be);
+
+    // Rho Pi Chi, plane 1
+    Ba = ROL32(A[6] ^ Do0, 14);
+    Be = ROL32(A[18] ^ Du0, 10);
+    Bi = ROL32(A[21] ^ Da1, 2);
+    Bo = ROL32(A[33] ^ De1, 23);
+    Bu = ROL32(A[45] ^ Di1, 31);
+    n = ~Bu;
+    E[10] = Ba ^ (Be | Bi);
+    E[12] = Be ^ (Bi & Bo);
+    E[14] = Bi ^ (Bo | n);
+    E[16] = Bo ^ (Bu | Ba);
+    E[18] = Bu ^ (Ba & Be);
+    Ba = ROL32(A[7] ^ Do1, 14);
+    Be = ROL32(A[19] ^ Du1, 10);
+    Bi = ROL32(A[20] ^ Da0, 1);
+    Bo = ROL32(A[32] ^ De0, 22);
+    Bu = ROL32(A[44] ^ Di0, 30);
+    n = ~Bu;
+    E[11] = Ba ^ (Be | Bi);
+    E[13] = Be ^ (Bi & Bo);
+    E[15] = Bi ^ (Bo | n);
+    E[17] = Bo ^ (Bu | Ba);
+    E[19] = Bu ^ (Ba & Be);
+
+    // Rho Pi Chi, plane 2
+    Ba = ROL32(A[3] ^ De1, 1);
+    Be = ROL32(A[14] ^ Di0, 3);
+    Bi = ROL32(A[27] ^ Do1, 13);
+    Bo = ROL32(A[38] ^ Du0, 4);
+    Bu = ROL32(A[40] ^ Da0, 9);
+    n = ~Bo;
+    E[20] = Ba ^ (Be | Bi);
+    E[22] = Be ^ (Bi & Bo);
+    E[24] = Bi ^ (n & Bu);
+    E[26] = n ^ (Bu | Ba);
+    E[28] = Bu ^ (Ba & Be);
+    Ba = A[2] ^ De0;
+    Be = ROL32(A[15] ^ Di1, 3);
+    Bi = ROL32(A[26] ^ Do0, 12);
+    Bo = ROL32(A[39] ^ Du1, 4);
+    Bu = ROL32(A[41] ^ Da1, 9);
+    n = ~Bo;
+    E[21] = Ba ^ (Be | Bi);
+    E[23] = Be ^ (Bi & Bo);
+    E[25] = Bi ^ (n & Bu);
+    E[27] = n ^ (Bu | Ba);
+    E[29] = Bu ^ (Ba & Be);
+
+    // Rho Pi Chi, plane 3
+    Ba = ROL32(A[9] ^ Du1, 14);
+    Be = ROL32(A[10] ^ Da0, 18);
+    Bi = ROL32(A[22] ^ De0, 5);
+    Bo = ROL32(A[35] ^ Di1, 8);
+    Bu = ROL32(A[46] ^ Do0, 28);
+    n = ~Bo;
+    E[30] = Ba ^ (Be & Bi);
+    E[32] = Be ^ (Bi | Bo);
+    E[34] = Bi ^ (n | Bu);
+    E[36] = n ^ (Bu & Ba);
+    E[38] = Bu ^ (Ba | Be);
+    Ba = ROL32(A[8] ^ Du0, 13);
+    Be = ROL32(A[11] ^ Da1, 18);
+    Bi = ROL32(A[23] ^ De1, 5);
+    Bo = ROL32(A[34] ^ Di0, 7);
+    Bu = ROL32(A[47] ^ Do1, 28);
+    n = ~Bo;
+    E[31] = Ba ^ (Be & Bi);
+    E[33] = Be ^ (Bi | Bo);
+    E[35] = Bi ^ (n | Bu);
+    E[37] = n ^ (Bu & Ba);
+    E[39] = Bu ^ (Ba | Be);
+
+    // Rho Pi Chi, plane 4
+    Ba = ROL32(A[4] ^ Di0, 31);
+    Be = ROL32(A[17] ^ Do1, 28);
+    Bi = ROL32(A[29] ^ Du1, 20);
+    Bo = ROL32(A[31] ^ Da1, 21);
+    Bu = ROL32(A[42] ^ De0, 1);
+    n = ~Be;
+    E[40] = Ba ^ (n & Bi);
+    E[42] = n ^ (Bi | Bo);
+    E[44] = Bi ^ (Bo & Bu);
+    E[46] = Bo ^ (Bu | Ba);
+    E[48] = Bu ^ (Ba & Be);
+    Ba = ROL32(A[5] ^ Di1, 31);
+    Be = ROL32(A[16] ^ Do0, 27);
+    Bi = ROL32(A[28] ^ Du0, 19);
+    Bo = ROL32(A[30] ^ Da0, 20);
+    Bu = ROL32(A[43] ^ De1, 1);
+    n = ~Be;
+    E[41] = Ba ^ (n & Bi);
+    E[43] = n ^ (Bi | Bo);
+    E[45] = Bi ^ (Bo & Bu);
+    E[47] = Bo ^ (Bu | Ba);
+    E[49] = Bu ^ (Ba & Be);
+}
+
+// rounds must be even, the state goes back and forth through a copy
+void keccakf_bi(uint32_t st[50], int rounds)
+{
+    uint32_t tmp[50];
+    int round;
+
+    for (round = 0; round < rounds; round += 2) {
+        round_bi(st, tmp, keccakf_rndc_bi[2*round], keccakf_rndc_bi[2*round+1]);
+        round_bi(tmp, st, keccakf_rndc_bi[2*round+2], keccakf_rndc_bi[2*round+3]);
+    }
+}
+
+// even bits of x to the low half, odd bits to the high half
+static inline uint32_t unzip(uint32_t x)
+{
+    uint32_t t;
+    t = (x ^ (x >> 1)) & 0x22222222; x ^= t ^ (t << 1);
+    t = (x ^ (x >> 2)) & 0x0C0C0C0C; x ^= t ^ (t << 2);
+    t = (x ^ (x >> 4)) & 0x00F000F0; x ^= t ^ (t << 4);
+    t = (x ^ (x >> 8)) & 0x0000FF00; x ^= t ^ (t << 8);
+    return x;
+}
+
+static inline uint32_t zip(uint32_t x)
+{
+    uint32_t t;
+    t = (x ^ (x >> 8)) & 0x0000FF00; x ^= t ^ (t << 8);
+    t = (x ^ (x >> 4)) & 0x00F000F0; x ^= t ^ (t << 4);
+    t = (x ^ (x >> 2)) & 0x0C0C0C0C; x ^= t ^ (t << 2);
+    t = (x ^ (x >> 1)) & 0x22222222; x ^= t ^ (t << 1);
+    return x;
+}
+
+static inline uint32_t load32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static inline void store32(uint8_t *p, uint32_t x)
+{
+    p[0] = x; p[1] = x >> 8; p[2] = x >> 16; p[3] = x >> 24;
+}
+
+// xor the nw 64 bit little endian lanes of in into the state
+static void absorb_bi(uint32_t st[50], const uint8_t *in, int nw)
+{
+    int i;
+
+    for (i = 0; i < nw; i++) {
+        uint32_t lo = unzip(load32(in + 8*i));
+        uint32_t hi = unzip(load32(in + 8*i + 4));
+        st[2*i]   ^= (lo & 0x0000FFFF) | (hi << 16);
+        st[2*i+1] ^= (lo >> 16) | (hi & 0xFFFF0000);
+    }
+}
+
+// state with the complemented lanes set, i.e. all zero lanes
+void keccak_init_bi(uint32_t st[50])
+{
+    int i;
+
+    memset(st, 0, 50*sizeof(uint32_t));
+    for (i = 0; i < 2; i++) {
+        st[2*1+i] = st[2*2+i] = st[2*8+i] = 0xFFFFFFFF;
+        st[2*12+i] = st[2*17+i] = st[2*20+i] = 0xFFFFFFFF;
+    }
+}
+
+// compute a keccak hash (md) of given byte length from "in"; pad is the
+// first padding byte, 0x01 for Keccak as do_keccak, 0x06 for SHA3
+int do_keccak_bi(const uint8_t *in, int inlen, uint8_t *md, int mdlen, int pad)
+{
+    uint32_t st[50];
+    uint8_t temp[144];
+    int i, rsiz, rsizw;
+
+    rsiz = 200 - 2 * mdlen;
+    rsizw = rsiz / 8;
+
+    keccak_init_bi(st);
+
+    for ( ; inlen >= rsiz; inlen -= rsiz, in += rsiz) {
+        absorb_bi(st, in, rsizw);
+        keccakf_bi(st, KECCAK_ROUNDS);
+    }
+
+    // last block and padding
+    memcpy(temp, in, inlen);
+    temp[inlen++] = pad;
+    memset(temp + inlen, 0, rsiz - inlen);
+    temp[rsiz - 1] |= 0x80;
+
+    absorb_bi(st, temp, rsizw);
+    keccakf_bi(st, KECCAK_ROUNDS);
+
+    // back to plain lanes, undoing the complement
+    for (i = 0; i < (mdlen + 7) / 8; i++) {
+        uint32_t e = st[2*i], o = st[2*i+1];
+        uint32_t lo, hi;
+        if (i == 1 || i == 2 || i == 8) {
+            e = ~e;
+            o = ~o;
+        }
+        lo = zip((e & 0x0000FFFF) | (o << 16));
+        hi = zip((e >> 16) | (o & 0xFFFF0000));
+        store32(temp + 8*i, lo);
+        store32(temp + 8*i + 4, hi);
+    }
+    memcpy(md, temp, mdlen);
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+#include <stdio.h>
+#include "common.h"
+
+// Independent messages hashed with do_keccak_bi, spread over the cluster
+// cores (core id takes messages id, id + nc, ...). The digests are checked
+// against do_keccak, computed once by core 0.
+
+#define NMSG    32
+#define MSG_LEN 256
+
+PLP_L1_DATA uint8_t g_msg[NMSG][MSG_LEN];
+PLP_L1_DATA uint8_t g_md[NMSG][64];
+PLP_L1_DATA uint8_t g_md_ref[NMSG][64];
+
+// single-core cycles, for the speedup column
+static int g_cycles_1core;
+
+extern int do_keccak(const uint8_t *in, int, uint8_t *out, int);
+extern int do_keccak_bi(const uint8_t *in, int, uint8_t *out, int, int);
+
+int test_multi(int mdlen, int nc);
+void load(int mdlen);
+
+int main()
+{
+  if (rt_cluster_id() != 0)
+    return bench_cluster_forward(0);
+
+  int errors = 0;
+  int mdlen, nc;
+
+  for (mdlen = 32; mdlen <= 64; mdlen <<= 1) {
+    if (rt_core_id() == 0)
+      load(mdlen);
+
+    synch_barrier();
+
+    for (nc = 1; nc <= get_core_num(); nc <<= 1)
+      errors += test_multi(mdlen, nc);
+  }
+
+  #ifndef PULP_SPI
+  if (rt_core_id() == 0)
+    printf("errors=%d\n", errors);
+  #endif
+
+  synch_barrier();
+
+  return errors;
+}
+
+int test_multi(int mdlen, int nc)
+{
+  int id = rt_core_id();
+  int errors = 0;
+  int cycles = 0;
+  int i;
+
+  if (id == 0)
+    memset(g_md, 0, sizeof(g_md));
+
+  synch_barrier();
+
+  if (id == 0) {
+    reset_timer();
+    start_timer();
+  }
+
+  if (id < nc) {
+    for (i = id; i < NMSG; i += nc)
+      do_keccak_bi(g_msg[i], MSG_LEN, g_md[i], mdlen, 0x01);
+  }
+
+  synch_barrier();
+
+  if (id == 0) {
+    stop_timer();
+    cycles = get_time();
+    if (nc == 1)
+      g_cycles_1core = cycles;
+
+    for (i = 0; i < NMSG; i++)
+      if (memcmp(g_md[i], g_md_ref[i], mdlen) != 0)
+        errors++;
+
+    #ifndef PULP_SPI
+    printf("rate of SHA3-%d, %d messages of %d bytes, cores=%d, errors=%d, time=%d, cycles/byte x100=%d, speedup x100=%d\n",
+           mdlen*8, NMSG, MSG_LEN, nc, errors, cycles, (cycles * 100) / (NMSG * MSG_LEN),
+           (g_cycles_1core * 100) / cycles);
+    #endif
+  }
+
+  synch_barrier();
+
+  return errors;
+}
+
+void load(int mdlen)
+{
+  unsigned seed = 0x6a09e667 + mdlen;
+  int i, j;
+
+  for (i = 0; i < NMSG; i++) {
+    for (j = 0; j < MSG_LEN; j++) {
+      seed = seed * 1103515245 + 12345;
+      g_msg[i][j] = seed >> 24;
+    }
+    do_keccak(g_msg[i], MSG_LEN, g_md_ref[i], mdlen);
+  }
+}
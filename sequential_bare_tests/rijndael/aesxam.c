@@ -43,6 +43,17 @@
 #include "aes.h"
 #include "./jrand.c"
 
+#ifdef AES_TT
+/* same calls on the T-table core of ../aes_shared, whose context holds */
+/* both the encryption and the decryption key schedules                */
+#include "aes_tt.h"
+#define aes                       aes_tt_ctx
+#define initialize_aes()          aes_tt_init()
+#define set_key(k, n, f, cx)      aes_tt_set_key(cx, k, 8 * (n))
+#define encrypt(in, out, cx)      aes_tt_encrypt(cx, in, out)
+#define decrypt(in, out, cx)      aes_tt_decrypt(cx, in, out)
+#endif
+
 #ifndef fpos_t
    #define fpos_t size_t
 #endif
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2018 ETH Zurich and University of Bologna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Mantainer: Luca Valente, luca.valente2@unibo.it
+ */
+
+/*
+ * Packed-SIMD stencil kernel template. Every inclusion defines one kernel,
+ * configured with:
+ *
+ *   ST_NAME   function name
+ *   ST_BITS   8 (signed char, 4 lanes) or 16 (short, 2 lanes)
+ *   ST_R      radius, the stencil is a (2R+1) x (2R+1) box of weights
+ *   ST_ROWS   output rows computed per pass
+ *
+ * void ST_NAME(const T *in, T *out, int stride, int ny, int nx,
+ *              const T *w, int shift);
+ *
+ * out[y][x] = clip((sum w[a][b] * in[y+a-R][x+b-R] + round) >> shift),
+ * for 0 <= y < ny, 0 <= x < nx; in and out point to the first point, rows
+ * are stride elements apart. Each row of w is zero padded to a whole number
+ * of vectors (ST_NV), zero weights being free of charge in the dot product.
+ *
+ * Every pass computes ST_ROWS x lanes outputs. Each input row involved is
+ * loaded once, at word-aligned addresses only; the windows of the shifted
+ * outputs are built with pv.shuffle2 and used, with pv.sdotsp, by all the
+ * output rows they contribute to. All the inner loops have constant trip
+ * counts and unroll completely, the x loop becomes a hardware loop.
+ *
+ * in, out and stride must be word aligned, nx a multiple of the lanes and
+ * ny of ST_ROWS. R rows above and below, and 8 columns on both sides of
+ * the points, must be readable (enough up to R = 4).
+ */
+
+#ifndef _STENCIL_TMPL_ONCE
+#define _STENCIL_TMPL_ONCE
+
+typedef signed short StencsV __attribute__((vector_size (4)));
+typedef signed char  StenccV __attribute__((vector_size (4)));
+
+// 4 consecutive elements starting at element o of the aligned vectors v
+static inline StenccV st_win8(const StenccV *v, int o)
+{
+  switch (o & 3) {
+  case 1:  return __builtin_shuffle(v[o>>2], v[(o>>2)+1], (StenccV){1, 2, 3, 4});
+  case 2:  return __builtin_shuffle(v[o>>2], v[(o>>2)+1], (StenccV){2, 3, 4, 5});
+  case 3:  return __builtin_shuffle(v[o>>2], v[(o>>2)+1], (StenccV){3, 4, 5, 6});
+  default: return v[o>>2];
+  }
+}
+
+static inline StencsV st_win16(const StencsV *v, int o)
+{
+  if (o & 1)
+    return __builtin_shuffle(v[o>>1], v[(o>>1)+1], (StencsV){1, 2});
+  return v[o>>1];
+}
+
+#endif
+
+#if ST_BITS == 8
+#define ST_T        signed char
+#define ST_V        StenccV
+#define ST_L        4
+#define ST_WIN      st_win8
+#define ST_DOTP     __SUMDOTP4
+#define ST_CLIP(x)  __CLIP(x, 7)
+#else
+#define ST_T        short
+#define ST_V        StencsV
+#define ST_L        2
+#define ST_WIN      st_win16
+#define ST_DOTP     __SUMDOTP2
+#define ST_CLIP(x)  __CLIP(x, 15)
+#endif
+
+// left columns loaded (R rounded up to the lanes), vectors per weight row
+// and aligned vectors loaded per input row
+#define ST_RA       (((ST_R + ST_L - 1) / ST_L) * ST_L)
+#define ST_NV       ((2*ST_R + ST_L) / ST_L)
+#define ST_NA       ((ST_RA - ST_R + ST_L - 1 + ST_NV*ST_L - 1) / ST_L + 1)
+
+void ST_NAME(const ST_T *in, ST_T *out, int stride, int ny, int nx, const ST_T *w, int shift)
+{
+  const ST_V *wv = (const ST_V *) w;
+  int rnd = shift ? 1 << (shift-1) : 0;
+  int y, x;
+
+  for (y = 0; y < ny; y += ST_ROWS) {
+    for (x = 0; x < nx; x += ST_L) {
+      int acc[ST_ROWS][ST_L];
+      int r, o, j, m;
+
+      for (o = 0; o < ST_ROWS; o++)
+        for (j = 0; j < ST_L; j++)
+          acc[o][j] = rnd;
+
+      for (r = 0; r < ST_ROWS + 2*ST_R; r++) {
+        const ST_V *p = (const ST_V *) (in + (y + r - ST_R)*stride + x - ST_RA);
+        ST_V v[ST_NA];
+
+        for (m = 0; m < ST_NA; m++)
+          v[m] = p[m];
+
+        for (j = 0; j < ST_L; j++) {
+          ST_V win[ST_NV];
+
+          for (m = 0; m < ST_NV; m++)
+            win[m] = ST_WIN(v, ST_RA - ST_R + j + m*ST_L);
+
+          // input row r is weight row r - o of output row o
+          for (o = 0; o < ST_ROWS; o++) {
+            if (r - o < 0 || r - o > 2*ST_R)
+              continue;
+            for (m = 0; m < ST_NV; m++)
+              acc[o][j] = ST_DOTP(win[m], wv[(r - o)*ST_NV + m], acc[o][j]);
+          }
+        }
+      }
+
+      for (o = 0; o < ST_ROWS; o++) {
+        ST_V *po = (ST_V *) (out + (y + o)*stride + x);
+#if ST_L == 4
+        *po = __PACK4(ST_CLIP(acc[o][0] >> shift), ST_CLIP(acc[o][1] >> shift),
+                      ST_CLIP(acc[o][2] >> shift), ST_CLIP(acc[o][3] >> shift));
+#else
+        *po = __PACK2(ST_CLIP(acc[o][0] >> shift), ST_CLIP(acc[o][1] >> shift));
+#endif
+      }
+    }
+  }
+}
+
+#undef ST_RA
+#undef ST_NV
+#undef ST_NA
+#undef ST_T
+#undef ST_V
+#undef ST_L
+#undef ST_WIN
+#undef ST_DOTP
+#undef ST_CLIP
+#undef ST_NAME
+#undef ST_BITS
+#undef ST_R
+#undef ST_ROWS
@@ -30,15 +30,82 @@ void stencil_vect1();
 RT_LOCAL_DATA char C[N+8][M+8];
 RT_LOCAL_DATA char A[N+8][M+8];
 
+#ifndef RV_ISA_RV32
+/* Template kernels, packed SIMD only, on grids with a frame of 8 */
+#define P 8
+
+#define ST_NAME stencil8_r1
+#define ST_BITS 8
+#define ST_R    1
+#define ST_ROWS 2
+#include "stencil_tmpl.h"
+
+#define ST_NAME stencil16_r1
+#define ST_BITS 16
+#define ST_R    1
+#define ST_ROWS 2
+#include "stencil_tmpl.h"
+
+#define ST_NAME stencil8_r2
+#define ST_BITS 8
+#define ST_R    2
+#define ST_ROWS 2
+#include "stencil_tmpl.h"
+
+#define ST_NAME stencil16_r2
+#define ST_BITS 16
+#define ST_R    2
+#define ST_ROWS 2
+#include "stencil_tmpl.h"
+
+#define ST_NAME stencil8_r3
+#define ST_BITS 8
+#define ST_R    3
+#define ST_ROWS 1
+#include "stencil_tmpl.h"
+
+#define ST_NAME stencil16_r3
+#define ST_BITS 16
+#define ST_R    3
+#define ST_ROWS 1
+#include "stencil_tmpl.h"
+
+typedef void (*stencil8_fn)(const signed char *, signed char *, int, int, int, const signed char *, int);
+typedef void (*stencil16_fn)(const short *, short *, int, int, int, const short *, int);
+
+RT_LOCAL_DATA signed char A8[N+2*P][M+2*P] __attribute__((aligned(4)));
+RT_LOCAL_DATA signed char C8[N+2*P][M+2*P] __attribute__((aligned(4)));
+RT_LOCAL_DATA short A16[N+2*P][M+2*P] __attribute__((aligned(4)));
+RT_LOCAL_DATA short C16[N+2*P][M+2*P] __attribute__((aligned(4)));
+
+/* (2R+1) rows of weights, each padded to 12 */
+RT_LOCAL_DATA signed char W8[7*12] __attribute__((aligned(4)));
+RT_LOCAL_DATA short W16[7*12] __attribute__((aligned(4)));
+#endif
+
 
 #define CHKSUM 60480
 
 void check_stencil_simple(testresult_t *result, void (*start)(), void (*stop)());
 void check_stencil_split (testresult_t *result, void (*start)(), void (*stop)());
+void check_vect8_r1 (testresult_t *result, void (*start)(), void (*stop)());
+void check_vect16_r1(testresult_t *result, void (*start)(), void (*stop)());
+void check_vect8_r2 (testresult_t *result, void (*start)(), void (*stop)());
+void check_vect16_r2(testresult_t *result, void (*start)(), void (*stop)());
+void check_vect8_r3 (testresult_t *result, void (*start)(), void (*stop)());
+void check_vect16_r3(testresult_t *result, void (*start)(), void (*stop)());
 
 testcase_t testcases[] = {
   { .name = "stencil_vect_simple",        .test = check_stencil_simple  },
   { .name = "stencil_vect_split",         .test = check_stencil_split   },
+#ifndef RV_ISA_RV32
+  { .name = "stencil_vect8_r1",           .test = check_vect8_r1        },
+  { .name = "stencil_vect16_r1",          .test = check_vect16_r1       },
+  { .name = "stencil_vect8_r2",           .test = check_vect8_r2        },
+  { .name = "stencil_vect16_r2",          .test = check_vect16_r2       },
+  { .name = "stencil_vect8_r3",           .test = check_vect8_r3        },
+  { .name = "stencil_vect16_r3",          .test = check_vect16_r3       },
+#endif
   {0, 0}
 };
 
@@ -156,3 +223,135 @@ void stencil_vect0()
     }
   }
 }
+
+#ifndef RV_ISA_RV32
+/*
+ * Template kernel checks. Radius 1 is the 5-point stencil of stencil_vect0
+ * on the same data, so it must give CHKSUM; radius 2 is a 5x5 binomial
+ * blur and radius 3 a 7x7 center-surround filter that saturates, both on
+ * signed data. Every point is also compared with a
+ * plain scalar evaluation.
+ */
+
+static int weight(int r, int a, int b)
+{
+  static const int binom[5] = { 1, 4, 6, 4, 1 };
+  int da = a - r, db = b - r;
+
+  if (r == 1)
+    return (a == 1 && b == 1) ? 4 : (da == 0 || db == 0) ? 1 : 0;
+  if (r == 2)
+    return binom[a] * binom[b];
+  if (da == 0 && db == 0)
+    return 60;
+  return (da*da + db*db <= 4) ? -4 : 1;
+}
+
+static int shift_of(int r)
+{
+  return r == 1 ? 0 : r == 2 ? 8 : 2;
+}
+
+/* interior value of point (i, k), amp bounds the magnitude */
+static int value(int r, int i, int k, int amp)
+{
+  if (i < 0 || i >= N || k < 0 || k >= M)
+    return 0;
+  if (r == 1)
+    return (i+k+9)%16;
+  if (r == 3)
+    amp >>= 3;  /* so that only part of the outputs saturate */
+  return ((i*29 + k*47 + i*k*13) % (2*amp)) - amp;
+}
+
+static int reference(int r, int bits, int y, int x)
+{
+  int amp = 1 << (bits-1);
+  int acc = shift_of(r) ? 1 << (shift_of(r)-1) : 0;
+  int a, b;
+
+  for (a = 0; a <= 2*r; a++)
+    for (b = 0; b <= 2*r; b++)
+      acc += weight(r, a, b) * value(r, y+a-r, x+b-r, amp);
+  acc >>= shift_of(r);
+  if (acc > amp-1) acc = amp-1;
+  if (acc < -amp)  acc = -amp;
+  return acc;
+}
+
+static void check_vect(testresult_t *result, void (*start)(), void (*stop)(),
+                       int r, stencil8_fn f8, stencil16_fn f16)
+{
+  int bits = f8 ? 8 : 16;
+  int lanes = 32 / bits;
+  int nv = (2*r + lanes) / lanes;
+  int check_sum = 0;
+  int i, k;
+
+  printf("Start stencil %d bit radius %d\n", bits, r);
+
+  for (i=0;i<N+2*P;i++)
+    for (k=0;k<M+2*P;k++) {
+      int v = value(r, i-P, k-P, 1 << (bits-1));
+      if (f8) A8[i][k] = v; else A16[i][k] = v;
+    }
+
+  for (i=0;i<2*r+1;i++)
+    for (k=0;k<nv*lanes;k++) {
+      int w = k < 2*r+1 ? weight(r, i, k) : 0;
+      if (f8) W8[i*nv*lanes + k] = w; else W16[i*nv*lanes + k] = w;
+    }
+
+  start();
+  if (f8)
+    f8(&A8[P][P], &C8[P][P], M+2*P, N, M, W8, shift_of(r));
+  else
+    f16(&A16[P][P], &C16[P][P], M+2*P, N, M, W16, shift_of(r));
+  stop();
+
+  for (i=0;i<N;i++)
+    for (k=0;k<M;k++) {
+      int c = f8 ? C8[i+P][k+P] : C16[i+P][k+P];
+      check_sum += c;
+      if (c != reference(r, bits, i, k))
+        result->errors++;
+    }
+
+#ifdef DEBUG_OUTPUT
+  printf("\nchecksum = %d\n",check_sum);
+#endif
+  if (r == 1 && check_sum != CHKSUM) {
+    result->errors++;
+  }
+}
+
+void check_vect8_r1(testresult_t *result, void (*start)(), void (*stop)())
+{
+  check_vect(result, start, stop, 1, stencil8_r1, 0);
+}
+
+void check_vect16_r1(testresult_t *result, void (*start)(), void (*stop)())
+{
+  check_vect(result, start, stop, 1, 0, stencil16_r1);
+}
+
+void check_vect8_r2(testresult_t *result, void (*start)(), void (*stop)())
+{
+  check_vect(result, start, stop, 2, stencil8_r2, 0);
+}
+
+void check_vect16_r2(testresult_t *result, void (*start)(), void (*stop)())
+{
+  check_vect(result, start, stop, 2, 0, stencil16_r2);
+}
+
+void check_vect8_r3(testresult_t *result, void (*start)(), void (*stop)())
+{
+  check_vect(result, start, stop, 3, stencil8_r3, 0);
+}
+
+void check_vect16_r3(testresult_t *result, void (*start)(), void (*stop)())
+{
+  check_vect(result, start, stop, 3, 0, stencil16_r3);
+}
+#endif